@@ -49,10 +49,15 @@ file(GLOB_RECURSE
     "${CMSIS_DSP_SRC_DIR}/CommonTables/arm_*.c"
     "${CMSIS_DSP_SRC_DIR}/TransformFunctions/arm_*.c"
     "${CMSIS_DSP_SRC_DIR}/StatisticsFunctions/arm_*.c"
+    "${CMSIS_DSP_SRC_DIR}/MatrixFunctions/arm_mat_init_f32.c"
+    "${CMSIS_DSP_SRC_DIR}/MatrixFunctions/arm_mat_mult_f32.c"
+    "${CMSIS_DSP_SRC_DIR}/SupportFunctions/arm_f16_to_float.c"
+    "${CMSIS_DSP_SRC_DIR}/SupportFunctions/arm_float_to_f16.c"
 
     # Issue with q15 and q31 functions with Arm GNU toolchain, we only
-    # need f32 functions.
-    "${CMSIS_DSP_SRC_DIR}/ComplexMathFunctions/arm_*f32.c")
+    # need f32 and f16 functions.
+    "${CMSIS_DSP_SRC_DIR}/ComplexMathFunctions/arm_*f32.c"
+    "${CMSIS_DSP_SRC_DIR}/ComplexMathFunctions/arm_*f16.c")
 
 # 4. Create static library
 set(CMSIS_DSP_TARGET        cmsis-dsp)
@@ -95,6 +100,13 @@ target_compile_definitions(${CMSIS_DSP_TARGET} PUBLIC
     ARM_TABLE_BITREVIDX_FLT_512 # see https://github.com/ARM-software/CMSIS-DSP/issues/61
     ARM_TABLE_BITREVIDX_FXT_1024
     ARM_TABLE_BITREVIDX_FLT_1024
+    ARM_TABLE_TWIDDLECOEF_Q31_256
+    ARM_TABLE_TWIDDLECOEF_Q31_512
+    ARM_TABLE_REALCOEF_Q31
+    ARM_TABLE_TWIDDLECOEF_F16_256
+    ARM_TABLE_TWIDDLECOEF_F16_512
+    ARM_TABLE_TWIDDLECOEF_RFFT_F16_512
+    ARM_TABLE_TWIDDLECOEF_RFFT_F16_1024
     ARM_FAST_ALLOW_TABLES
     ARM_ALL_FAST_TABLES
 )
@@ -45,6 +45,14 @@ USER_OPTION(LOG_LEVEL "Log level for the application"
     LOG_LEVEL_INFO
     STRING)
 
+USER_OPTION(LOG_DEFERRED "Record log messages unformatted in a ring buffer and print them when the application flushes the log"
+    OFF
+    BOOL)
+
+USER_OPTION(MEMORY_PROFILING "Track heap allocations and the stack high-water mark of each profiling region"
+    OFF
+    BOOL)
+
 USER_OPTION(TENSORFLOW_SRC_PATH "Path to the root of the tensor flow directory"
     "${DEPENDENCY_ROOT_DIR}/tensorflow"
     PATH)
@@ -75,6 +83,10 @@ USER_OPTION(CPU_PROFILE_ENABLED "Output CPU performance profiling information. S
     OFF
     BOOL)
 
+USER_OPTION(FEATURE_EXTRACTION_F16 "Run the FFT of the MFCC and Mel spectrogram feature extraction in half precision."
+    OFF
+    BOOL)
+
 USER_OPTION(TENSORFLOW_LITE_MICRO_BUILD_TYPE "TensorFlow Lite Mirco build type (release/debug etc.)"
     $<IF:$<CONFIG:RELEASE>,release_with_logs,debug>
     STRING)
@@ -109,13 +109,75 @@ function(platform_custom_post_build)
         list(APPEND TEST_SOURCES ${TEST_SOURCES_GEN})
         list(APPEND TEST_RESOURCES_INCLUDE ${TEST_INC_GEN_DIR})
 
+        # Some common tests emulate the two cores with host threads
+        find_package(Threads REQUIRED)
+
+        # The evaluation tools are host-only and tested with the native tests
+        set(EVAL_SRC_DIR ${SRC_PATH}/application/eval)
+        set(EVAL_SOURCES
+                ${EVAL_SRC_DIR}/ArenaAnalyser.cc
+                ${EVAL_SRC_DIR}/BatchEvaluator.cc
+                ${EVAL_SRC_DIR}/EvalDataLoaders.cc)
+
         set(TEST_TARGET_NAME "${use_case}_tests")
-        add_executable(${TEST_TARGET_NAME} ${TEST_SOURCES})
-        target_include_directories(${TEST_TARGET_NAME} PRIVATE ${TEST_RESOURCES_INCLUDE})
-        target_link_libraries(${TEST_TARGET_NAME} PRIVATE ${UC_LIB_NAME} mlek::Catch2)
+        add_executable(${TEST_TARGET_NAME} ${TEST_SOURCES} ${EVAL_SOURCES})
+        target_include_directories(${TEST_TARGET_NAME} PRIVATE ${TEST_RESOURCES_INCLUDE} ${EVAL_SRC_DIR}/include)
+        target_link_libraries(${TEST_TARGET_NAME} PRIVATE ${UC_LIB_NAME} mlek::Catch2 Threads::Threads)
         target_compile_definitions(${TEST_TARGET_NAME} PRIVATE
                 "ACTIVATION_BUF_SZ=${${use_case}_ACTIVATION_BUF_SZ}"
                 TESTS)
         add_test(NAME "${use_case}-tests" COMMAND ${TEST_TARGET_NAME} -r junit -o ${TEST_TARGET_NAME}.xml)
+
+        # Deferred logging is only compiled in with LOG_DEFERRED, so its tests
+        # get a target of their own that always defines it.
+        if (NOT TARGET log_deferred_tests)
+            add_executable(log_deferred_tests
+                    ${TEST_SRCS}/common/LogDeferredTests.cc
+                    ${SRC_PATH}/log/source/log_deferred.c)
+            set_property(TARGET log_deferred_tests PROPERTY C_STANDARD 11)
+            target_include_directories(log_deferred_tests PRIVATE ${SRC_PATH}/log/include)
+            target_link_libraries(log_deferred_tests PRIVATE mlek::Catch2)
+            target_compile_definitions(log_deferred_tests PRIVATE
+                    LOG_DEFERRED=1
+                    CATCH_CONFIG_MAIN)
+            add_test(NAME "log-deferred-tests" COMMAND log_deferred_tests -r junit -o log_deferred_tests.xml)
+        endif ()
+    endif ()
+
+    # Dataset evaluation driver, for use cases that have one:
+    #   <use_case>_eval <manifest> [-j workers] [-o results.csv]
+    set(EVAL_SRC_DIR ${SRC_PATH}/application/eval)
+    if (EXISTS ${EVAL_SRC_DIR}/use_case/${use_case})
+        find_package(Threads REQUIRED)
+        file(GLOB EVAL_UC_SOURCES "${EVAL_SRC_DIR}/use_case/${use_case}/*.cc")
+
+        set(EVAL_TARGET_NAME "${use_case}_eval")
+        add_executable(${EVAL_TARGET_NAME}
+                ${EVAL_SRC_DIR}/BatchEvaluator.cc
+                ${EVAL_SRC_DIR}/EvalDataLoaders.cc
+                ${EVAL_UC_SOURCES})
+        target_include_directories(${EVAL_TARGET_NAME} PRIVATE ${EVAL_SRC_DIR}/include)
+        target_link_libraries(${EVAL_TARGET_NAME} PRIVATE ${UC_LIB_NAME} Threads::Threads)
+        message(STATUS "Adding evaluation driver ${EVAL_TARGET_NAME}")
+    endif ()
+
+    # Arena analyser, built once as it takes the models to analyse as arguments:
+    #   arena_analyser <model.tflite> [<model.tflite> ...] [-o arena_size.h] [-m margin %]
+    if (NOT TARGET arena_analyser)
+        add_executable(arena_analyser
+                ${EVAL_SRC_DIR}/ArenaAnalyser.cc
+                ${EVAL_SRC_DIR}/tools/ArenaAnalyserMain.cc)
+        target_include_directories(arena_analyser PRIVATE ${EVAL_SRC_DIR}/include)
+        target_link_libraries(arena_analyser PRIVATE common_api)
+        message(STATUS "Adding arena_analyser")
+    endif ()
+
+    # Change detection benchmark, on synthetic frames:
+    #   change_detector_bench [-s cols rows] [-c 1|3] [-f frames] [-t threshold] [-n subsample] [-r refresh]
+    if (NOT TARGET change_detector_bench)
+        add_executable(change_detector_bench
+                ${EVAL_SRC_DIR}/tools/ChangeDetectorBenchMain.cc)
+        target_link_libraries(change_detector_bench PRIVATE common_api)
+        message(STATUS "Adding change_detector_bench")
     endif ()
 endfunction()
\ No newline at end of file
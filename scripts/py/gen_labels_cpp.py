@@ -17,7 +17,7 @@
 
 """
 Utility script to convert a given text file with labels (annotations for an
-NN model output vector) into a vector list initialiser. The intention is for
+NN model output vector) into a table of label views in flash. The intention is for
 this script to be called as part of the build framework to auto-generate the
 cpp file with labels that can be used in the application without modification.
 """
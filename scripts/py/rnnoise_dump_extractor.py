@@ -18,19 +18,103 @@ the dumped noise reduced audio to a wav file.
 
 Example use:
 python rnnoise_dump_extractor.py --dump_file output.bin --output_dir ./denoised_wavs/
+
+If the application was built with noise_reduction_MEM_DUMP_RING, the dump
+holds the ring of chunks described next to RingAudioSink in AudioSink.hpp.
+Add --ring, and give snapshots of the whole dump region; several snapshots
+taken while the application runs are merged by chunk sequence number:
+python rnnoise_dump_extractor.py --ring --dump_file snap0.bin snap1.bin --output_dir ./denoised_wavs/
 """
 
 import soundfile as sf
 import numpy as np
 
 import argparse
+import io
 from os import path
 import struct
+import sys
+
+# SpscRing layout: producer line, consumer line, then the items.
+RING_LINE_SIZE = 32
+RING_HEAD_OFFSET = 0
+RING_TAIL_OFFSET = RING_LINE_SIZE
+RING_ITEMS_OFFSET = 2 * RING_LINE_SIZE
+
+# AudioChunk header: sequence number and payload bytes in use.
+CHUNK_HEADER_FORMAT = "<II"
+CHUNK_HEADER_SIZE = struct.calcsize(CHUNK_HEADER_FORMAT)
+
+
+def ring_chunks(region_bytes, chunk_bytes):
+    """Number of chunks in the ring, as chosen by DumpRingChunks in the application."""
+    chunks = 1
+    while (2 * chunks + 1) * (chunk_bytes + CHUNK_HEADER_SIZE) + 128 <= region_bytes:
+        chunks *= 2
+    return chunks
+
+
+def read_ring(snapshot, chunk_bytes, num_chunks):
+    """Returns the chunks between the consumer and producer indices of a ring snapshot,
+    as a dictionary of payloads keyed by sequence number."""
+    item_size = CHUNK_HEADER_SIZE + chunk_bytes
+    if len(snapshot) < RING_ITEMS_OFFSET + num_chunks * item_size:
+        raise ValueError("Snapshot of {} bytes is too small for {} chunks".format(len(snapshot), num_chunks))
+
+    head, dropped = struct.unpack_from("<II", snapshot, RING_HEAD_OFFSET)
+    tail = struct.unpack_from("<I", snapshot, RING_TAIL_OFFSET)[0]
+    pending = (head - tail) & 0xFFFFFFFF
+    if pending > num_chunks:
+        raise ValueError("Ring indices head={} tail={} are not valid for {} chunks".format(head, tail, num_chunks))
+    if dropped:
+        print("Warning: the application dropped {} chunks".format(dropped), file=sys.stderr)
+
+    chunks = {}
+    for index in range(tail, tail + pending):
+        offset = RING_ITEMS_OFFSET + (index % num_chunks) * item_size
+        sequence, num_bytes = struct.unpack_from(CHUNK_HEADER_FORMAT, snapshot, offset)
+        if num_bytes > chunk_bytes:
+            raise ValueError("Chunk {} claims {} bytes".format(sequence, num_bytes))
+        start = offset + CHUNK_HEADER_SIZE
+        chunks[sequence] = snapshot[start:start + num_bytes]
+    return chunks
+
+
+def drain_ring(dump_files, chunk_bytes, num_chunks):
+    """Merges the chunks of ring snapshots back into the flat dump stream,
+    stopping at the first missing sequence number."""
+    chunks = {}
+    for fp in dump_files:
+        snapshot = fp.read()
+        count = num_chunks if num_chunks else ring_chunks(len(snapshot), chunk_bytes)
+        chunks.update(read_ring(snapshot, chunk_bytes, count))
+
+    stream = io.BytesIO()
+    if not chunks:
+        return stream
+    first = min(chunks)
+    if first != 0:
+        print("Warning: chunks before sequence number {} are missing".format(first), file=sys.stderr)
+        return stream
+    sequence = first
+    while sequence in chunks:
+        stream.write(chunks[sequence])
+        sequence += 1
+    if sequence <= max(chunks):
+        print("Warning: chunk {} is missing, later chunks are ignored".format(sequence), file=sys.stderr)
+    stream.seek(0)
+    return stream
 
 
 def extract(fp, output_dir, export_npy):
     while True:
-        filename_length = struct.unpack("i", fp.read(4))[0]
+        length_field = fp.read(4)
+
+        # A ring stream ends without the end marker.
+        if len(length_field) < 4:
+            return
+
+        filename_length = struct.unpack("i", length_field)[0]
 
         if filename_length == -1:
             return
@@ -39,7 +123,11 @@ def extract(fp, output_dir, export_npy):
         audio_clip_length = struct.unpack("I", fp.read(4))[0]
         output_file_name = path.join(output_dir, "denoised_{}".format(filename))
         audio_clip = fp.read(audio_clip_length)
-        
+        if len(audio_clip) < audio_clip_length:
+            print("Warning: {} is truncated".format(filename), file=sys.stderr)
+            audio_clip = audio_clip[:len(audio_clip) & ~1]
+            audio_clip_length = len(audio_clip)
+
         with sf.SoundFile(output_file_name, 'w', channels=1, samplerate=48000, subtype="PCM_16", endian="LITTLE") as wav_file:
             wav_file.buffer_write(audio_clip, dtype='int16')
             print("{} written to disk".format(output_file_name))
@@ -53,11 +141,22 @@ def extract(fp, output_dir, export_npy):
 
 
 def main(args):
-    extract(args.dump_file, args.output_dir, args.export_npy)
+    if args.ring:
+        stream = drain_ring(args.dump_file, args.chunk_bytes, args.ring_chunks)
+        extract(stream, args.output_dir, args.export_npy)
+    else:
+        for dump_file in args.dump_file:
+            extract(dump_file, args.output_dir, args.export_npy)
 
 
 parser = argparse.ArgumentParser()
-parser.add_argument("--dump_file", type=argparse.FileType('rb'), help="Dump file with audio files to extract.", required=True)
+parser.add_argument("--dump_file", type=argparse.FileType('rb'), nargs="+",
+                    help="Dump file with audio files to extract, or ring snapshots with --ring.", required=True)
+parser.add_argument("--ring", help="Dump files are snapshots of a ring of chunks (noise_reduction_MEM_DUMP_RING)",
+                    action="store_true")
+parser.add_argument("--chunk_bytes", type=int, default=4096, help="Payload bytes per ring chunk.")
+parser.add_argument("--ring_chunks", type=int, default=0,
+                    help="Number of chunks in the ring; by default derived from the snapshot size.")
 parser.add_argument("--output_dir", help="Output directory, Warning: Duplicated file names will be overwritten.", required=True)
 parser.add_argument("--export_npy", help="Export the audio buffer in NumPy format", action="store_true")
 args = parser.parse_args()
@@ -17,6 +17,7 @@
 #ifndef AUDIO_UTILS_HPP
 #define AUDIO_UTILS_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 
@@ -164,6 +165,215 @@ namespace audio {
         }
     };
 
+    /**
+     * @brief   Non-owning view of contiguous elements, a C++14 stand-in for std::span.
+     */
+    template<class T>
+    class Span {
+    public:
+        constexpr Span() = default;
+
+        /**
+         * @brief     Creates a view of the given elements.
+         * @param[in] data   Pointer to the first element.
+         * @param[in] size   Number of elements.
+         */
+        constexpr Span(T* data, size_t size) : m_data{data}, m_size{size} {}
+
+        constexpr T* data() const { return m_data; }
+        constexpr size_t size() const { return m_size; }
+        constexpr bool empty() const { return m_size == 0; }
+        constexpr T* begin() const { return m_data; }
+        constexpr T* end() const { return m_data + m_size; }
+        constexpr T& operator[](size_t i) const { return m_data[i]; }
+
+    private:
+        T* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    /**
+     * @brief   K consecutive windows of a WindowView, as a 2-D strided view:
+     *          window k starts k * Stride() elements after the first one.
+     *          Only the last window can be shorter than WindowSize(), at the
+     *          end of the data of a fractional view.
+     */
+    template<class T>
+    class WindowBatch {
+    public:
+        constexpr WindowBatch() = default;
+
+        /**
+         * @brief     Creates the batch view.
+         * @param[in] first        Pointer to the start of the first window.
+         * @param[in] count        Number of windows.
+         * @param[in] windowSize   Window size in T type elements.
+         * @param[in] stride       Stride between windows in T type elements.
+         * @param[in] dataEnd      End of the underlying data, windows are cut there.
+         */
+        constexpr WindowBatch(T* first, size_t count, size_t windowSize, size_t stride, T* dataEnd)
+            : m_first{first}, m_count{count}, m_windowSize{windowSize}, m_stride{stride}, m_dataEnd{dataEnd} {}
+
+        /** @brief Number of windows in the batch. */
+        constexpr size_t Count() const { return m_count; }
+
+        /** @brief Full window size in T type elements. */
+        constexpr size_t WindowSize() const { return m_windowSize; }
+
+        /** @brief Distance between the starts of consecutive windows. */
+        constexpr size_t Stride() const { return m_stride; }
+
+        /** @brief Start of the first window. */
+        constexpr T* Data() const { return m_first; }
+
+        /** @brief Whether every window is WindowSize() long, so the batch can be used as a strided matrix. */
+        constexpr bool IsFull() const
+        {
+            return m_count == 0 || m_first + (m_count - 1) * m_stride + m_windowSize <= m_dataEnd;
+        }
+
+        /**
+         * @brief     Gets a window of the batch.
+         * @param[in] k   Window index within the batch, less than Count().
+         * @return    View of the window.
+         */
+        constexpr Span<T> operator[](size_t k) const
+        {
+            T* start = m_first + k * m_stride;
+            return Span<T>(start, std::min<size_t>(m_windowSize, static_cast<size_t>(m_dataEnd - start)));
+        }
+
+    private:
+        T* m_first = nullptr;
+        size_t m_count = 0;
+        size_t m_windowSize = 0;
+        size_t m_stride = 0;
+        T* m_dataEnd = nullptr;
+    };
+
+    /**
+     * @brief   Non-virtual, non-owning sliding window through data. Windows are
+     *          views into the data, accessed at random with Window(), one at a
+     *          time with Next(), or several at a time with NextBatch().
+     *          A fractional view covers the whole data like FractionalSlidingWindow,
+     *          its last window being cut short at the end of the data.
+     */
+    template<class T>
+    class WindowView {
+    public:
+        constexpr WindowView() = default;
+
+        /**
+         * @brief     Creates the window view through the given data.
+         * @param[in] data         Pointer to the data to slide through.
+         * @param[in] dataSize     Size in T type elements wise.
+         * @param[in] windowSize   Sliding window size in T type wise elements.
+         * @param[in] stride       Stride size in T type wise elements.
+         * @param[in] fractional   Whether the last window may be partial.
+         */
+        constexpr WindowView(T* data, size_t dataSize, size_t windowSize, size_t stride,
+                             bool fractional = false)
+            : m_start{data}, m_dataSize{dataSize}, m_size{windowSize}, m_stride{stride},
+              m_fractional{fractional} {}
+
+        /** @brief Total number of windows through the data. */
+        constexpr size_t NumWindows() const
+        {
+            if (m_stride == 0 || m_dataSize == 0) {
+                return 0;
+            }
+            if (m_dataSize < m_size) {
+                return m_fractional ? 1 : 0;
+            }
+            if (!m_fractional) {
+                return (m_dataSize - m_size) / m_stride + 1;
+            }
+            /* Windows start before the end of the data and no window starts
+             * after one which already reaches the end. */
+            const size_t covered = std::min(m_dataSize, m_dataSize - m_size + m_stride);
+            return (covered + m_stride - 1) / m_stride;
+        }
+
+        /** @brief Index from the start of the data where a window begins. */
+        constexpr size_t WindowStart(size_t index) const { return index * m_stride; }
+
+        /** @brief Window size in T type elements. */
+        constexpr size_t WindowSize() const { return m_size; }
+
+        /**
+         * @brief     Gets a window.
+         * @param[in] index   Window index, less than NumWindows().
+         * @return    View of the window, shorter than the window size only for
+         *            the last window of a fractional view.
+         */
+        constexpr Span<T> Window(size_t index) const
+        {
+            return Windows(index, 1)[0];
+        }
+
+        /**
+         * @brief     Gets consecutive windows.
+         * @param[in] first   Index of the first window.
+         * @param[in] count   Number of windows, cut to the windows available.
+         * @return    Batch view of the windows.
+         */
+        constexpr WindowBatch<T> Windows(size_t first, size_t count) const
+        {
+            const size_t total = NumWindows();
+            const size_t available = first < total ? total - first : 0;
+            return WindowBatch<T>(m_start + WindowStart(first), std::min(count, available),
+                                  m_size, m_stride, m_start + m_dataSize);
+        }
+
+        /** @brief Checks if the next window is available. */
+        constexpr bool HasNext() const { return m_count < NumWindows(); }
+
+        /**
+         * @brief  Gets the next window.
+         * @return View of the window, empty if there are no more windows.
+         */
+        constexpr Span<T> Next()
+        {
+            return HasNext() ? Window(m_count++) : Span<T>();
+        }
+
+        /**
+         * @brief     Gets up to maxCount next windows at once.
+         * @param[in] maxCount   Maximum number of windows.
+         * @return    Batch view of the windows, with Count() of 0 at the end.
+         */
+        constexpr WindowBatch<T> NextBatch(size_t maxCount)
+        {
+            const WindowBatch<T> batch = Windows(m_count, maxCount);
+            m_count += batch.Count();
+            return batch;
+        }
+
+        /** @brief Index of the last window returned by Next() or NextBatch(). */
+        constexpr size_t Index() const { return m_count == 0 ? 0 : m_count - 1; }
+
+        /** @brief Resets the view to the first window. */
+        constexpr void Reset() { m_count = 0; }
+
+        /**
+         * @brief     Resets the view to the start of the new data.
+         *            New data size MUST be the same as the old one.
+         * @param[in] newStart   Pointer to the new data to slide through.
+         */
+        constexpr void Reset(T* newStart)
+        {
+            m_start = newStart;
+            m_count = 0;
+        }
+
+    private:
+        T* m_start = nullptr;
+        size_t m_dataSize = 0;
+        size_t m_size = 0;
+        size_t m_stride = 0;
+        bool m_fractional = false;
+        size_t m_count = 0;
+    };
 
 } /* namespace audio */
 } /* namespace app */
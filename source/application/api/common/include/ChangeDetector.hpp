@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CHANGE_DETECTOR_HPP
+#define CHANGE_DETECTOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace image {
+
+    /** Parameters for frame change detection. */
+    struct ChangeDetectorParams {
+        uint32_t subsample = 4;         /* Thumbnail takes every Nth pixel of every Nth row. */
+        uint32_t blockSize = 8;         /* Side of the compared thumbnail blocks, in pixels. */
+        uint32_t blockThreshold = 12;   /* Mean absolute difference per pixel for a block to change. */
+        uint32_t minChangedBlocks = 1;  /* Changed blocks needed for the frame to change. */
+        uint32_t refreshInterval = 30;  /* Report a change at least every N frames, 0 for never. */
+    };
+
+    /**
+     * @brief   Detects whether a camera frame differs from the one last
+     *          reported as changed, so use cases can reuse the previous
+     *          result instead of running inference on an unchanged scene.
+     *
+     *          Frames are reduced to a sub-sampled grayscale thumbnail, which
+     *          is compared block by block with the reference thumbnail using
+     *          the sum of absolute differences (SAD). The reference is only
+     *          replaced when a change is reported, so slow drift accumulates
+     *          until it triggers.
+     */
+    class ChangeDetector {
+    public:
+        /**
+         * @brief       Constructor, allocates the thumbnails.
+         * @param[in]   cols       Frame width in pixels.
+         * @param[in]   rows       Frame height in pixels.
+         * @param[in]   channels   Interleaved channels per pixel, 1 (grayscale) or 3 (RGB).
+         * @param[in]   params     Change detection parameters.
+         **/
+        ChangeDetector(uint32_t cols, uint32_t rows, uint32_t channels,
+                       const ChangeDetectorParams& params = ChangeDetectorParams{});
+
+        /**
+         * @brief       Processes a new frame.
+         * @param[in]   image   Pointer to the frame, rows x cols x channels.
+         * @return      true if the frame changed, or a refresh is due, and
+         *              inference should run; false to reuse the last result.
+         **/
+        bool HasChanged(const uint8_t* image);
+
+        /** @brief  Drops the reference, so the next frame is reported as changed. */
+        void Reset();
+
+        /** @brief  Gets the number of frames reported as changed. */
+        uint32_t GetExecutedCount() const;
+
+        /** @brief  Gets the number of frames reported as unchanged. */
+        uint32_t GetSkippedCount() const;
+
+        /** @brief  Gets the number of changed blocks in the last frame. */
+        uint32_t GetLastChangedBlocks() const;
+
+        /**
+         * @brief       Computes the sum of absolute differences of two byte
+         *              arrays, using MVE or SIMD32 instructions when available.
+         * @param[in]   srcA   Pointer to the first array.
+         * @param[in]   srcB   Pointer to the second array.
+         * @param[in]   len    Number of elements.
+         * @return      Sum of |srcA[i] - srcB[i]|.
+         **/
+        static uint32_t SumAbsDiffU8(const uint8_t* srcA, const uint8_t* srcB, uint32_t len);
+
+    private:
+        /** @brief  Builds the grayscale thumbnail of a frame. */
+        void MakeThumbnail(const uint8_t* image, uint8_t* thumbnail) const;
+
+        /** @brief  Counts the blocks that differ between the current and reference thumbnails. */
+        uint32_t CountChangedBlocks() const;
+
+        ChangeDetectorParams    m_params;
+        uint32_t                m_cols;
+        uint32_t                m_channels;
+        uint32_t                m_thumbCols;
+        uint32_t                m_thumbRows;
+        std::vector<uint8_t>    m_reference;            /* Thumbnail of the last changed frame. */
+        std::vector<uint8_t>    m_current;              /* Thumbnail of the frame being processed. */
+        bool                    m_hasReference = false;
+        uint32_t                m_framesSinceRefresh = 0;
+        uint32_t                m_lastChangedBlocks = 0;
+        uint32_t                m_executed = 0;
+        uint32_t                m_skipped = 0;
+    };
+
+} /* namespace image */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* CHANGE_DETECTOR_HPP */
@@ -17,7 +17,9 @@
 #ifndef CLASSIFICATION_RESULT_HPP
 #define CLASSIFICATION_RESULT_HPP
 
-#include <string>
+#include "LabelTable.hpp"
+
+#include <cstdint>
 
 namespace arm {
 namespace app {
@@ -28,7 +30,7 @@ namespace app {
     class ClassificationResult {
     public:
         double          m_normalisedVal = 0.0;
-        std::string     m_label;
+        LabelView       m_label;
         uint32_t        m_labelIdx = 0;
 
         ClassificationResult() = default;
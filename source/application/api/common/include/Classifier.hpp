@@ -42,7 +42,7 @@ namespace app {
          * @param[in]   outputTensor   Inference output tensor from an NN model.
          * @param[out]  vecResults     A vector of classification results.
          *                             populated by this function.
-         * @param[in]   labels         Labels vector to match classified classes.
+         * @param[in]   labels         Label table to match classified classes.
          * @param[in]   topNCount      Number of top classifications to pick.
          * @param[in]   useSoftmax     Whether Softmax normalisation should be applied to output.
          * @return      true if successful, false otherwise.
@@ -51,7 +51,7 @@ namespace app {
         virtual bool GetClassificationResults(
             TfLiteTensor* outputTensor,
             std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels, uint32_t topNCount,
+            const LabelTable& labels, uint32_t topNCount,
             bool use_softmax);
 
         /**
@@ -59,13 +59,13 @@ namespace app {
         * @param[in]   topNSet        Ordered set of top 5 output class scores and labels.
         * @param[out]  vecResults     A vector of classification results.
         *                             populated by this function.
-        * @param[in]   labels         Labels vector to match classified classes.
+        * @param[in]   labels         Label table to match classified classes.
         **/
 
         void SetVectorResults(
             std::set<std::pair<float, uint32_t>>& topNSet,
             std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels);
+            const LabelTable& labels);
 
     protected:
         /**
@@ -75,14 +75,14 @@ namespace app {
          * @param[out]  vecResults   A vector of classification results
          *                           populated by this function.
          * @param[in]   topNCount    Number of top classifications to pick.
-         * @param[in]   labels       Labels vector to match classified classes.
+         * @param[in]   labels       Label table to match classified classes.
          * @return      true if successful, false otherwise.
          **/
 
         bool GetTopNResults(const std::vector<float>& tensor,
                             std::vector<ClassificationResult>& vecResults,
                             uint32_t topNCount,
-                            const std::vector <std::string>& labels);
+                            const LabelTable& labels);
     };
 
 } /* namespace app */
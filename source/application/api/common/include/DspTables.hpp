@@ -0,0 +1,426 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DSP_TABLES_HPP
+#define DSP_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /* Normalisation of the Mel filter bank weights. */
+    enum class MelNormalisation {
+        none = 0,
+        slaney = 1      /* 2 / (right - left edge in Hz), as librosa. */
+    };
+
+    /* DCT matrix taken of the log-Mel energies. */
+    enum class DctType {
+        none = 0,           /* Log-Mel output. */
+        scaled = 1,         /* sqrt(2 / N) for all rows, as MFCC. */
+        orthonormal = 2     /* As above, first row divided by sqrt(2), as Wav2LetterMFCC. */
+    };
+
+    /* Parameters a set of Mel tables is computed for, as MfccParams. */
+    struct MelTableParams {
+        float       m_samplingFreq;
+        uint32_t    m_numFbankBins;
+        float       m_melLoFreq;
+        float       m_melHiFreq;
+        uint32_t    m_numMfccFeatures;      /* DCT rows, 0 for log-Mel output. */
+        uint32_t    m_frameLen;
+        uint32_t    m_frameLenPadded;
+        bool        m_useHtkMethod;
+
+        /** @brief  Whether two sets of parameters give the same tables. */
+        bool operator==(const MelTableParams& other) const
+        {
+            return this->m_samplingFreq == other.m_samplingFreq &&
+                   this->m_numFbankBins == other.m_numFbankBins &&
+                   this->m_melLoFreq == other.m_melLoFreq &&
+                   this->m_melHiFreq == other.m_melHiFreq &&
+                   this->m_numMfccFeatures == other.m_numMfccFeatures &&
+                   this->m_frameLen == other.m_frameLen &&
+                   this->m_frameLenPadded == other.m_frameLenPadded &&
+                   this->m_useHtkMethod == other.m_useHtkMethod;
+        }
+    };
+
+    /**
+     * @brief   Read-only window, Mel filter bank and DCT of a feature
+     *          extractor. Points either at tables computed at compile time
+     *          by ConstMelTables, or at ones the extractor computed itself.
+     */
+    struct MelTables {
+        MelTableParams  m_params;
+        const float*    m_window;           /* m_frameLen values. */
+        const float*    m_weights;          /* All Mel bins' weights, back to back. */
+        const uint32_t* m_weightsStart;     /* Index of each Mel bin's first weight, then the end. */
+        const uint32_t* m_filterFirst;      /* First FFT bin of each Mel bin. */
+        const uint32_t* m_filterLast;       /* Last FFT bin of each Mel bin. */
+        const float*    m_dct;              /* Row-major m_numMfccFeatures x m_numFbankBins, or nullptr. */
+    };
+
+namespace tables {
+
+    /* Maths usable in constant expressions, in double precision. */
+    constexpr double ms_pi = 3.14159265358979323846;
+    constexpr double ms_ln2 = 0.69314718055994530942;
+
+    /** @brief  Square root, by Newton's method. */
+    constexpr double Sqrt(const double x)
+    {
+        if (x <= 0) {
+            return 0;
+        }
+        double root = x < 1 ? 1 : x;
+        for (int i = 0; i < 64; ++i) {
+            root = 0.5 * (root + x / root);
+        }
+        return root;
+    }
+
+    /** @brief  Cosine, by the Taylor series of the angle taken into [-pi, pi]. */
+    constexpr double Cos(double x)
+    {
+        const double turns = x / (2 * ms_pi);
+        x -= 2 * ms_pi * static_cast<double>(static_cast<int64_t>(turns + (turns < 0 ? -0.5 : 0.5)));
+
+        double term = 1;
+        double sum = 1;
+        for (int n = 1; n < 24; ++n) {
+            term *= -x * x / ((2 * n - 1) * (2 * n));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /** @brief  Sine. */
+    constexpr double Sin(const double x)
+    {
+        return Cos(x - ms_pi / 2);
+    }
+
+    /** @brief  Natural logarithm, as k ln(2) + 2 atanh((m - 1) / (m + 1)) for x = m 2^k. */
+    constexpr double Log(double x)
+    {
+        if (!(x > 0)) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        int k = 0;
+        for (; x >= 2; ++k) {
+            x /= 2;
+        }
+        for (; x < 1; --k) {
+            x *= 2;
+        }
+
+        const double s = (x - 1) / (x + 1);
+        double power = s;
+        double sum = 0;
+        for (int n = 1; n < 64; n += 2) {
+            sum += power / n;
+            power *= s * s;
+        }
+        return 2 * sum + k * ms_ln2;
+    }
+
+    /** @brief  Exponential, as 2^k e^r for x = k ln(2) + r. */
+    constexpr double Exp(const double x)
+    {
+        const auto k = static_cast<int>(x / ms_ln2 + (x < 0 ? -0.5 : 0.5));
+        const double r = x - k * ms_ln2;
+
+        double term = 1;
+        double sum = 1;
+        for (int n = 1; n < 24; ++n) {
+            term *= r / n;
+            sum += term;
+        }
+        for (int i = 0; i < k; ++i) {
+            sum *= 2;
+        }
+        for (int i = 0; i > k; --i) {
+            sum /= 2;
+        }
+        return sum;
+    }
+
+    /** @brief  Smallest power of 2 >= x. */
+    constexpr uint32_t NextPowerOf2(const uint32_t x)
+    {
+        uint32_t power = 1;
+        while (power < x) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    /* Fixed size array that can be filled in a constant expression. */
+    template<typename T, size_t N>
+    struct Array {
+        T m_data[N];
+
+        constexpr T& operator[](const size_t i) { return this->m_data[i]; }
+        constexpr const T& operator[](const size_t i) const { return this->m_data[i]; }
+        static constexpr size_t size() { return N; }
+    };
+
+    /* Slaney Mel scale constants, as MFCC. */
+    constexpr float ms_logStep = /*logf(6.4)*/ 1.8562979903656 / 27.0;
+    constexpr float ms_freqStep = 200.0 / 3;
+    constexpr float ms_minLogHz = 1000.0;
+    constexpr float ms_minLogMel = ms_minLogHz / ms_freqStep;
+
+    /** @brief  Mel scale, in single precision as MFCC::MelScale. */
+    constexpr float MelScale(const float freq, const bool useHtkMethod)
+    {
+        if (useHtkMethod) {
+            return 1127.0f * static_cast<float>(Log(1.0f + freq / 700.0f));
+        }
+        if (freq >= ms_minLogHz) {
+            return ms_minLogMel + static_cast<float>(Log(freq / ms_minLogHz)) / ms_logStep;
+        }
+        return freq / ms_freqStep;
+    }
+
+    /** @brief  Inverse Mel scale, in single precision as MFCC::InverseMelScale. */
+    constexpr float InverseMelScale(const float melFreq, const bool useHtkMethod)
+    {
+        if (useHtkMethod) {
+            return 700.0f * (static_cast<float>(Exp(melFreq / 1127.0f)) - 1.0f);
+        }
+        if (melFreq >= ms_minLogMel) {
+            return ms_minLogHz * static_cast<float>(Exp(ms_logStep * (melFreq - ms_minLogMel)));
+        }
+        return ms_freqStep * melFreq;
+    }
+
+    /**
+     * @brief       Walks the Mel filter bank as MFCC::CreateMelFilterBank
+     *              builds it, passing each weight to sink.Weight(fftBin,
+     *              weight) and then each Mel bin to sink.Bin(bin, first,
+     *              end), for its FFT bins [first, end). The FFT bins of a
+     *              Mel bin are contiguous as the Mel scale is monotonic, so
+     *              only those are visited.
+     **/
+    template<typename Sink>
+    constexpr void WalkMelFilterBank(const MelTableParams& params,
+                                     const MelNormalisation normalisation,
+                                     Sink& sink)
+    {
+        const bool htk = params.m_useHtkMethod;
+        const uint32_t numFftBins = params.m_frameLenPadded / 2;
+        const float fftBinWidth = params.m_samplingFreq / params.m_frameLenPadded;
+        const float melLowFreq = MelScale(params.m_melLoFreq, htk);
+        const float melHighFreq = MelScale(params.m_melHiFreq, htk);
+        const float melFreqDelta = (melHighFreq - melLowFreq) / (params.m_numFbankBins + 1);
+
+        uint32_t first = 0;
+        for (uint32_t bin = 0; bin < params.m_numFbankBins; ++bin) {
+            const float leftMel = melLowFreq + bin * melFreqDelta;
+            const float centerMel = melLowFreq + (bin + 1) * melFreqDelta;
+            const float rightMel = melLowFreq + (bin + 2) * melFreqDelta;
+            const float normaliser = normalisation == MelNormalisation::slaney ?
+                2.0f / (InverseMelScale(rightMel, htk) - InverseMelScale(leftMel, htk)) : 1.f;
+
+            while (first < numFftBins && !(MelScale(fftBinWidth * first, htk) > leftMel)) {
+                ++first;
+            }
+
+            uint32_t end = first;
+            for (; end < numFftBins; ++end) {
+                const float mel = MelScale(fftBinWidth * end, htk);
+                if (!(mel < rightMel)) {
+                    break;
+                }
+                const float weight = mel <= centerMel ?
+                    (mel - leftMel) / (centerMel - leftMel) :
+                    (rightMel - mel) / (rightMel - centerMel);
+                sink.Weight(end, weight * normaliser);
+            }
+            sink.Bin(bin, first, end);
+        }
+    }
+
+    /* Counts the weights MelTableData needs room for. */
+    struct MelWeightCounter {
+        uint32_t m_count{0};
+
+        constexpr void Weight(uint32_t, float) { ++this->m_count; }
+
+        /* An empty Mel bin keeps a single zero weight. */
+        constexpr void Bin(uint32_t, const uint32_t first, const uint32_t end)
+        {
+            this->m_count += first == end ? 1 : 0;
+        }
+    };
+
+    /** @brief  Number of weights in the Mel filter bank of the given parameters. */
+    constexpr uint32_t CountMelWeights(const MelTableParams& params,
+                                       const MelNormalisation normalisation)
+    {
+        MelWeightCounter counter{};
+        WalkMelFilterBank(params, normalisation, counter);
+        return counter.m_count;
+    }
+
+    /* Storage of the tables, NumDct is at least 1. */
+    template<uint32_t FrameLen, uint32_t NumBins, uint32_t NumWeights, uint32_t NumDct>
+    struct MelTableData {
+        Array<float, FrameLen>          m_window;
+        Array<float, NumWeights>        m_weights;
+        Array<uint32_t, NumBins + 1>    m_weightsStart;
+        Array<uint32_t, NumBins>        m_filterFirst;
+        Array<uint32_t, NumBins>        m_filterLast;
+        Array<float, NumDct>            m_dct;
+    };
+
+    /* Writes the Mel filter bank into MelTableData. */
+    template<typename Data>
+    struct MelWeightWriter {
+        Data&       m_data;
+        uint32_t    m_count{0};
+
+        constexpr void Weight(uint32_t, const float weight)
+        {
+            this->m_data.m_weights[this->m_count++] = weight;
+        }
+
+        constexpr void Bin(const uint32_t bin, const uint32_t first, const uint32_t end)
+        {
+            if (first == end) {
+                this->m_data.m_weights[this->m_count++] = 0.f;
+            }
+            this->m_data.m_filterFirst[bin] = first == end ? 0 : first;
+            this->m_data.m_filterLast[bin] = first == end ? 0 : end - 1;
+            this->m_data.m_weightsStart[bin + 1] = this->m_count;
+        }
+    };
+
+    /**
+     * @brief   Computes the Hann window, Mel filter bank and DCT, in single
+     *          precision as MFCC and its overrides do at run time.
+     **/
+    template<typename Data>
+    constexpr Data MakeMelTables(const MelTableParams& params,
+                                 const MelNormalisation normalisation,
+                                 const DctType dctType)
+    {
+        Data data{};
+
+        const auto multiplier = static_cast<float>(2 * ms_pi / params.m_frameLen);
+        for (uint32_t i = 0; i < params.m_frameLen; ++i) {
+            data.m_window[i] = static_cast<float>(
+                0.5 - 0.5 * static_cast<float>(Cos(static_cast<float>(i) * multiplier)));
+        }
+
+        MelWeightWriter<Data> writer{data};
+        WalkMelFilterBank(params, normalisation, writer);
+
+        const uint32_t numBins = params.m_numFbankBins;
+        const auto angleIncr = static_cast<float>(ms_pi / numBins);
+        const auto normaliser = static_cast<float>(Sqrt(2.0f / numBins));
+        float angle = 0;
+        for (uint32_t k = 0; k < params.m_numMfccFeatures && dctType != DctType::none; ++k) {
+            for (uint32_t n = 0; n < numBins; ++n) {
+                data.m_dct[k * numBins + n] = normaliser *
+                    static_cast<float>(Cos((n + 0.5f) * angle));
+            }
+            angle += angleIncr;
+        }
+
+        if (dctType == DctType::orthonormal) {
+            const auto normaliserK0 = static_cast<float>(2 * Sqrt(1.0f / static_cast<float>(4 * numBins)));
+            for (uint32_t n = 0; n < numBins; ++n) {
+                data.m_dct[n] = normaliserK0;
+            }
+        }
+
+        return data;
+    }
+
+} /* namespace tables */
+
+    /**
+     * @brief   Window, Mel filter bank and DCT computed at compile time for
+     *          one set of parameters, which MFCC or MelSpectrogram derived
+     *          classes can return from GetPrecomputedTables. The tables
+     *          are constant data, so they stay in flash and are shared by
+     *          every extractor with the same parameters.
+     */
+    template<uint32_t SamplingFreq, uint32_t NumFbankBins,
+             uint32_t MelLoFreq, uint32_t MelHiFreq,
+             uint32_t NumMfccFeatures, uint32_t FrameLen, bool UseHtkMethod,
+             MelNormalisation Normalisation, DctType Dct>
+    class ConstMelTables {
+        static_assert(FrameLen > 0 && NumFbankBins > 0, "Empty Mel tables");
+
+        static constexpr uint32_t ms_numMfccFeatures = Dct == DctType::none ? 0 : NumMfccFeatures;
+
+    public:
+        static constexpr MelTableParams ms_params{
+            SamplingFreq, NumFbankBins, MelLoFreq, MelHiFreq, ms_numMfccFeatures,
+            FrameLen, tables::NextPowerOf2(FrameLen), UseHtkMethod};
+
+    private:
+        using Data = tables::MelTableData<FrameLen, NumFbankBins,
+                                          tables::CountMelWeights(ms_params, Normalisation),
+                                          ms_numMfccFeatures ? ms_numMfccFeatures * NumFbankBins : 1>;
+
+        static constexpr Data ms_data = tables::MakeMelTables<Data>(ms_params, Normalisation, Dct);
+
+    public:
+        static constexpr MelTables ms_tables{
+            ms_params,
+            ms_data.m_window.m_data,
+            ms_data.m_weights.m_data,
+            ms_data.m_weightsStart.m_data,
+            ms_data.m_filterFirst.m_data,
+            ms_data.m_filterLast.m_data,
+            ms_numMfccFeatures ? ms_data.m_dct.m_data : nullptr};
+    };
+
+    template<uint32_t SamplingFreq, uint32_t NumFbankBins, uint32_t MelLoFreq, uint32_t MelHiFreq,
+             uint32_t NumMfccFeatures, uint32_t FrameLen, bool UseHtkMethod,
+             MelNormalisation Normalisation, DctType Dct>
+    constexpr MelTableParams ConstMelTables<SamplingFreq, NumFbankBins, MelLoFreq, MelHiFreq,
+        NumMfccFeatures, FrameLen, UseHtkMethod, Normalisation, Dct>::ms_params;
+
+    template<uint32_t SamplingFreq, uint32_t NumFbankBins, uint32_t MelLoFreq, uint32_t MelHiFreq,
+             uint32_t NumMfccFeatures, uint32_t FrameLen, bool UseHtkMethod,
+             MelNormalisation Normalisation, DctType Dct>
+    constexpr typename ConstMelTables<SamplingFreq, NumFbankBins, MelLoFreq, MelHiFreq,
+        NumMfccFeatures, FrameLen, UseHtkMethod, Normalisation, Dct>::Data
+    ConstMelTables<SamplingFreq, NumFbankBins, MelLoFreq, MelHiFreq,
+        NumMfccFeatures, FrameLen, UseHtkMethod, Normalisation, Dct>::ms_data;
+
+    template<uint32_t SamplingFreq, uint32_t NumFbankBins, uint32_t MelLoFreq, uint32_t MelHiFreq,
+             uint32_t NumMfccFeatures, uint32_t FrameLen, bool UseHtkMethod,
+             MelNormalisation Normalisation, DctType Dct>
+    constexpr MelTables ConstMelTables<SamplingFreq, NumFbankBins, MelLoFreq, MelHiFreq,
+        NumMfccFeatures, FrameLen, UseHtkMethod, Normalisation, Dct>::ms_tables;
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* DSP_TABLES_HPP */
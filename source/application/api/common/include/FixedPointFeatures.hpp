@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FIXED_POINT_FEATURES_HPP
+#define FIXED_POINT_FEATURES_HPP
+
+#include "PlatformMath.hpp"
+#include "AudioUtils.hpp"
+#include "DspTables.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /* How the log-Mel energies are derived from the spectrum. */
+    struct FixedPointFeatureParams {
+        bool    m_usePower{false};      /* Filter the power rather than the magnitude spectrum. */
+        float   m_logMultiplier{1.f};   /* 1 for natural logs, 10 * log10(e) for decibels. */
+        float   m_melFloor{FLT_MIN};    /* Smallest Mel energy, avoiding the log of zero. */
+        float   m_topDb{0.f};           /* Clamp to this far below the frame maximum, 0 for no clamp. */
+    };
+
+    /**
+     * @brief   Integer only MFCC or log-Mel spectrogram feature extraction.
+     *          The window, Mel filter bank and DCT of a floating point
+     *          extractor are quantised to q15 once, then each frame goes
+     *          through a q31 real FFT, integer filter bank sums, a table
+     *          based logarithm and an integer DCT, and is written out
+     *          quantised. Each frame is scaled up to use the full q31 range
+     *          before the FFT, and the scale is taken out again in the log
+     *          domain, so quiet audio keeps its precision.
+     *          Floating point is used only when setting up.
+     */
+    class FixedPointFeatures {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   tables   Window, Mel filter bank and DCT to quantise,
+         *                       log-Mel output if there is no DCT. The
+         *                       window has values in [0, 1].
+         * @param[in]   params   How the log-Mel energies are derived.
+         */
+        FixedPointFeatures(const MelTables& tables,
+                           const FixedPointFeatureParams& params);
+
+        FixedPointFeatures() = delete;
+
+        ~FixedPointFeatures() = default;
+
+        /**
+         * @brief       Sets the quantisation of the output features.
+         * @param[in]   quantScale    Quantisation scale.
+         * @param[in]   quantOffset   Quantisation offset.
+         * @param[in]   mean          Value subtracted from each feature before
+         *                            quantising, e.g. a training mean.
+         * @return      true if the scale can be represented, false otherwise.
+         **/
+        bool SetQuantisation(float quantScale, int quantOffset, float mean = 0.f);
+
+        /** @brief  Gets the number of features computed per frame. */
+        size_t NumFeatures() const;
+
+        /**
+         * @brief       Extracts the quantised features of one frame of audio.
+         * @param[in]   audioData     Audio samples, a shorter frame is padded
+         *                            with zeros.
+         * @param[out]  featuresOut   Output for NumFeatures() values.
+         * @return      true if successful, false otherwise.
+         **/
+        template<typename T>
+        bool Compute(Span<const int16_t> audioData, T* featuresOut)
+        {
+            if (!this->ComputeLogMel(audioData)) {
+                return false;
+            }
+
+            constexpr int32_t minVal = std::numeric_limits<T>::min();
+            constexpr int32_t maxVal = std::numeric_limits<T>::max();
+            for (size_t i = 0; i < this->NumFeatures(); ++i) {
+                const int32_t value = this->Quantise(this->Feature(i));
+                featuresOut[i] = static_cast<T>(std::min(std::max(value, minVal), maxVal));
+            }
+            return true;
+        }
+
+        /**
+         * @brief       Extracts the quantised features of one frame of audio
+         *              into a buffer owned by this object, so only the first
+         *              call for each type allocates.
+         * @param[in]   audioData   Audio samples.
+         * @return      Quantised features, empty on failure. The vector is
+         *              overwritten by the next call for the same type.
+         **/
+        template<typename T>
+        const std::vector<T>& ComputeQuant(Span<const int16_t> audioData)
+        {
+            std::vector<T>& features = this->QuantScratch(static_cast<T*>(nullptr));
+            features.resize(this->NumFeatures());
+            if (!this->Compute<T>(audioData, features.data())) {
+                features.clear();
+            }
+            return features;
+        }
+
+    private:
+        uint32_t                    m_frameLen;
+        uint32_t                    m_log2FftLen;
+        FixedPointFeatureParams     m_params;
+        std::vector<int16_t>        m_windowQ15;
+        std::vector<uint16_t>       m_weightsQ15;       /* All Mel bins' weights, back to back. */
+        std::vector<uint32_t>       m_weightsStart;     /* Index of each Mel bin's first weight, then the end. */
+        std::vector<uint32_t>       m_filterFirst;
+        std::vector<uint32_t>       m_filterLast;
+        std::vector<int16_t>        m_dctQ15;
+        uint32_t                    m_numFeatures;
+        int32_t                     m_weightSumBits{0}; /* Bits needed by the sum of any bin's weights. */
+        int32_t                     m_logWeightStepQ16{0};
+        int32_t                     m_logMultiplierQ16{0};
+        int32_t                     m_logFloorQ16{0};
+        int32_t                     m_topDbQ16{0};
+        float                       m_featureScale{1.f};  /* Real value of one unit of Feature(). */
+        int32_t                     m_quantMultiplier{0};
+        int32_t                     m_quantShift{0};
+        int32_t                     m_quantOffset{0};
+        int64_t                     m_featureMean{0};
+        std::vector<int32_t>        m_frame;
+        std::vector<int32_t>        m_fftOut;
+        std::vector<uint64_t>       m_spectrum;
+        std::vector<int32_t>        m_logMelQ16;
+        std::vector<int8_t>         m_quantS8;          /* ComputeQuant output, per type. */
+        std::vector<int16_t>        m_quantS16;
+        math::FftInstanceQ31        m_fftInstance;
+
+        /** @brief  Gets the ComputeQuant output buffer for a type. */
+        std::vector<int8_t>& QuantScratch(int8_t*) { return this->m_quantS8; }
+        std::vector<int16_t>& QuantScratch(int16_t*) { return this->m_quantS16; }
+
+        /**
+         * @brief       Computes the log-Mel energies of a frame in Q16.16.
+         * @param[in]   audioData   Audio samples.
+         * @return      true if successful, false otherwise.
+         **/
+        bool ComputeLogMel(Span<const int16_t> audioData);
+
+        /**
+         * @brief       Gets a feature of the last frame, in units of
+         *              m_featureScale, with the mean subtracted.
+         * @param[in]   index   Feature index.
+         * @return      Feature value.
+         **/
+        int64_t Feature(size_t index) const;
+
+        /**
+         * @brief       Quantises a feature value with the output multiplier.
+         * @param[in]   feature   Value returned by Feature().
+         * @return      Quantised value, before clamping.
+         **/
+        int32_t Quantise(int64_t feature) const;
+    };
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* FIXED_POINT_FEATURES_HPP */
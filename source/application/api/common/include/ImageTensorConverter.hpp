@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef IMAGE_TENSOR_CONVERTER_HPP
+#define IMAGE_TENSOR_CONVERTER_HPP
+
+#include "TensorFlowLiteMicro.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace image {
+
+    /** How an 8-bit pixel value maps to the model's input. */
+    enum class PixelScaling {
+        Raw,        /* Pixel value as is. */
+        Centred,    /* Pixel value - 128, as int8. */
+        Normalised  /* Pixel / 255, quantised with the tensor's parameters. */
+    };
+
+    /**
+     * @brief   Writes a uint8 RGB or grayscale image straight into an int8 or
+     *          uint8 input tensor in a single pass. The pixel mapping is
+     *          resolved into a 256-entry table when the converter is created,
+     *          and grayscale conversion uses integer weights, so there is no
+     *          floating point work per pixel.
+     */
+    class ImageToTensorConverter {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   tensor      Destination tensor, of type int8 or uint8.
+         * @param[in]   rgbToGray   Whether the source is RGB888 to be converted to
+         *                          one grayscale value per tensor element.
+         * @param[in]   scaling     Pixel value mapping.
+         **/
+        ImageToTensorConverter(TfLiteTensor* tensor, bool rgbToGray, PixelScaling scaling);
+
+        /**
+         * @brief       Populates the tensor from an image.
+         * @param[in]   src         Source pixels, RGB888 if converting to grayscale.
+         * @param[in]   numPixels   Number of tensor elements to fill, at most the tensor
+         *                          size. The source holds this many pixels.
+         * @return      true if successful, false otherwise.
+         **/
+        bool Convert(const uint8_t* src, size_t numPixels) const;
+
+        /**
+         * @brief       Gets the tensor byte a pixel value maps to.
+         * @param[in]   pixel   Pixel value.
+         * @return      Tensor value, as stored in memory.
+         **/
+        uint8_t MapPixel(uint8_t pixel) const;
+
+    private:
+        TfLiteTensor*   m_tensor;
+        bool            m_rgbToGray;
+        bool            m_identity{false};  /* Mapping is a plain copy. */
+        uint8_t         m_lut[256]{};       /* Pixel value to tensor byte. */
+    };
+
+} /* namespace image */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* IMAGE_TENSOR_CONVERTER_HPP */
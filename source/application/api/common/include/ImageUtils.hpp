@@ -101,6 +101,19 @@ namespace image {
      **/
     void ConvertImgToInt8(void* data, size_t kMaxImageSize);
 
+    /**
+     * @brief       Converts one RGB pixel to grayscale with the BT.601 weights
+     *              (0.299, 0.587, 0.114) in 16-bit fixed point.
+     * @param[in]   r   Red value.
+     * @param[in]   g   Green value.
+     * @param[in]   b   Blue value.
+     * @return      Grayscale value.
+     **/
+    inline uint8_t RgbToGray(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return static_cast<uint8_t>((19595u * r + 38470u * g + 7471u * b) >> 16);
+    }
+
     /**
      * @brief       Converts RGB image to grayscale.
      * @param[in]   srcPtr   Pointer to RGB source image.
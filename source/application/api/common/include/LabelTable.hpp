@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LABEL_TABLE_HPP
+#define LABEL_TABLE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Non-owning view of a label, a C++14 stand-in for
+     *          std::string_view. Labels are string literals in the tables
+     *          generated from the label files, so they live in flash and
+     *          their views are null terminated too.
+     */
+    class LabelView {
+    public:
+        constexpr LabelView() = default;
+
+        /** @brief  View of a string literal. */
+        template<size_t N>
+        constexpr LabelView(const char (&str)[N]) : m_data{str}, m_size{N - 1} {}
+
+        /**
+         * @brief     Creates a view of the given characters.
+         * @param[in] data   Pointer to the first character, null terminated
+         *                   after size characters.
+         * @param[in] size   Number of characters.
+         */
+        constexpr LabelView(const char* data, size_t size) : m_data{data}, m_size{size} {}
+
+        constexpr const char* data() const { return m_data; }
+        constexpr size_t size() const { return m_size; }
+        constexpr bool empty() const { return m_size == 0; }
+
+        /** @brief  Gets the label as a C string, for printing. */
+        constexpr const char* c_str() const { return m_data; }
+
+        /** @brief  Copies the label into a string. */
+        std::string ToString() const { return std::string(m_data, m_size); }
+
+        bool operator==(const LabelView& other) const
+        {
+            return m_size == other.m_size && std::memcmp(m_data, other.m_data, m_size) == 0;
+        }
+
+        bool operator==(const char* str) const
+        {
+            return std::strncmp(m_data, str, m_size) == 0 && str[m_size] == '\0';
+        }
+
+        template<typename T>
+        bool operator!=(const T& other) const { return !(*this == other); }
+
+    private:
+        const char* m_data = "";
+        size_t m_size = 0;
+    };
+
+    /**
+     * @brief   Labels of a model's outputs indexed by class, a view of a
+     *          generated table in flash.
+     */
+    class LabelTable {
+    public:
+        constexpr LabelTable() = default;
+
+        /**
+         * @brief     Creates a view of the given labels.
+         * @param[in] labels   Pointer to the first label.
+         * @param[in] size     Number of labels.
+         */
+        constexpr LabelTable(const LabelView* labels, size_t size) : m_labels{labels}, m_size{size} {}
+
+        constexpr size_t size() const { return m_size; }
+        constexpr bool empty() const { return m_size == 0; }
+        constexpr const LabelView* begin() const { return m_labels; }
+        constexpr const LabelView* end() const { return m_labels + m_size; }
+        constexpr const LabelView& operator[](size_t i) const { return m_labels[i]; }
+
+    private:
+        const LabelView* m_labels = nullptr;
+        size_t m_size = 0;
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* LABEL_TABLE_HPP */
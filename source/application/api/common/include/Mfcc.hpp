@@ -30,6 +30,9 @@
 #define MFCC_HPP
 
 #include "PlatformMath.hpp"
+#include "AudioUtils.hpp"
+#include "FixedPointFeatures.hpp"
+#include "DspTables.hpp"
 
 #include <vector>
 #include <cstdint>
@@ -89,26 +92,58 @@ namespace audio {
         /**
         * @brief        Extract MFCC  features for one single small frame of
         *               audio data e.g. 640 samples.
-        * @param[in]    audioData   Vector of audio samples to calculate
-        *                           features for.
+        * @param[in]    audioData   View of the audio samples to calculate
+        *                           features for, e.g. a sliding window. A
+        *                           shorter frame is padded with zeros.
         * @return       Vector of extracted MFCC features.
         **/
-        std::vector<float> MfccCompute(const std::vector<int16_t>& audioData);
+        std::vector<float> MfccCompute(Span<const int16_t> audioData);
+
+        /** @brief  As above, for a vector of audio samples. */
+        std::vector<float> MfccCompute(const std::vector<int16_t>& audioData)
+        {
+            return this->MfccCompute(Span<const int16_t>(audioData.data(), audioData.size()));
+        }
+
+        /**
+        * @brief        Extract MFCC features for several consecutive frames of
+        *               audio data, e.g. the windows of a WindowView. The FFT
+        *               and Mel filter bank run frame by frame, while the DCT
+        *               of up to ms_batchFrames frames is taken at once as a
+        *               single matrix multiplication.
+        * @param[in]    frames      Batch of audio frames. Shorter frames are
+        *                           padded with zeros.
+        * @param[out]   mfccOut     Output with m_numMfccFeatures rows of
+        *                           outStride elements; the features of frame
+        *                           k are written to column k.
+        * @param[in]    outStride   Distance between output rows in elements,
+        *                           at least frames.Count().
+        * @return       true if successful, false otherwise.
+        **/
+        bool MfccComputeBatch(const WindowBatch<const int16_t>& frames,
+                              float* mfccOut, size_t outStride);
 
         /** @brief  Initialise. */
         void Init();
 
+        /**
+        * @brief        Creates an integer only version of this MFCC, with its
+        *               window, Mel filter bank and DCT quantised to q15.
+        * @return       Fixed point feature extractor.
+        **/
+        FixedPointFeatures MakeFixedPoint();
+
        /**
         * @brief        Extract MFCC features and quantise for one single small
         *               frame of audio data e.g. 640 samples.
-        * @param[in]    audioData     Vector of audio samples to calculate
+        * @param[in]    audioData     View of the audio samples to calculate
         *                             features for.
         * @param[in]    quantScale    Quantisation scale.
         * @param[in]    quantOffset   Quantisation offset.
         * @return       Vector of extracted quantised MFCC features.
         **/
         template<typename T>
-        std::vector<T> MfccComputeQuant(const std::vector<int16_t>& audioData,
+        std::vector<T> MfccComputeQuant(Span<const int16_t> audioData,
                                         const float quantScale,
                                         const int quantOffset)
         {
@@ -122,7 +157,7 @@ namespace audio {
             /* Take DCT. Uses matrix mul. */
             for (size_t i = 0, j = 0; i < mfccOut.size(); ++i, j += numFbankBins) {
 
-                float sum = math::MathUtils::DotProductF32(this->m_dctMatrix.data() + j, this->m_melEnergies.data(), numFbankBins);
+                float sum = math::MathUtils::DotProductF32(this->Tables().m_dct + j, this->m_melEnergies.data(), numFbankBins);
 
                 /* Quantize to T. */
                 sum = std::round((sum / quantScale) + quantOffset);
@@ -132,12 +167,25 @@ namespace audio {
             return mfccOut;
         }
 
+        /** @brief  As above, for a vector of audio samples. */
+        template<typename T>
+        std::vector<T> MfccComputeQuant(const std::vector<int16_t>& audioData,
+                                        const float quantScale,
+                                        const int quantOffset)
+        {
+            return this->MfccComputeQuant<T>(Span<const int16_t>(audioData.data(), audioData.size()),
+                                             quantScale, quantOffset);
+        }
+
         /* Constants */
         static constexpr float ms_logStep = /*logf(6.4)*/ 1.8562979903656 / 27.0;
         static constexpr float ms_freqStep = 200.0 / 3;
         static constexpr float ms_minLogHz = 1000.0;
         static constexpr float ms_minLogMel = ms_minLogHz / ms_freqStep;
 
+        /* Frames per DCT matrix multiplication in MfccComputeBatch. */
+        static constexpr size_t ms_batchFrames = 16;
+
     protected:
         /**
          * @brief       Project input frequency to Mel Scale.
@@ -164,24 +212,19 @@ namespace audio {
          * @brief       Populates MEL energies after applying the MEL filter
          *              bank weights and adding them up to be placed into
          *              bins, according to the filter bank's first and last
-         *              indices (pre-computed for each filter bank element
-         *              by CreateMelFilterBank function).
-         * @param[in]   fftVec                  Vector populated with FFT magnitudes.
-         * @param[in]   melFilterBank           2D Vector with filter bank weights.
-         * @param[in]   filterBankFilterFirst   Vector containing the first indices of filter bank
-         *                                      to be used for each bin.
-         * @param[in]   filterBankFilterLast    Vector containing the last indices of filter bank
-         *                                      to be used for each bin.
-         * @param[out]  melEnergies             Pre-allocated vector of MEL energies to be
-         *                                      populated.
+         *              indices.
+         * @param[in]   fftVec        Vector populated with FFT magnitudes.
+         * @param[in]   tables        Tables holding the filter bank weights
+         *                            and the first and last FFT bin of each
+         *                            Mel bin.
+         * @param[out]  melEnergies   Pre-allocated vector of MEL energies to be
+         *                            populated.
          * @return      true if successful, false otherwise.
          */
         virtual bool ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&               filterBankFilterFirst,
-            std::vector<uint32_t>&               filterBankFilterLast,
-            std::vector<float>&                 melEnergies);
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies);
 
         /**
          * @brief           Converts the Mel energies for logarithmic scale.
@@ -217,21 +260,46 @@ namespace audio {
                         const float&   rightMel,
                         bool     useHTKMethod);
 
+        /**
+         * @brief       Describes ApplyMelFilterBank and ConvertToLogarithmicScale
+         *              to the fixed point version. Classes overriding those should
+         *              override this as well.
+         * @return      Fixed point feature parameters.
+         */
+        virtual FixedPointFeatureParams GetFixedPointParams() const;
+
+        /**
+         * @brief       Gets tables computed at compile time, see ConstMelTables.
+         *              They are used when computed for this instance's
+         *              parameters, and in place of CreateDCTMatrix and
+         *              GetMelFilterBankNormaliser, so must match those.
+         *              Otherwise the tables are computed at run time.
+         * @return      Pointer to the tables, or nullptr if there are none.
+         */
+        virtual const MelTables* GetPrecomputedTables() const;
+
     private:
         MfccParams                      m_params;
         std::vector<float>              m_frame;
         std::vector<float>              m_buffer;
         std::vector<float>              m_melEnergies;
-        std::vector<float>              m_windowFunc;
-        std::vector<std::vector<float>> m_melFilterBank;
+        const MelTables*                m_precomputedTables{nullptr};
+        std::vector<float>              m_windowFunc;   /* Run time tables, when not precomputed */
+        std::vector<float>              m_melWeights;
+        std::vector<uint32_t>           m_melWeightsStart;
         std::vector<float>              m_dctMatrix;
+        std::vector<float>              m_melBatch;     /* Mel energies, one column per frame */
+        std::vector<float>              m_mfccBatch;    /* DCT of m_melBatch */
         std::vector<uint32_t>           m_filterBankFilterFirst;
         std::vector<uint32_t>           m_filterBankFilterLast;
         bool                            m_filterBankInitialised;
         arm::app::math::FftInstance     m_fftInstance;
+        std::vector<math::float16>      m_frameF16;     /* Only used with FEATURE_EXTRACTION_F16 */
+        std::vector<math::float16>      m_bufferF16;
+        arm::app::math::FftInstanceF16  m_fftInstanceF16;
 
         /**
-         * @brief       Initialises the filter banks and the DCT matrix. **/
+         * @brief       Initialises the window, filter banks and the DCT matrix. **/
         void InitMelFilterBank();
 
         /**
@@ -242,17 +310,23 @@ namespace audio {
         bool IsMelFilterBankInited() const;
 
         /**
-         * @brief       Create mel filter banks for MFCC calculation.
-         * @return      2D vector of floats.
+         * @brief       Create mel filter banks for MFCC calculation, into
+         *              m_melWeights and the indices alongside.
          **/
-        std::vector<std::vector<float>> CreateMelFilterBank();
+        void CreateMelFilterBank();
+
+        /** @brief  Gets the parameters the tables are computed for. */
+        MelTableParams TableParams() const;
+
+        /** @brief  Gets the tables in use, precomputed or not. */
+        MelTables Tables() const;
 
         /**
          * @brief       Computes and populates internal memeber buffers used
          *              in MFCC feature calculation
-         * @param[in]   audioData   1D vector of 16-bit audio data.
+         * @param[in]   audioData   View of the 16-bit audio data.
          */
-        void MfccComputePreFeature(const std::vector<int16_t>& audioData);
+        void MfccComputePreFeature(Span<const int16_t> audioData);
 
         /** @brief       Computes the magnitude from an interleaved complex array. */
         void ConvertToPowerSpectrum();
@@ -17,9 +17,12 @@
 #ifndef MODEL_HPP
 #define MODEL_HPP
 
+#include "StateCopyPlan.hpp"
 #include "TensorFlowLiteMicro.hpp"
 
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace arm {
 namespace app {
@@ -62,7 +65,19 @@ namespace app {
         /** @brief  Logs the interpreter information to stdout. */
         void LogInterpreterInfo();
 
+        /**
+         * @brief       Selects the fast boot mode, to be set before Init. Init
+         *              then neither clears the input and output tensors nor logs
+         *              the tensors and operators, which ShowModelInfoHandler
+         *              still lists on demand.
+         * @param[in]   fastBoot    Whether to boot fast.
+         **/
+        void SetFastBoot(bool fastBoot);
+
         /** @brief      Initialise the model class object.
+         *              If the object is already initialised with the same model
+         *              and arena, the interpreter is reset instead, keeping its
+         *              allocations.
          *  @param[in]  tensorArenaAddress  Pointer to the tensor arena buffer.
          *  @param[in]  tensorArenaAddress  Size of the tensor arena buffer in bytes.
          *  @param[in]  nnModelAddr         Pointer to the model.
@@ -97,6 +112,63 @@ namespace app {
         /** @brief  Runs the inference (invokes the interpreter). */
         virtual bool RunInference();
 
+        /**
+         * @brief   Resets the interpreter to its state after Init, clearing
+         *          variable tensors and operator state, without allocating
+         *          again. Input and output tensors are left as they are.
+         * @return  true if successful, false otherwise.
+         **/
+        bool Reset();
+
+        /**
+         * @brief   Runs one inference on inputs at their zero point and resets
+         *          the interpreter, to prime caches and the NPU command stream
+         *          before the first real inference.
+         * @return  true if successful, false otherwise.
+         **/
+        bool WarmUp();
+
+        /**
+         * @brief   Sets the state inputs given by GetStateTensorMap to zero,
+         *          i.e. to their quantisation zero point. Call before
+         *          processing a new sequence of logically related data.
+         **/
+        void ResetStates();
+
+        /**
+         * @brief   Copies the state outputs of the last inference to their
+         *          state inputs, for the next one. TensorFlow Lite Micro may
+         *          place inputs and outputs in the same arena memory, so the
+         *          copy order is planned in Init such that no output is
+         *          overwritten before it is read. Only when the states depend
+         *          on each other in a cycle are they staged through a buffer
+         *          allocated in Init. There is no allocation here.
+         * @return  true if successful, false otherwise.
+         **/
+        bool CarryOverStates();
+
+        /** @brief   Gets the total size in bytes of the state tensors. */
+        size_t GetStateBytes();
+
+        /**
+         * @brief       Saves the state outputs of the last inference, in
+         *              GetStateTensorMap order, so several streams can take
+         *              turns on one model.
+         * @param[out]  dst     Buffer of GetStateBytes() bytes.
+         * @param[in]   size    Size of the buffer in bytes.
+         * @return      true if successful, false otherwise.
+         **/
+        bool SaveStates(uint8_t* dst, size_t size);
+
+        /**
+         * @brief       Loads states saved by SaveStates into the state inputs,
+         *              for the next inference.
+         * @param[in]   src     Buffer of GetStateBytes() bytes.
+         * @param[in]   size    Size of the buffer in bytes.
+         * @return      true if successful, false otherwise.
+         **/
+        bool LoadStates(const uint8_t* src, size_t size);
+
         /** @brief   Model information handler common to all models.
          *  @return  true or false based on execution success.
          **/
@@ -132,17 +204,35 @@ namespace app {
         /** @brief   Gets the total size of tensor arena available for use. */
         size_t GetActivationBufferSize();
 
+        /**
+         * @brief       Declares the recurrent state of a stateful model, as
+         *              pairs of output and input tensor indices: the output
+         *              of an inference is the input of the next one. By
+         *              default, the model has no state.
+         * @return      Output to input tensor index pairs.
+         **/
+        virtual const std::vector<std::pair<size_t, size_t>>& GetStateTensorMap();
+
     private:
+        /**
+         * @brief   Plans the state copies from GetStateTensorMap.
+         * @return  true if successful, false if a state pair is invalid.
+         **/
+        bool PlanStateCopies();
+
         const tflite::Model* m_pModel{nullptr};            /* Tflite model pointer. */
         tflite::MicroInterpreter* m_pInterpreter{nullptr}; /* Tflite interpreter. */
         tflite::MicroAllocator* m_pAllocator{nullptr};     /* Tflite micro allocator. */
         bool m_inited{false};                              /* Indicates whether this object has been initialised. */
+        bool m_fastBoot{false};                            /* Skips clearing and logging in Init. */
+        const uint8_t* m_arenaAddr{nullptr};               /* Tensor arena address */
         const uint8_t* m_modelAddr{nullptr};               /* Model address */
         uint32_t m_modelSize{0};                           /* Model size */
 
         std::vector<TfLiteTensor*> m_input{};              /* Model's input tensor pointers. */
         std::vector<TfLiteTensor*> m_output{};             /* Model's output tensor pointers. */
         TfLiteType m_type{kTfLiteNoType};                  /* Model's data type. */
+        StateCopyPlan m_stateCopies{};                     /* State output to input copies. */
     };
 
 } /* namespace app */
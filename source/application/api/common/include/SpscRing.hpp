@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace arm {
+namespace app {
+
+    /** Alignment keeping producer and consumer owned fields on separate cache lines. */
+    constexpr size_t SpscRingLineSize = 32;
+
+    /**
+     * @brief   Lock-free single-producer/single-consumer ring buffer of fixed-size
+     *          items. It holds no pointers of its own and does no cache
+     *          maintenance, so a ring shared between two cores must live in
+     *          memory both of them map non-cacheable. On Ensemble that is the
+     *          block of SRAM0 at IPC_SHARED_BASE, which MPU_Load_Regions maps
+     *          with a non-cacheable attribute on both the HE and HP cores.
+     *
+     *          Only one thread or core may push and only one may pop. Items are
+     *          copied in and out, so large payloads such as feature tensors or
+     *          frames are better passed as descriptors to buffers the sender
+     *          doesn't reuse until the receiver is done with them.
+     *
+     *          The consumer can sleep when the ring is empty: it calls
+     *          ArmDoorbell() and, if that returns true, waits for a notification.
+     *          The producer only notifies (see RingProducer) when the consumer
+     *          has armed the doorbell, so a busy consumer costs no interrupts.
+     *
+     *          Example - HE sending results to HP on doorbell channel 0:
+     *
+     *              using ResultRing = SpscRing<KwsMessage, 16>;
+     *              static_assert(sizeof(ResultRing) <= IPC_SHARED_SIZE, "");
+     *
+     *              // HE, before ringing any doorbell:
+     *              auto* ring = new (reinterpret_cast<void*>(IPC_SHARED_BASE)) ResultRing();
+     *              RingProducer<KwsMessage, 16> tx(*ring, []() { ipc_ring_doorbell(0); });
+     *
+     *              // HP, after the first doorbell:
+     *              auto* ring = reinterpret_cast<ResultRing*>(IPC_SHARED_BASE);
+     *
+     * @tparam  T   Item type; must be trivially copyable.
+     * @tparam  N   Number of slots; must be a power of two.
+     */
+    template<typename T, uint32_t N>
+    class SpscRing {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "Ring size must be a power of two");
+        static_assert(std::is_trivially_copyable<T>::value, "Ring items must be trivially copyable");
+
+    public:
+        SpscRing()
+        {
+            this->Reset();
+        }
+
+        /**
+         * @brief   Empties the ring and clears the counters. Must not be called
+         *          while either side is using the ring.
+         **/
+        void Reset()
+        {
+            this->m_head.store(0, std::memory_order_relaxed);
+            this->m_dropped = 0;
+            this->m_tail.store(0, std::memory_order_relaxed);
+            this->m_waiting.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief       Copies an item into the ring. Producer only.
+         * @param[in]   item   Item to add.
+         * @return      true if added, false if the ring was full (the item is
+         *              dropped and counted).
+         **/
+        bool TryPush(const T& item)
+        {
+            const uint32_t head = this->m_head.load(std::memory_order_relaxed);
+            const uint32_t tail = this->m_tail.load(std::memory_order_acquire);
+            if (head - tail >= N) {
+                ++this->m_dropped;
+                return false;
+            }
+
+            this->m_items[head & (N - 1)] = item;
+            this->m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief       Copies the oldest item out of the ring. Consumer only.
+         * @param[out]  item   Destination for the item.
+         * @return      true if an item was read, false if the ring was empty.
+         **/
+        bool TryPop(T& item)
+        {
+            const uint32_t tail = this->m_tail.load(std::memory_order_relaxed);
+            const uint32_t head = this->m_head.load(std::memory_order_acquire);
+            if (head == tail) {
+                return false;
+            }
+
+            item = this->m_items[tail & (N - 1)];
+            this->m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief   Tells the producer the consumer is about to sleep. Consumer only.
+         * @return  true if the ring is still empty and the consumer may wait for
+         *          the doorbell, false if items arrived meanwhile and should be
+         *          popped first.
+         **/
+        bool ArmDoorbell()
+        {
+            this->m_waiting.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!this->IsEmpty()) {
+                this->m_waiting.store(0, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief   Checks, and clears, whether the consumer is waiting for a
+         *          notification. Producer only, after a successful push.
+         * @return  true if the doorbell should be rung.
+         **/
+        bool ConsumeDoorbellRequest()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return this->m_waiting.exchange(0, std::memory_order_acq_rel) != 0;
+        }
+
+        /** @brief  Gets the number of items currently queued. */
+        uint32_t Size() const
+        {
+            return this->m_head.load(std::memory_order_acquire) -
+                   this->m_tail.load(std::memory_order_acquire);
+        }
+
+        /** @brief  Checks whether the ring is empty. */
+        bool IsEmpty() const
+        {
+            return this->Size() == 0;
+        }
+
+        /** @brief  Gets the number of slots. */
+        static constexpr uint32_t Capacity()
+        {
+            return N;
+        }
+
+        /** @brief  Gets the number of items dropped because the ring was full. */
+        uint32_t GetDroppedCount() const
+        {
+            return this->m_dropped;
+        }
+
+    private:
+        /* Producer owned. */
+        alignas(SpscRingLineSize) std::atomic<uint32_t> m_head;
+        uint32_t m_dropped;
+
+        /* Consumer owned. */
+        alignas(SpscRingLineSize) std::atomic<uint32_t> m_tail;
+        std::atomic<uint32_t> m_waiting;
+
+        alignas(SpscRingLineSize) T m_items[N];
+    };
+
+    /**
+     * @brief   Producer end of a ring, ringing a doorbell (for example an MHU
+     *          message to the other core, see ipc_ring_doorbell) whenever the
+     *          consumer is waiting for data.
+     */
+    template<typename T, uint32_t N>
+    class RingProducer {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   ring       Ring to push to.
+         * @param[in]   doorbell   Called to wake up the consumer.
+         **/
+        RingProducer(SpscRing<T, N>& ring, std::function<void()> doorbell)
+        :   m_ring{ring},
+            m_doorbell{std::move(doorbell)}
+        {}
+
+        /**
+         * @brief       Pushes an item and notifies the consumer if needed.
+         * @param[in]   item   Item to send.
+         * @return      true if queued, false if the ring was full.
+         **/
+        bool Send(const T& item)
+        {
+            if (!this->m_ring.TryPush(item)) {
+                return false;
+            }
+
+            if (this->m_ring.ConsumeDoorbellRequest()) {
+                ++this->m_doorbellCount;
+                if (this->m_doorbell) {
+                    this->m_doorbell();
+                }
+            }
+            return true;
+        }
+
+        /** @brief  Gets how many times the doorbell has been rung. */
+        uint32_t GetDoorbellCount() const
+        {
+            return this->m_doorbellCount;
+        }
+
+    private:
+        SpscRing<T, N>&         m_ring;
+        std::function<void()>   m_doorbell;
+        uint32_t                m_doorbellCount{0};
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* SPSC_RING_HPP */
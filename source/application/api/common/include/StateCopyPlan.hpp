@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STATE_COPY_PLAN_HPP
+#define STATE_COPY_PLAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm {
+namespace app {
+
+    /** One state output to input copy. */
+    struct StateCopy {
+        const uint8_t* m_src;
+        uint8_t* m_dst;
+        size_t m_bytes;
+    };
+
+    /**
+     * @brief   Carries the states of a stateful model from its outputs to
+     *          its inputs between inferences. TensorFlow Lite Micro may place
+     *          inputs and outputs in the same arena memory, so the copies are
+     *          ordered up front such that none overwrites an output still to
+     *          be read. Only copies that depend on each other in a cycle are
+     *          staged, through a buffer allocated when planning.
+     */
+    class StateCopyPlan {
+    public:
+        /**
+         * @brief       Plans the copies, replacing any previous plan.
+         * @param[in]   copies   Copies to carry out, in any order.
+         **/
+        void Plan(std::vector<StateCopy> copies);
+
+        /** @brief  Carries out the planned copies, without allocating. */
+        void Apply();
+
+        /** @brief  Gets the number of bytes staged by each Apply(). */
+        size_t GetStagedBytes() const;
+
+    private:
+        std::vector<StateCopy> m_copies{};          /* Direct copies, in a safe order. */
+        std::vector<StateCopy> m_stagedCopies{};    /* Copies that can't be ordered. */
+        std::vector<uint8_t> m_staging{};           /* Staging buffer for those. */
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* STATE_COPY_PLAN_HPP */
@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef VOICE_ACTIVITY_DETECTOR_HPP
+#define VOICE_ACTIVITY_DETECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /**
+     * @brief   Base class for voice activity detectors. Use cases can run a detector
+     *          over each new block of audio and skip feature extraction and inference
+     *          when it reports no activity.
+     */
+    class VoiceActivityDetector {
+    public:
+        virtual ~VoiceActivityDetector() = default;
+
+        /**
+         * @brief       Processes a new block of audio.
+         * @param[in]   samples      Pointer to the audio samples.
+         * @param[in]   numSamples   Number of samples in the block.
+         * @param[in]   gain         Gain already applied to the samples, so that levels
+         *                           can be judged on the original input.
+         * @return      true if the block should be treated as containing voice.
+         **/
+        virtual bool IsVoiceActive(const int16_t* samples, size_t numSamples, float gain = 1.f) = 0;
+
+        /** @brief  Resets any state kept between blocks. */
+        virtual void Reset() = 0;
+    };
+
+    /**
+     * @brief   Voice activity detector based on block energy and zero-crossing rate.
+     *
+     *          A block is active when its energy is a given ratio above a tracked
+     *          noise floor (and above an absolute minimum), and its zero-crossing
+     *          rate is below a maximum that rejects broadband noise. Once active,
+     *          the detector stays active for a number of hangover blocks so that
+     *          the tail of a word is still passed on.
+     */
+    class EnergyVad : public VoiceActivityDetector {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   thresholdDb     Level above the noise floor (in dB) needed to trigger.
+         * @param[in]   minLevelDbfs    Absolute level (in dBFS) below which blocks are always silent.
+         * @param[in]   hangoverBlocks  Number of blocks to stay active for after activity stops.
+         * @param[in]   maxZeroCrossingRate  Maximum fraction of sign changes per sample for
+         *                                   a block to be considered voice.
+         **/
+        explicit EnergyVad(float thresholdDb = 9.f, float minLevelDbfs = -70.f,
+                           uint32_t hangoverBlocks = 2, float maxZeroCrossingRate = 0.5f);
+
+        bool IsVoiceActive(const int16_t* samples, size_t numSamples, float gain = 1.f) override;
+
+        void Reset() override;
+
+        /** @brief  Gets the level of the last processed block in dBFS. */
+        float GetLastLevelDbfs() const;
+
+        /** @brief  Gets the current noise floor estimate in dBFS. */
+        float GetNoiseFloorDbfs() const;
+
+        /** @brief  Gets the zero-crossing rate of the last processed block. */
+        float GetLastZeroCrossingRate() const;
+
+    private:
+        float       m_thresholdRatio;       /* Linear power ratio above the noise floor. */
+        float       m_minPower;             /* Linear minimum power, relative to full scale. */
+        uint32_t    m_hangoverBlocks;       /* Blocks to stay active for after activity. */
+        float       m_maxZcr;               /* Maximum zero-crossing rate for voice. */
+        float       m_noiseFloor{0.f};      /* Tracked noise power, relative to full scale. */
+        float       m_lastPower{0.f};       /* Power of the last block. */
+        float       m_lastZcr{0.f};         /* Zero-crossing rate of the last block. */
+        uint32_t    m_hangoverLeft{0};      /* Remaining hangover blocks. */
+        bool        m_floorValid{false};    /* Whether the noise floor has been seeded. */
+    };
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* VOICE_ACTIVITY_DETECTOR_HPP */
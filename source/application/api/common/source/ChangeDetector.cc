@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ChangeDetector.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#include <arm_mve.h>
+#elif defined(__ARM_FEATURE_SIMD32) && (__ARM_FEATURE_SIMD32 == 1)
+#include <arm_acle.h>
+#endif
+
+namespace arm {
+namespace app {
+namespace image {
+
+    ChangeDetector::ChangeDetector(const uint32_t cols, const uint32_t rows, const uint32_t channels,
+                                   const ChangeDetectorParams& params)
+    :   m_params{params},
+        m_cols{cols},
+        m_channels{channels}
+    {
+        this->m_params.subsample = std::max<uint32_t>(this->m_params.subsample, 1);
+        this->m_params.blockSize = std::max<uint32_t>(this->m_params.blockSize, 1);
+        this->m_thumbCols = (cols + this->m_params.subsample - 1) / this->m_params.subsample;
+        this->m_thumbRows = (rows + this->m_params.subsample - 1) / this->m_params.subsample;
+        this->m_reference.resize(this->m_thumbCols * this->m_thumbRows);
+        this->m_current.resize(this->m_thumbCols * this->m_thumbRows);
+    }
+
+    bool ChangeDetector::HasChanged(const uint8_t* image)
+    {
+        this->MakeThumbnail(image, this->m_current.data());
+
+        bool changed = true;
+        if (this->m_hasReference) {
+            this->m_lastChangedBlocks = this->CountChangedBlocks();
+            const bool refreshDue = this->m_params.refreshInterval != 0 &&
+                                    this->m_framesSinceRefresh + 1 >= this->m_params.refreshInterval;
+            changed = refreshDue || this->m_lastChangedBlocks >= this->m_params.minChangedBlocks;
+        }
+
+        if (!changed) {
+            ++this->m_framesSinceRefresh;
+            ++this->m_skipped;
+            return false;
+        }
+
+        this->m_reference.swap(this->m_current);
+        this->m_hasReference = true;
+        this->m_framesSinceRefresh = 0;
+        ++this->m_executed;
+        return true;
+    }
+
+    void ChangeDetector::Reset()
+    {
+        this->m_hasReference = false;
+        this->m_framesSinceRefresh = 0;
+        this->m_lastChangedBlocks = 0;
+        this->m_executed = 0;
+        this->m_skipped = 0;
+    }
+
+    uint32_t ChangeDetector::GetExecutedCount() const
+    {
+        return this->m_executed;
+    }
+
+    uint32_t ChangeDetector::GetSkippedCount() const
+    {
+        return this->m_skipped;
+    }
+
+    uint32_t ChangeDetector::GetLastChangedBlocks() const
+    {
+        return this->m_lastChangedBlocks;
+    }
+
+    uint32_t ChangeDetector::SumAbsDiffU8(const uint8_t* srcA, const uint8_t* srcB, const uint32_t len)
+    {
+        uint32_t sum = 0;
+        uint32_t i = 0;
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+        /* Tail predicated loop, 16 bytes per iteration. */
+        for (; i < len; i += 16) {
+            const mve_pred16_t p = vctp8q(len - i);
+            const uint8x16_t a = vld1q_z_u8(srcA + i, p);
+            const uint8x16_t b = vld1q_z_u8(srcB + i, p);
+            sum = vabavq_p_u8(sum, a, b, p);
+        }
+#elif defined(__ARM_FEATURE_SIMD32) && (__ARM_FEATURE_SIMD32 == 1)
+        for (; i + 4 <= len; i += 4) {
+            uint32_t a;
+            uint32_t b;
+            std::memcpy(&a, srcA + i, sizeof(a));
+            std::memcpy(&b, srcB + i, sizeof(b));
+            sum = __usada8(a, b, sum);
+        }
+#endif /* __ARM_FEATURE_MVE */
+
+        for (; i < len; ++i) {
+            sum += srcA[i] > srcB[i] ? srcA[i] - srcB[i] : srcB[i] - srcA[i];
+        }
+        return sum;
+    }
+
+    void ChangeDetector::MakeThumbnail(const uint8_t* image, uint8_t* thumbnail) const
+    {
+        const uint32_t step = this->m_params.subsample;
+        const uint32_t rowStride = this->m_cols * this->m_channels;
+        const uint32_t pixelStride = step * this->m_channels;
+
+        for (uint32_t ty = 0; ty < this->m_thumbRows; ++ty) {
+            const uint8_t* src = image + ty * step * rowStride;
+            for (uint32_t tx = 0; tx < this->m_thumbCols; ++tx, src += pixelStride) {
+                if (this->m_channels >= 3) {
+                    /* Cheap luma approximation, (R + 2G + B) / 4. */
+                    *thumbnail++ = static_cast<uint8_t>((src[0] + 2 * src[1] + src[2]) >> 2);
+                } else {
+                    *thumbnail++ = src[0];
+                }
+            }
+        }
+    }
+
+    uint32_t ChangeDetector::CountChangedBlocks() const
+    {
+        const uint32_t block = this->m_params.blockSize;
+        uint32_t changedBlocks = 0;
+
+        for (uint32_t by = 0; by < this->m_thumbRows; by += block) {
+            const uint32_t blockRows = std::min(block, this->m_thumbRows - by);
+            for (uint32_t bx = 0; bx < this->m_thumbCols; bx += block) {
+                const uint32_t blockCols = std::min(block, this->m_thumbCols - bx);
+
+                uint32_t sad = 0;
+                for (uint32_t y = by; y < by + blockRows; ++y) {
+                    const uint32_t offset = y * this->m_thumbCols + bx;
+                    sad += SumAbsDiffU8(&this->m_current[offset], &this->m_reference[offset], blockCols);
+                }
+
+                if (sad > this->m_params.blockThreshold * blockRows * blockCols) {
+                    ++changedBlocks;
+                }
+            }
+        }
+        return changedBlocks;
+    }
+
+} /* namespace image */
+} /* namespace app */
+} /* namespace arm */
@@ -32,7 +32,7 @@ namespace app {
 
     void Classifier::SetVectorResults(std::set<std::pair<float, uint32_t>>& topNSet,
             std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels)
+            const LabelTable& labels)
     {
         /* Reset the iterator to the largest element - use reverse iterator. */
 
@@ -46,7 +46,7 @@ namespace app {
 
     bool Classifier::GetTopNResults(const std::vector<float>& tensor,
             std::vector<ClassificationResult>& vecResults,
-            uint32_t topNCount, const std::vector <std::string>& labels)
+            uint32_t topNCount, const LabelTable& labels)
     {
         std::set<std::pair<float , uint32_t>> sortedSet;
 
@@ -78,7 +78,7 @@ namespace app {
     }
 
     bool Classifier::GetClassificationResults(TfLiteTensor* outputTensor,
-            std::vector<ClassificationResult>& vecResults, const std::vector <std::string>& labels,
+            std::vector<ClassificationResult>& vecResults, const LabelTable& labels,
             uint32_t topNCount, bool useSoftmax)
     {
         if (outputTensor == nullptr) {
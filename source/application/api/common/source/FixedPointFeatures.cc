@@ -0,0 +1,253 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "FixedPointFeatures.hpp"
+#include "log_macros.h"
+
+#include <cmath>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    static constexpr int64_t ms_ln2Q16 = 45426;    /* ln(2) * 2^16 */
+
+    /** @brief  Number of bits needed to represent x. */
+    static int32_t BitLength(uint64_t x)
+    {
+        int32_t bits = 0;
+        while (x) {
+            ++bits;
+            x >>= 1;
+        }
+        return bits;
+    }
+
+    static int32_t ToQ16(const float value)
+    {
+        return static_cast<int32_t>(std::round(value * 65536.f));
+    }
+
+    FixedPointFeatures::FixedPointFeatures(
+                            const MelTables& tables,
+                            const FixedPointFeatureParams& params):
+        m_frameLen(tables.m_params.m_frameLen),
+        m_log2FftLen(BitLength(tables.m_params.m_frameLenPadded) - 1),
+        m_params(params),
+        m_weightsStart(tables.m_weightsStart, tables.m_weightsStart + tables.m_params.m_numFbankBins + 1),
+        m_filterFirst(tables.m_filterFirst, tables.m_filterFirst + tables.m_params.m_numFbankBins),
+        m_filterLast(tables.m_filterLast, tables.m_filterLast + tables.m_params.m_numFbankBins),
+        m_numFeatures(tables.m_dct ? tables.m_params.m_numMfccFeatures : tables.m_params.m_numFbankBins)
+    {
+        const uint32_t frameLen = tables.m_params.m_frameLen;
+        const uint32_t frameLenPadded = tables.m_params.m_frameLenPadded;
+        const uint32_t numBins = tables.m_params.m_numFbankBins;
+        const uint32_t numWeights = tables.m_weightsStart[numBins];
+        const uint32_t numDct = tables.m_dct ? tables.m_params.m_numMfccFeatures * numBins : 0;
+
+        /* Window in q15, so a windowed sample is in q30. */
+        this->m_windowQ15.resize(frameLen);
+        for (size_t i = 0; i < frameLen; ++i) {
+            this->m_windowQ15[i] = static_cast<int16_t>(
+                std::min(std::round(tables.m_window[i] * 32768.f), 32767.f));
+        }
+
+        /* Filter bank weights scaled to the largest one; the step goes into the log. */
+        float maxWeight = 0;
+        for (size_t i = 0; i < numWeights; ++i) {
+            maxWeight = std::max(maxWeight, tables.m_weights[i]);
+        }
+        const float weightStep = maxWeight > 0 ? maxWeight / 32767.f : 1.f;
+        this->m_logWeightStepQ16 = ToQ16(std::log(weightStep));
+
+        uint64_t maxWeightSum = 0;
+        this->m_weightsQ15.reserve(numWeights);
+        for (size_t bin = 0; bin < numBins; ++bin) {
+            uint64_t weightSum = 0;
+            for (uint32_t i = tables.m_weightsStart[bin]; i < tables.m_weightsStart[bin + 1]; ++i) {
+                const auto weightQ15 = static_cast<uint16_t>(std::round(tables.m_weights[i] / weightStep));
+                this->m_weightsQ15.push_back(weightQ15);
+                weightSum += weightQ15;
+            }
+            maxWeightSum = std::max(maxWeightSum, weightSum);
+        }
+        this->m_weightSumBits = BitLength(maxWeightSum);
+
+        /* DCT scaled to its largest coefficient. */
+        float maxCoeff = 0;
+        for (size_t i = 0; i < numDct; ++i) {
+            maxCoeff = std::max(maxCoeff, std::fabs(tables.m_dct[i]));
+        }
+        const float dctStep = maxCoeff > 0 ? maxCoeff / 32767.f : 1.f;
+        this->m_dctQ15.reserve(numDct);
+        for (size_t i = 0; i < numDct; ++i) {
+            this->m_dctQ15.push_back(static_cast<int16_t>(std::round(tables.m_dct[i] / dctStep)));
+        }
+
+        /* A DCT output sums q15 coefficients times Q16 logs, and is shifted
+         * down by 15 bits; log-Mel output is the Q16 log itself. */
+        this->m_featureScale = numDct ? dctStep / 2.f : 1.f / 65536.f;
+
+        this->m_logMultiplierQ16 = ToQ16(params.m_logMultiplier);
+        this->m_logFloorQ16 = ToQ16(std::log(params.m_melFloor) * params.m_logMultiplier);
+        this->m_topDbQ16 = ToQ16(params.m_topDb);
+
+        this->m_frame = std::vector<int32_t>(frameLenPadded, 0);
+        this->m_fftOut = std::vector<int32_t>(2 * frameLenPadded, 0);
+        this->m_spectrum = std::vector<uint64_t>(frameLenPadded / 2 + 1, 0);
+        this->m_logMelQ16 = std::vector<int32_t>(numBins, 0);
+
+        math::MathUtils::FftInitQ31(frameLenPadded, this->m_fftInstance);
+        this->SetQuantisation(1.f, 0);
+    }
+
+    bool FixedPointFeatures::SetQuantisation(const float quantScale, const int quantOffset,
+                                             const float mean)
+    {
+        if (quantScale <= 0) {
+            printf_err("Quantisation scale must be positive\n");
+            return false;
+        }
+
+        /* Multiplier as a q31 mantissa and a right shift. */
+        int exponent = 0;
+        const float mantissa = std::frexp(this->m_featureScale / quantScale, &exponent);
+        auto multiplier = static_cast<int64_t>(std::round(static_cast<double>(mantissa) * 2147483648.0));
+        if (multiplier == (1ll << 31)) {
+            multiplier >>= 1;
+            ++exponent;
+        }
+
+        const int32_t shift = 31 - exponent;
+        if (shift < 1 || shift > 62) {
+            printf_err("Quantisation scale %f out of range\n", quantScale);
+            return false;
+        }
+
+        this->m_quantMultiplier = static_cast<int32_t>(multiplier);
+        this->m_quantShift = shift;
+        this->m_quantOffset = quantOffset;
+        this->m_featureMean = static_cast<int64_t>(std::round(mean / this->m_featureScale));
+        return true;
+    }
+
+    size_t FixedPointFeatures::NumFeatures() const
+    {
+        return this->m_numFeatures;
+    }
+
+    bool FixedPointFeatures::ComputeLogMel(Span<const int16_t> audioData)
+    {
+        if (!this->m_fftInstance.m_initialised) {
+            return false;
+        }
+
+        /* Window the frame into q30, tracking its peak. */
+        const size_t numSamples = std::min<size_t>(audioData.size(), this->m_frameLen);
+        uint32_t peak = 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const int32_t sample = static_cast<int32_t>(audioData[i]) * this->m_windowQ15[i];
+            this->m_frame[i] = sample;
+            peak = std::max<uint32_t>(peak, sample < 0 ? -static_cast<uint32_t>(sample) : sample);
+        }
+        std::fill(this->m_frame.begin() + numSamples, this->m_frame.end(), 0);
+
+        /* Scale up to the q31 range. */
+        const int32_t headroom = peak ? 31 - BitLength(peak) : 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            this->m_frame[i] = static_cast<int32_t>(static_cast<uint32_t>(this->m_frame[i]) << headroom);
+        }
+
+        math::MathUtils::FftQ31(this->m_frame, this->m_fftOut, this->m_fftInstance);
+
+        /* Power or magnitude of bins 0 to N/2. */
+        uint64_t maxSpectrum = 0;
+        for (size_t k = 0; k < this->m_spectrum.size(); ++k) {
+            const int64_t re = this->m_fftOut[2 * k];
+            const int64_t im = this->m_fftOut[2 * k + 1];
+            const uint64_t power = static_cast<uint64_t>(re * re) + static_cast<uint64_t>(im * im);
+            this->m_spectrum[k] = this->m_params.m_usePower ? power : math::MathUtils::SqrtU64(power);
+            maxSpectrum = std::max(maxSpectrum, this->m_spectrum[k]);
+        }
+
+        /* Shift the spectrum down just enough for the filter sums to fit in 64 bits. */
+        const int32_t spectrumShift = std::max<int32_t>(0, BitLength(maxSpectrum) + this->m_weightSumBits - 64);
+
+        /* The spectrum is the real one times 2^scaleExp, as the FFT output
+         * is the DFT of the frame scaled up by the headroom and down by N. */
+        const int32_t scaleExp = (this->m_params.m_usePower ? 2 : 1) *
+                                 (30 + headroom - static_cast<int32_t>(this->m_log2FftLen));
+        const int64_t logOffsetQ16 = this->m_logWeightStepQ16 + (spectrumShift - scaleExp) * ms_ln2Q16;
+
+        int32_t maxLogMel = INT32_MIN;
+        const size_t lastBin = this->m_spectrum.size() - 1;
+        for (size_t bin = 0; bin < this->m_logMelQ16.size(); ++bin) {
+            const uint32_t lastIndex = std::min<uint32_t>(this->m_filterLast[bin], lastBin);
+            const uint16_t* weight = this->m_weightsQ15.data() + this->m_weightsStart[bin];
+            const uint16_t* weightEnd = this->m_weightsQ15.data() + this->m_weightsStart[bin + 1];
+
+            uint64_t melEnergy = 0;
+            for (uint32_t i = this->m_filterFirst[bin]; i <= lastIndex && weight != weightEnd; ++i) {
+                melEnergy += *weight++ * (this->m_spectrum[i] >> spectrumShift);
+            }
+
+            int32_t logMel = this->m_logFloorQ16;
+            if (melEnergy) {
+                const int64_t lnQ16 = math::MathUtils::LogarithmQ16(melEnergy) + logOffsetQ16;
+                logMel = std::max<int64_t>((lnQ16 * this->m_logMultiplierQ16) >> 16, this->m_logFloorQ16);
+            }
+            this->m_logMelQ16[bin] = logMel;
+            maxLogMel = std::max(maxLogMel, logMel);
+        }
+
+        if (this->m_topDbQ16 > 0) {
+            const int32_t clampLevel = maxLogMel - this->m_topDbQ16;
+            for (auto& logMel : this->m_logMelQ16) {
+                logMel = std::max(logMel, clampLevel);
+            }
+        }
+
+        return true;
+    }
+
+    int64_t FixedPointFeatures::Feature(const size_t index) const
+    {
+        if (this->m_dctQ15.empty()) {
+            return this->m_logMelQ16[index] - this->m_featureMean;
+        }
+
+        const size_t numBins = this->m_logMelQ16.size();
+        const int16_t* coeff = this->m_dctQ15.data() + index * numBins;
+        int64_t acc = 0;
+        for (size_t bin = 0; bin < numBins; ++bin) {
+            acc += static_cast<int64_t>(coeff[bin]) * this->m_logMelQ16[bin];
+        }
+        return ((acc + (1 << 14)) >> 15) - this->m_featureMean;
+    }
+
+    int32_t FixedPointFeatures::Quantise(const int64_t feature) const
+    {
+        /* Features stay within 32 bits, so the product fits in 64. */
+        const int64_t clamped = std::min<int64_t>(std::max<int64_t>(feature, INT32_MIN), INT32_MAX);
+        const int64_t rounding = 1ll << (this->m_quantShift - 1);
+        const int64_t value = (clamped * this->m_quantMultiplier + rounding) >> this->m_quantShift;
+        return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(value, INT32_MIN), INT32_MAX)) +
+               this->m_quantOffset;
+    }
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
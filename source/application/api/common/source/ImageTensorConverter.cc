@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ImageTensorConverter.hpp"
+
+#include "ImageUtils.hpp"
+#include "log_macros.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm {
+namespace app {
+namespace image {
+
+    ImageToTensorConverter::ImageToTensorConverter(TfLiteTensor* tensor, bool rgbToGray,
+                                                   PixelScaling scaling)
+    :   m_tensor{tensor},
+        m_rgbToGray{rgbToGray}
+    {
+        if (tensor == nullptr) {
+            return;
+        }
+
+        const bool isSigned = tensor->type == kTfLiteInt8;
+        const float minVal = isSigned ? INT8_MIN : 0;
+        const float maxVal = isSigned ? INT8_MAX : UINT8_MAX;
+        const QuantParams quantParams = GetTensorQuantParams(tensor);
+
+        for (int pixel = 0; pixel < 256; ++pixel) {
+            int32_t value = pixel;
+            if (scaling == PixelScaling::Normalised) {
+                const float quantised = (pixel / 255.0f) / quantParams.scale + quantParams.offset;
+                value = static_cast<int32_t>(std::min(maxVal, std::max(minVal, quantised)));
+            } else if (scaling == PixelScaling::Centred) {
+                value = pixel - 128;
+            }
+            this->m_lut[pixel] = static_cast<uint8_t>(value);
+        }
+
+        this->m_identity = scaling == PixelScaling::Raw;
+    }
+
+    bool ImageToTensorConverter::Convert(const uint8_t* src, size_t numPixels) const
+    {
+        if (src == nullptr || this->m_tensor == nullptr) {
+            printf_err("Invalid image or tensor\n");
+            return false;
+        }
+
+        if (this->m_tensor->type != kTfLiteInt8 && this->m_tensor->type != kTfLiteUInt8) {
+            printf_err("Image conversion needs an int8 or uint8 tensor\n");
+            return false;
+        }
+
+        numPixels = std::min(numPixels, this->m_tensor->bytes);
+        uint8_t* dst = this->m_tensor->data.uint8;
+
+        if (this->m_rgbToGray) {
+            for (size_t i = 0; i < numPixels; ++i, src += 3) {
+                dst[i] = this->m_lut[RgbToGray(src[0], src[1], src[2])];
+            }
+        } else if (this->m_identity) {
+            std::memcpy(dst, src, numPixels);
+        } else {
+            for (size_t i = 0; i < numPixels; ++i) {
+                dst[i] = this->m_lut[src[i]];
+            }
+        }
+
+        return true;
+    }
+
+    uint8_t ImageToTensorConverter::MapPixel(uint8_t pixel) const
+    {
+        return this->m_lut[pixel];
+    }
+
+} /* namespace image */
+} /* namespace app */
+} /* namespace arm */
@@ -16,8 +16,6 @@
  */
 #include "ImageUtils.hpp"
 
-#include <limits>
-
 namespace arm {
 namespace app {
 namespace image {
@@ -109,15 +107,8 @@ namespace image {
 
     void RgbToGrayscale(const uint8_t* srcPtr, uint8_t* dstPtr, const size_t dstImgSz)
     {
-        const float R = 0.299;
-        const float G = 0.587;
-        const float B = 0.114;
         for (size_t i = 0; i < dstImgSz; ++i, srcPtr += 3) {
-            uint32_t  int_gray = R * (*srcPtr) +
-                                 G * (*(srcPtr + 1)) +
-                                 B * (*(srcPtr + 2));
-            *dstPtr++ = int_gray <= std::numeric_limits<uint8_t>::max() ?
-                        int_gray : std::numeric_limits<uint8_t>::max();
+            *dstPtr++ = RgbToGray(srcPtr[0], srcPtr[1], srcPtr[2]);
         }
     }
 
@@ -20,6 +20,7 @@
 
 #include <cfloat>
 #include <cinttypes>
+#include <algorithm>
 
 namespace arm {
 namespace app {
@@ -69,16 +70,13 @@ namespace audio {
         this->m_melEnergies = std::vector<float>(
                                 this->m_params.m_numFbankBins, 0.0);
 
-        this->m_windowFunc = std::vector<float>(this->m_params.m_frameLen);
-        const auto multiplier = static_cast<float>(2 * M_PI / this->m_params.m_frameLen);
-
-        /* Create window function. */
-        for (size_t i = 0; i < this->m_params.m_frameLen; i++) {
-            this->m_windowFunc[i] = (0.5 - (0.5 *
-                math::MathUtils::CosineF32(static_cast<float>(i) * multiplier)));
-        }
-
+#if FEATURE_EXTRACTION_F16
+        this->m_frameF16 = std::vector<math::float16>(this->m_params.m_frameLenPadded, 0);
+        this->m_bufferF16 = std::vector<math::float16>(this->m_params.m_frameLenPadded, 0);
+        math::MathUtils::FftInitF16(this->m_params.m_frameLenPadded, this->m_fftInstanceF16);
+#else /* FEATURE_EXTRACTION_F16 */
         math::MathUtils::FftInitF32(this->m_params.m_frameLenPadded, this->m_fftInstance);
+#endif /* FEATURE_EXTRACTION_F16 */
         this->m_params.Log();
     }
 
@@ -120,26 +118,23 @@ namespace audio {
 
 
     bool MFCC::ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&               filterBankFilterFirst,
-            std::vector<uint32_t>&               filterBankFilterLast,
-            std::vector<float>&                 melEnergies)
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies)
     {
         const size_t numBanks = melEnergies.size();
 
-        if (numBanks != filterBankFilterFirst.size() ||
-                numBanks != filterBankFilterLast.size()) {
+        if (numBanks != tables.m_params.m_numFbankBins) {
             printf_err("unexpected filter bank lengths\n");
             return false;
         }
 
         for (size_t bin = 0; bin < numBanks; ++bin) {
-            auto filterBankIter = melFilterBank[bin].begin();
-            auto end = melFilterBank[bin].end();
+            const float* filterBankIter = tables.m_weights + tables.m_weightsStart[bin];
+            const float* end = tables.m_weights + tables.m_weightsStart[bin + 1];
             float melEnergy = FLT_MIN;  /* Avoid log of zero at later stages */
-            const uint32_t firstIndex = filterBankFilterFirst[bin];
-            const uint32_t lastIndex = std::min<uint32_t>(filterBankFilterLast[bin], fftVec.size() - 1);
+            const uint32_t firstIndex = tables.m_filterFirst[bin];
+            const uint32_t lastIndex = std::min<uint32_t>(tables.m_filterLast[bin], fftVec.size() - 1);
 
             for (uint32_t i = firstIndex; i <= lastIndex && filterBankIter != end; i++) {
                 float energyRep = math::MathUtils::SqrtF32(fftVec[i]);
@@ -209,15 +204,77 @@ namespace audio {
         return 1.f;
     }
 
+    FixedPointFeatureParams MFCC::GetFixedPointParams() const
+    {
+        /* Magnitude spectrum and natural logs, see ApplyMelFilterBank. */
+        return FixedPointFeatureParams{};
+    }
+
+    const MelTables* MFCC::GetPrecomputedTables() const
+    {
+        return nullptr;
+    }
+
+    FixedPointFeatures MFCC::MakeFixedPoint()
+    {
+        this->InitMelFilterBank();
+        return FixedPointFeatures(this->Tables(), this->GetFixedPointParams());
+    }
+
+    MelTableParams MFCC::TableParams() const
+    {
+        return MelTableParams{this->m_params.m_samplingFreq,
+                              this->m_params.m_numFbankBins,
+                              this->m_params.m_melLoFreq,
+                              this->m_params.m_melHiFreq,
+                              this->m_params.m_numMfccFeatures,
+                              this->m_params.m_frameLen,
+                              this->m_params.m_frameLenPadded,
+                              this->m_params.m_useHtkMethod};
+    }
+
+    MelTables MFCC::Tables() const
+    {
+        if (this->m_precomputedTables) {
+            return *this->m_precomputedTables;
+        }
+        return MelTables{this->TableParams(),
+                         this->m_windowFunc.data(),
+                         this->m_melWeights.data(),
+                         this->m_melWeightsStart.data(),
+                         this->m_filterBankFilterFirst.data(),
+                         this->m_filterBankFilterLast.data(),
+                         this->m_dctMatrix.data()};
+    }
+
     void MFCC::InitMelFilterBank()
     {
-        if (!this->IsMelFilterBankInited()) {
-            this->m_melFilterBank = this->CreateMelFilterBank();
-            this->m_dctMatrix = this->CreateDCTMatrix(
-                                    this->m_params.m_numFbankBins,
-                                    this->m_params.m_numMfccFeatures);
-            this->m_filterBankInitialised = true;
+        if (this->IsMelFilterBankInited()) {
+            return;
         }
+        this->m_filterBankInitialised = true;
+
+        /* Tables from flash if there are some for these parameters. */
+        const MelTables* precomputed = this->GetPrecomputedTables();
+        if (precomputed && precomputed->m_params == this->TableParams()) {
+            this->m_precomputedTables = precomputed;
+            debug("Using precomputed MFCC tables\n");
+            return;
+        }
+
+        this->m_windowFunc = std::vector<float>(this->m_params.m_frameLen);
+        const auto multiplier = static_cast<float>(2 * M_PI / this->m_params.m_frameLen);
+
+        /* Create window function. */
+        for (size_t i = 0; i < this->m_params.m_frameLen; i++) {
+            this->m_windowFunc[i] = (0.5 - (0.5 *
+                math::MathUtils::CosineF32(static_cast<float>(i) * multiplier)));
+        }
+
+        this->CreateMelFilterBank();
+        this->m_dctMatrix = this->CreateDCTMatrix(
+                                this->m_params.m_numFbankBins,
+                                this->m_params.m_numMfccFeatures);
     }
 
     bool MFCC::IsMelFilterBankInited() const
@@ -225,35 +282,45 @@ namespace audio {
         return this->m_filterBankInitialised;
     }
 
-    void MFCC::MfccComputePreFeature(const std::vector<int16_t>& audioData)
+    void MFCC::MfccComputePreFeature(Span<const int16_t> audioData)
     {
         this->InitMelFilterBank();
+        const MelTables tables = this->Tables();
 
         /* TensorFlow way of normalizing .wav data to (-1, 1). */
         constexpr float normaliser = 1.0/(1u<<15u);
-        for (size_t i = 0; i < this->m_params.m_frameLen; i++) {
+        const size_t numSamples = std::min<size_t>(audioData.size(), this->m_params.m_frameLen);
+        for (size_t i = 0; i < numSamples; i++) {
             this->m_frame[i] = static_cast<float>(audioData[i]) * normaliser;
         }
 
         /* Apply window function to input frame. */
-        for(size_t i = 0; i < this->m_params.m_frameLen; i++) {
-            this->m_frame[i] *= this->m_windowFunc[i];
+        for(size_t i = 0; i < numSamples; i++) {
+            this->m_frame[i] *= tables.m_window[i];
         }
 
         /* Set remaining frame values to 0. */
-        std::fill(this->m_frame.begin() + this->m_params.m_frameLen,this->m_frame.end(), 0);
+        std::fill(this->m_frame.begin() + numSamples,this->m_frame.end(), 0);
 
         /* Compute FFT. */
+#if FEATURE_EXTRACTION_F16
+        /* In half precision, and back to float32 for the power spectrum,
+         * which would overflow it. */
+        math::MathUtils::VecConvertF32ToF16(this->m_frame.data(), this->m_frameF16.data(),
+                                            this->m_frameF16.size());
+        math::MathUtils::FftF16(this->m_frameF16, this->m_bufferF16, this->m_fftInstanceF16);
+        math::MathUtils::VecConvertF16ToF32(this->m_bufferF16.data(), this->m_buffer.data(),
+                                            this->m_buffer.size());
+#else /* FEATURE_EXTRACTION_F16 */
         math::MathUtils::FftF32(this->m_frame, this->m_buffer, this->m_fftInstance);
+#endif /* FEATURE_EXTRACTION_F16 */
 
         /* Convert to power spectrum. */
         this->ConvertToPowerSpectrum();
 
         /* Apply mel filterbanks. */
         if (!this->ApplyMelFilterBank(this->m_buffer,
-                                      this->m_melFilterBank,
-                                      this->m_filterBankFilterFirst,
-                                      this->m_filterBankFilterLast,
+                                      tables,
                                       this->m_melEnergies)) {
             printf_err("Failed to apply MEL filter banks\n");
         }
@@ -262,14 +329,14 @@ namespace audio {
         this->ConvertToLogarithmicScale(this->m_melEnergies);
     }
 
-    std::vector<float> MFCC::MfccCompute(const std::vector<int16_t>& audioData)
+    std::vector<float> MFCC::MfccCompute(Span<const int16_t> audioData)
     {
         this->MfccComputePreFeature(audioData);
 
         std::vector<float> mfccOut(this->m_params.m_numMfccFeatures);
 
         float * ptrMel = this->m_melEnergies.data();
-        float * ptrDct = this->m_dctMatrix.data();
+        const float * ptrDct = this->Tables().m_dct;
         float * ptrMfcc = mfccOut.data();
 
         /* Take DCT. Uses matrix mul. */
@@ -283,7 +350,50 @@ namespace audio {
         return mfccOut;
     }
 
-    std::vector<std::vector<float>> MFCC::CreateMelFilterBank()
+    bool MFCC::MfccComputeBatch(const WindowBatch<const int16_t>& frames,
+                                float* mfccOut, const size_t outStride)
+    {
+        const size_t numFrames = frames.Count();
+        if (outStride < numFrames) {
+            printf_err("MFCC output stride %zu too small for %zu frames\n", outStride, numFrames);
+            return false;
+        }
+
+        const size_t batchFrames = ms_batchFrames;
+        const size_t numFbankBins = this->m_params.m_numFbankBins;
+        const size_t numMfccFeats = this->m_params.m_numMfccFeatures;
+        this->m_melBatch.resize(numFbankBins * batchFrames);
+        this->m_mfccBatch.resize(numMfccFeats * batchFrames);
+
+        for (size_t first = 0; first < numFrames; first += batchFrames) {
+            const size_t count = std::min(batchFrames, numFrames - first);
+
+            /* Mel energies of the frames as the columns of a numFbankBins x count matrix. */
+            for (size_t k = 0; k < count; ++k) {
+                this->MfccComputePreFeature(frames[first + k]);
+                for (size_t bin = 0; bin < numFbankBins; ++bin) {
+                    this->m_melBatch[bin * count + k] = this->m_melEnergies[bin];
+                }
+            }
+
+            /* Take DCT of all of them at once. */
+            if (!math::MathUtils::MatMulF32(this->Tables().m_dct, numMfccFeats, numFbankBins,
+                                            this->m_melBatch.data(), count,
+                                            this->m_mfccBatch.data())) {
+                printf_err("Failed to take DCT of MFCC batch\n");
+                return false;
+            }
+
+            for (size_t i = 0; i < numMfccFeats; ++i) {
+                const float* row = this->m_mfccBatch.data() + i * count;
+                std::copy(row, row + count, mfccOut + i * outStride + first);
+            }
+        }
+
+        return true;
+    }
+
+    void MFCC::CreateMelFilterBank()
     {
         size_t numFftBins = this->m_params.m_frameLenPadded / 2;
         float fftBinWidth = static_cast<float>(this->m_params.m_samplingFreq) / this->m_params.m_frameLenPadded;
@@ -295,8 +405,8 @@ namespace audio {
         float melFreqDelta = (melHighFreq - melLowFreq) / (this->m_params.m_numFbankBins + 1);
 
         std::vector<float> thisBin = std::vector<float>(numFftBins);
-        std::vector<std::vector<float>> melFilterBank(
-                                            this->m_params.m_numFbankBins);
+        this->m_melWeights.clear();
+        this->m_melWeightsStart = std::vector<uint32_t>(1, 0);
         this->m_filterBankFilterFirst =
                         std::vector<uint32_t>(this->m_params.m_numFbankBins);
         this->m_filterBankFilterLast =
@@ -339,11 +449,10 @@ namespace audio {
 
             /* Copy the part we care about. */
             for (uint32_t i = firstIndex; i <= lastIndex; i++) {
-                melFilterBank[bin].push_back(thisBin[i]);
+                this->m_melWeights.push_back(thisBin[i]);
             }
+            this->m_melWeightsStart.push_back(this->m_melWeights.size());
         }
-
-        return melFilterBank;
     }
 
 } /* namespace audio */
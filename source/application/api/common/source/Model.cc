@@ -36,6 +36,14 @@ bool arm::app::Model::Init(uint8_t* tensorArenaAddr,
                            uint32_t nnModelSize,
                            tflite::MicroAllocator* allocator)
 {
+    /* Waking up with the model already in place: keep the interpreter and
+     * its allocations, only its state needs resetting. */
+    if (this->m_inited && nnModelAddr == this->m_modelAddr &&
+            tensorArenaAddr == this->m_arenaAddr && !allocator) {
+        debug("Model already initialised, resetting the interpreter\n");
+        return this->Reset();
+    }
+
     /* Following tf lite micro example:
      * Map the model into a usable data structure. This doesn't involve any
      * copying or parsing, it's a very lightweight operation. */
@@ -70,7 +78,9 @@ bool arm::app::Model::Init(uint8_t* tensorArenaAddr,
     this->m_pAllocator = allocator;
     if (!this->m_pAllocator) {
         /* Create an allocator instance */
-        info("Creating allocator using tensor arena at 0x%p\n", tensorArenaAddr);
+        if (!this->m_fastBoot) {
+            info("Creating allocator using tensor arena at 0x%p\n", tensorArenaAddr);
+        }
 
         this->m_pAllocator = tflite::MicroAllocator::Create(tensorArenaAddr, tensorArenaSize);
 
@@ -92,12 +102,15 @@ bool arm::app::Model::Init(uint8_t* tensorArenaAddr,
     }
 
     /* Allocate memory from the tensor_arena for the model's tensors. */
-    info("Allocating tensors\n");
+    if (!this->m_fastBoot) {
+        info("Allocating tensors\n");
+    }
     TfLiteStatus allocate_status = this->m_pInterpreter->AllocateTensors();
 
     if (allocate_status != kTfLiteOk) {
         printf_err("tensor allocation failed!\n");
         delete this->m_pInterpreter;
+        this->m_pInterpreter = nullptr;
         return false;
     }
 
@@ -116,21 +129,33 @@ bool arm::app::Model::Init(uint8_t* tensorArenaAddr,
     } else {
         this->m_type = this->m_input[0]->type; /* Input 0 should be the main input */
 
-        /* Clear the input & output tensors */
-        for (size_t inIndex = 0; inIndex < this->GetNumInputs(); inIndex++) {
-            std::memset(this->m_input[inIndex]->data.data, 0, this->m_input[inIndex]->bytes);
-        }
-        for (size_t outIndex = 0; outIndex < this->GetNumOutputs(); outIndex++) {
-            std::memset(this->m_output[outIndex]->data.data, 0, this->m_output[outIndex]->bytes);
+        if (!this->m_fastBoot) {
+            /* Clear the input & output tensors */
+            for (size_t inIndex = 0; inIndex < this->GetNumInputs(); inIndex++) {
+                std::memset(this->m_input[inIndex]->data.data, 0, this->m_input[inIndex]->bytes);
+            }
+            for (size_t outIndex = 0; outIndex < this->GetNumOutputs(); outIndex++) {
+                std::memset(this->m_output[outIndex]->data.data, 0, this->m_output[outIndex]->bytes);
+            }
+
+            this->LogInterpreterInfo();
         }
+    }
 
-        this->LogInterpreterInfo();
+    if (!this->PlanStateCopies()) {
+        return false;
     }
 
+    this->m_arenaAddr = tensorArenaAddr;
     this->m_inited = true;
     return true;
 }
 
+void arm::app::Model::SetFastBoot(bool fastBoot)
+{
+    this->m_fastBoot = fastBoot;
+}
+
 tflite::MicroAllocator* arm::app::Model::GetAllocator()
 {
     if (this->IsInited()) {
@@ -263,6 +288,145 @@ bool arm::app::Model::RunInference()
     return inference_state;
 }
 
+bool arm::app::Model::Reset()
+{
+    if (!this->m_pInterpreter) {
+        printf_err("Error: No interpreter!\n");
+        return false;
+    }
+    if (kTfLiteOk != this->m_pInterpreter->Reset()) {
+        printf_err("Interpreter reset failed.\n");
+        return false;
+    }
+    return true;
+}
+
+bool arm::app::Model::WarmUp()
+{
+    if (!this->IsInited()) {
+        printf_err("Model is not initialised!\n");
+        return false;
+    }
+
+    for (auto input : this->m_input) {
+        int zeroPoint = 0;
+        if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) {
+            zeroPoint = GetTensorQuantParams(input).offset;
+        }
+        std::memset(input->data.data, zeroPoint, input->bytes);
+    }
+
+    if (!this->RunInference()) {
+        return false;
+    }
+
+    for (auto output : this->m_output) {
+        std::memset(output->data.data, 0, output->bytes);
+    }
+    return this->Reset();
+}
+
+const std::vector<std::pair<size_t, size_t>>& arm::app::Model::GetStateTensorMap()
+{
+    static const std::vector<std::pair<size_t, size_t>> noState{};
+    return noState;
+}
+
+bool arm::app::Model::PlanStateCopies()
+{
+    std::vector<StateCopy> copies;
+    for (const auto& stateMapping : this->GetStateTensorMap()) {
+        TfLiteTensor* output = this->GetOutputTensor(stateMapping.first);
+        TfLiteTensor* input = this->GetInputTensor(stateMapping.second);
+        if (!output || !input) {
+            printf_err("Invalid state mapping: output %zu to input %zu\n",
+                       stateMapping.first, stateMapping.second);
+            return false;
+        } else if (output->bytes != input->bytes) {
+            printf_err("Unexpected number of bytes for state mapping. Input = %zu, output = %zu.\n",
+                       input->bytes, output->bytes);
+            return false;
+        }
+        copies.push_back(StateCopy{tflite::GetTensorData<uint8_t>(output),
+                                   tflite::GetTensorData<uint8_t>(input),
+                                   input->bytes});
+    }
+
+    this->m_stateCopies.Plan(std::move(copies));
+    if (this->m_stateCopies.GetStagedBytes()) {
+        debug("%zu state bytes are staged between inferences\n", this->m_stateCopies.GetStagedBytes());
+    }
+    return true;
+}
+
+void arm::app::Model::ResetStates()
+{
+    for (const auto& stateMapping : this->GetStateTensorMap()) {
+        TfLiteTensor* input = this->GetInputTensor(stateMapping.second);
+        if (!input) {
+            continue;
+        }
+
+        /* Initial value of states is 0, but this is affected by quantization zero point. */
+        int zeroPoint = 0;
+        if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) {
+            zeroPoint = GetTensorQuantParams(input).offset;
+        }
+        std::memset(input->data.data, zeroPoint, input->bytes);
+    }
+}
+
+bool arm::app::Model::CarryOverStates()
+{
+    if (!this->IsInited()) {
+        printf_err("Model is not initialised!\n");
+        return false;
+    }
+
+    this->m_stateCopies.Apply();
+    return true;
+}
+
+size_t arm::app::Model::GetStateBytes()
+{
+    size_t bytes = 0;
+    for (const auto& stateMapping : this->GetStateTensorMap()) {
+        TfLiteTensor* input = this->GetInputTensor(stateMapping.second);
+        bytes += input ? input->bytes : 0;
+    }
+    return bytes;
+}
+
+bool arm::app::Model::SaveStates(uint8_t* dst, const size_t size)
+{
+    if (!this->IsInited() || size < this->GetStateBytes()) {
+        printf_err("Cannot save %zu state bytes to a %zu byte buffer\n", this->GetStateBytes(), size);
+        return false;
+    }
+
+    for (const auto& stateMapping : this->GetStateTensorMap()) {
+        TfLiteTensor* output = this->GetOutputTensor(stateMapping.first);
+        std::memcpy(dst, output->data.data, output->bytes);
+        dst += output->bytes;
+    }
+    return true;
+}
+
+bool arm::app::Model::LoadStates(const uint8_t* src, const size_t size)
+{
+    if (!this->IsInited() || size < this->GetStateBytes()) {
+        printf_err("Cannot load %zu state bytes from a %zu byte buffer\n", this->GetStateBytes(), size);
+        return false;
+    }
+
+    for (const auto& stateMapping : this->GetStateTensorMap()) {
+        TfLiteTensor* input = this->GetInputTensor(stateMapping.second);
+        std::memcpy(input->data.data, src, input->bytes);
+        src += input->bytes;
+    }
+    return true;
+}
+
 TfLiteTensor* arm::app::Model::GetInputTensor(size_t index) const
 {
     if (index < this->GetNumInputs()) {
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "StateCopyPlan.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace arm {
+namespace app {
+
+    static bool Overlaps(const uint8_t* a, size_t aBytes, const uint8_t* b, size_t bBytes)
+    {
+        return a < b + bBytes && b < a + aBytes;
+    }
+
+    void StateCopyPlan::Plan(std::vector<StateCopy> copies)
+    {
+        /* Repeatedly take a copy whose destination holds no other pending source. */
+        this->m_copies.clear();
+        while (!copies.empty()) {
+            auto next = std::find_if(copies.begin(), copies.end(), [&copies](const StateCopy& copy) {
+                return std::none_of(copies.begin(), copies.end(), [&copy](const StateCopy& other) {
+                    return &other != &copy && Overlaps(copy.m_dst, copy.m_bytes, other.m_src, other.m_bytes);
+                });
+            });
+
+            if (next == copies.end()) {
+                break;
+            }
+            this->m_copies.push_back(*next);
+            copies.erase(next);
+        }
+
+        /* The rest depend on each other in a cycle: stage their sources. */
+        size_t stagingBytes = 0;
+        for (const auto& copy : copies) {
+            stagingBytes += copy.m_bytes;
+        }
+        this->m_staging.assign(stagingBytes, 0);
+        this->m_stagedCopies = std::move(copies);
+    }
+
+    void StateCopyPlan::Apply()
+    {
+        /* memmove, as a state input may share memory with its own output. */
+        for (const auto& copy : this->m_copies) {
+            std::memmove(copy.m_dst, copy.m_src, copy.m_bytes);
+        }
+
+        uint8_t* staged = this->m_staging.data();
+        for (const auto& copy : this->m_stagedCopies) {
+            std::memcpy(staged, copy.m_src, copy.m_bytes);
+            staged += copy.m_bytes;
+        }
+        staged = this->m_staging.data();
+        for (const auto& copy : this->m_stagedCopies) {
+            std::memcpy(copy.m_dst, staged, copy.m_bytes);
+            staged += copy.m_bytes;
+        }
+    }
+
+    size_t StateCopyPlan::GetStagedBytes() const
+    {
+        return this->m_staging.size();
+    }
+
+} /* namespace app */
+} /* namespace arm */
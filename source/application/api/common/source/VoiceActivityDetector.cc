@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "VoiceActivityDetector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /* Noise floor adaptation rate when the level rises; falls are tracked immediately. */
+    static constexpr float ms_noiseFloorRiseRate = 0.05f;
+
+    /* Smallest power considered, to keep the dB conversions finite. */
+    static constexpr float ms_powerEpsilon = 1e-12f;
+
+    static float DbToPowerRatio(float db)
+    {
+        return std::pow(10.f, db / 10.f);
+    }
+
+    static float PowerRatioToDb(float power)
+    {
+        return 10.f * std::log10(std::max(power, ms_powerEpsilon));
+    }
+
+    EnergyVad::EnergyVad(float thresholdDb, float minLevelDbfs,
+                         uint32_t hangoverBlocks, float maxZeroCrossingRate)
+    :   m_thresholdRatio{DbToPowerRatio(thresholdDb)},
+        m_minPower{DbToPowerRatio(minLevelDbfs)},
+        m_hangoverBlocks{hangoverBlocks},
+        m_maxZcr{maxZeroCrossingRate}
+    {}
+
+    bool EnergyVad::IsVoiceActive(const int16_t* samples, size_t numSamples, float gain)
+    {
+        if (samples == nullptr || numSamples == 0) {
+            return this->m_hangoverLeft > 0;
+        }
+
+        /* Energy and zero crossings in a single pass. */
+        int64_t sumSquares = 0;
+        uint32_t crossings = 0;
+        bool prevNegative = samples[0] < 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const int32_t s = samples[i];
+            sumSquares += s * s;
+            const bool negative = s < 0;
+            crossings += (negative != prevNegative);
+            prevNegative = negative;
+        }
+
+        /* Power relative to full scale, with the applied gain removed. */
+        const float fullScale = 32768.f * std::max(gain, ms_powerEpsilon);
+        const float power = (static_cast<float>(sumSquares) / numSamples) / (fullScale * fullScale);
+        const float zcr = static_cast<float>(crossings) / numSamples;
+
+        this->m_lastPower = power;
+        this->m_lastZcr = zcr;
+
+        if (!this->m_floorValid) {
+            this->m_noiseFloor = std::max(power, this->m_minPower);
+            this->m_floorValid = true;
+        }
+
+        const bool loudEnough = power >= this->m_minPower &&
+                                power >= this->m_noiseFloor * this->m_thresholdRatio;
+        const bool active = loudEnough && zcr <= this->m_maxZcr;
+
+        if (!loudEnough) {
+            /* Follow the noise floor down straight away, up slowly. */
+            if (power < this->m_noiseFloor) {
+                this->m_noiseFloor = std::max(power, ms_powerEpsilon);
+            } else {
+                this->m_noiseFloor += (power - this->m_noiseFloor) * ms_noiseFloorRiseRate;
+            }
+        }
+
+        if (active) {
+            this->m_hangoverLeft = this->m_hangoverBlocks;
+            return true;
+        }
+
+        if (this->m_hangoverLeft > 0) {
+            --this->m_hangoverLeft;
+            return true;
+        }
+
+        return false;
+    }
+
+    void EnergyVad::Reset()
+    {
+        this->m_noiseFloor = 0.f;
+        this->m_lastPower = 0.f;
+        this->m_lastZcr = 0.f;
+        this->m_hangoverLeft = 0;
+        this->m_floorValid = false;
+    }
+
+    float EnergyVad::GetLastLevelDbfs() const
+    {
+        return PowerRatioToDb(this->m_lastPower);
+    }
+
+    float EnergyVad::GetNoiseFloorDbfs() const
+    {
+        return PowerRatioToDb(this->m_noiseFloor);
+    }
+
+    float EnergyVad::GetLastZeroCrossingRate() const
+    {
+        return this->m_lastZcr;
+    }
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
@@ -26,6 +26,12 @@ namespace app {
         extern const int g_FrameStride;
         extern const float g_ScoreThreshold;
         extern const float g_TrainingMean;
+        extern const int g_AudioRate;
+        extern const int g_MachineId;
+        extern const float g_ScoreHysteresis;
+        extern const float g_ScoreEmaAlpha;
+        extern const int g_MinWindows;
+        extern const float g_ConfidenceMargin;
     } /* namespace ad */
 
     class AdModel : public Model {
@@ -88,10 +88,10 @@ namespace app {
         uint32_t    m_numReusedFeatureVectors{}; /**< Number of MEL vectors that can be re-used */
         uint32_t    m_audioWindowIndex{}; /**< Current audio window index (from audio's sliding window) */
 
-        audio::SlidingWindow<const int16_t> m_melWindowSlider; /**< Internal MEL spectrogram window slider */
+        audio::WindowView<const int16_t> m_melWindowSlider; /**< Internal MEL spectrogram window slider */
         audio::AdMelSpectrogram m_melSpec; /**< MEL spectrogram computation object */
         std::function<void
-            (std::vector<int16_t>&, int, bool, size_t, size_t)> m_featureCalc; /**< Feature calculator object */
+            (audio::Span<const int16_t>, int, bool, size_t, size_t)> m_featureCalc; /**< Feature calculator object */
     };
 
     class AdPostProcess : public BasePostProcess {
@@ -117,9 +117,28 @@ namespace app {
          */
         float GetOutputValue(uint32_t index);
 
+        /**
+         * @brief Restricts post-processing to a single output, the softmax value for the
+         *        monitored machine. Only the softmax normaliser is computed, straight from
+         *        the quantised output and a table of exponentials, and only this index can
+         *        be read back with GetOutputValue.
+         * @param index Index of the output to monitor.
+         * @return True if successful, false otherwise.
+         */
+        bool SetMonitoredIndex(uint32_t index);
+
     private:
         TfLiteTensor* m_outputTensor{}; /**< Output tensor pointer */
         std::vector<float> m_dequantizedOutputVec{}; /**< Internal output vector */
+        int32_t m_monitoredIndex{-1}; /**< Only output computed, or -1 for all of them */
+        float m_monitoredValue{0}; /**< Softmax value of the monitored output */
+        std::vector<float> m_expTable{}; /**< exp(-scale * n) for a difference of n quantisation steps */
+
+        /**
+         * @brief Computes the softmax value of the monitored output only.
+         * @return True if successful, false otherwise.
+         */
+        bool MonitoredSoftmax();
 
         /**
          * @brief De-quantizes and flattens the output tensor into a vector.
@@ -171,14 +190,14 @@ namespace app {
      * @return              lambda function to compute features.
      */
     template<class T>
-    std::function<void (std::vector<int16_t>&, size_t, bool, size_t, size_t)>
+    std::function<void (audio::Span<const int16_t>, size_t, bool, size_t, size_t)>
     FeatureCalc(TfLiteTensor* inputTensor, size_t cacheSize,
-                std::function<std::vector<T> (std::vector<int16_t>& )> compute)
+                std::function<std::vector<T> (audio::Span<const int16_t>)> compute)
     {
         /* Feature cache to be captured by lambda function*/
         static std::vector<std::vector<T>> featureCache = std::vector<std::vector<T>>(cacheSize);
 
-        return [=](std::vector<int16_t>& audioDataWindow,
+        return [=](audio::Span<const int16_t> audioDataWindow,
                    size_t index,
                    bool useCache,
                    size_t featuresOverlapIndex,
@@ -209,17 +228,17 @@ namespace app {
         };
     }
 
-    template std::function<void (std::vector<int16_t>&, size_t , bool, size_t, size_t)>
+    template std::function<void (audio::Span<const int16_t>, size_t , bool, size_t, size_t)>
     FeatureCalc<int8_t>(TfLiteTensor* inputTensor,
                         size_t cacheSize,
-                        std::function<std::vector<int8_t> (std::vector<int16_t>&)> compute);
+                        std::function<std::vector<int8_t> (audio::Span<const int16_t>)> compute);
 
-    template std::function<void(std::vector<int16_t>&, size_t, bool, size_t, size_t)>
+    template std::function<void(audio::Span<const int16_t>, size_t, bool, size_t, size_t)>
     FeatureCalc<float>(TfLiteTensor *inputTensor,
                        size_t cacheSize,
-                       std::function<std::vector<float>(std::vector<int16_t>&)> compute);
+                       std::function<std::vector<float>(audio::Span<const int16_t>)> compute);
 
-    std::function<void (std::vector<int16_t>&, int, bool, size_t, size_t)>
+    std::function<void (audio::Span<const int16_t>, int, bool, size_t, size_t)>
     GetFeatureCalculator(audio::AdMelSpectrogram& melSpec,
                          TfLiteTensor* inputTensor,
                          size_t cacheSize,
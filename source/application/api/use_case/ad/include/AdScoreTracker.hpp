@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AD_SCORE_TRACKER_HPP
+#define AD_SCORE_TRACKER_HPP
+
+#include <cstdint>
+
+namespace arm {
+namespace app {
+
+    /** Anomaly verdict for the audio seen so far. */
+    enum class AdVerdict {
+        Undecided,  /* Not enough windows yet, or score still inside the hysteresis band. */
+        Normal,
+        Anomaly
+    };
+
+    /** Parameters for AdScoreTracker. */
+    struct AdScoreTrackerConfig {
+        float       threshold{0.f};         /**< Score above which a window is anomalous. */
+        float       hysteresis{0.f};        /**< Half width of the band around the threshold the
+                                                 score must leave to change the verdict. */
+        float       emaAlpha{0.f};          /**< Weight of each new window in an exponential moving
+                                                 average. 0 uses the mean over all windows. */
+        uint32_t    minWindows{1};          /**< Windows needed before any verdict. */
+        float       confidenceMargin{-1.f}; /**< Distance from the threshold at which a verdict is
+                                                 final. Negative disables early exit. */
+    };
+
+    /**
+     * @brief   Turns per-window anomaly scores into a running verdict for a stream
+     *          of audio. The score is smoothed with either a running mean (as the
+     *          whole clip average) or an exponential moving average (for long
+     *          running monitoring, where old audio should stop mattering), and the
+     *          verdict only flips once the smoothed score leaves the hysteresis
+     *          band, so a score hovering around the threshold doesn't toggle it.
+     *          Updates are O(1) and keep no history.
+     */
+    class AdScoreTracker {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   config   Thresholds and smoothing parameters.
+         **/
+        explicit AdScoreTracker(const AdScoreTrackerConfig& config);
+
+        /**
+         * @brief       Adds the score of the next window.
+         * @param[in]   score   Anomaly score of the window.
+         * @return      Verdict after this window.
+         **/
+        AdVerdict Update(float score);
+
+        /** @brief  Forgets every window seen, returning to Undecided. */
+        void Reset();
+
+        /** @brief  Gets the current verdict. */
+        AdVerdict GetVerdict() const;
+
+        /** @brief  Checks whether the last update changed the verdict. */
+        bool VerdictChanged() const;
+
+        /**
+         * @brief   Checks whether the verdict is far enough from the threshold
+         *          that processing more audio is not expected to change it.
+         **/
+        bool IsConfident() const;
+
+        /** @brief  Gets the smoothed score the verdict is based on. */
+        float GetScore() const;
+
+        /** @brief  Gets the mean score over all windows. */
+        float GetMeanScore() const;
+
+        /** @brief  Gets the number of windows seen. */
+        uint32_t GetWindowCount() const;
+
+    private:
+        AdScoreTrackerConfig    m_config;
+        uint32_t                m_windows{0};
+        float                   m_mean{0.f};
+        float                   m_ema{0.f};
+        AdVerdict               m_verdict{AdVerdict::Undecided};
+        bool                    m_changed{false};
+    };
+
+    /**
+     * @brief       Gets a printable name for a verdict.
+     * @param[in]   verdict   Verdict.
+     * @return      Name of the verdict.
+     **/
+    const char* AdVerdictName(AdVerdict verdict);
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* AD_SCORE_TRACKER_HPP */
@@ -18,6 +18,9 @@
 #define MELSPECTROGRAM_HPP
 
 #include "PlatformMath.hpp"
+#include "AudioUtils.hpp"
+#include "FixedPointFeatures.hpp"
+#include "DspTables.hpp"
 
 #include <vector>
 #include <cstdint>
@@ -65,12 +68,19 @@ namespace audio {
         /**
         * @brief        Extract Mel Spectrogram for one single small frame of
         *               audio data e.g. 640 samples.
-        * @param[in]    audioData       Vector of audio samples to calculate
-        *               features for.
+        * @param[in]    audioData       View of the audio samples to calculate
+        *               features for, e.g. a sliding window. A shorter frame
+        *               is padded with zeros.
         * @param[in]    trainingMean    Value to subtract from the the computed mel spectrogram, default 0.
         * @return       Vector of extracted Mel Spectrogram features.
         **/
-        std::vector<float> ComputeMelSpec(const std::vector<int16_t>& audioData, float trainingMean = 0);
+        std::vector<float> ComputeMelSpec(Span<const int16_t> audioData, float trainingMean = 0);
+
+        /** @brief  As above, for a vector of audio samples. */
+        std::vector<float> ComputeMelSpec(const std::vector<int16_t>& audioData, float trainingMean = 0)
+        {
+            return this->ComputeMelSpec(Span<const int16_t>(audioData.data(), audioData.size()), trainingMean);
+        }
 
         /**
          * @brief       Constructor
@@ -84,10 +94,18 @@ namespace audio {
         /** @brief  Initialise */
         void Init();
 
+        /**
+         * @brief       Creates an integer only version of this Mel Spectrogram,
+         *              with its window and Mel filter bank quantised to q15.
+         *              The training mean is given to its SetQuantisation.
+         * @return      Fixed point feature extractor.
+         **/
+        FixedPointFeatures MakeFixedPoint();
+
         /**
          * @brief        Extract Mel Spectrogram features and quantise for one single small
          *               frame of audio data e.g. 640 samples.
-         * @param[in]    audioData      Vector of audio samples to calculate
+         * @param[in]    audioData      View of the audio samples to calculate
          *               features for.
          * @param[in]    quantScale     quantisation scale.
          * @param[in]    quantOffset    quantisation offset.
@@ -95,7 +113,7 @@ namespace audio {
          * @return       Vector of extracted quantised Mel Spectrogram features.
          **/
         template<typename T>
-        std::vector<T> MelSpecComputeQuant(const std::vector<int16_t>& audioData,
+        std::vector<T> MelSpecComputeQuant(Span<const int16_t> audioData,
                                            const float quantScale,
                                            const int quantOffset,
                                            float trainingMean = 0)
@@ -116,6 +134,17 @@ namespace audio {
             return melSpecOut;
         }
 
+        /** @brief  As above, for a vector of audio samples. */
+        template<typename T>
+        std::vector<T> MelSpecComputeQuant(const std::vector<int16_t>& audioData,
+                                           const float quantScale,
+                                           const int quantOffset,
+                                           float trainingMean = 0)
+        {
+            return this->MelSpecComputeQuant<T>(Span<const int16_t>(audioData.data(), audioData.size()),
+                                                quantScale, quantOffset, trainingMean);
+        }
+
         /* Constants */
         static constexpr float ms_logStep = /*logf(6.4)*/ 1.8562979903656 / 27.0;
         static constexpr float ms_freqStep = 200.0 / 3;
@@ -148,24 +177,19 @@ namespace audio {
          * @brief       Populates MEL energies after applying the MEL filter
          *              bank weights and adding them up to be placed into
          *              bins, according to the filter bank's first and last
-         *              indices (pre-computed for each filter bank element
-         *              by CreateMelFilterBank function).
-         * @param[in]   fftVec                  Vector populated with FFT magnitudes
-         * @param[in]   melFilterBank           2D Vector with filter bank weights
-         * @param[in]   filterBankFilterFirst   Vector containing the first indices of filter bank
-         *                                      to be used for each bin.
-         * @param[in]   filterBankFilterLast    Vector containing the last indices of filter bank
-         *                                      to be used for each bin.
-         * @param[out]  melEnergies             Pre-allocated vector of MEL energies to be
-         *                                      populated.
+         *              indices.
+         * @param[in]   fftVec        Vector populated with FFT magnitudes
+         * @param[in]   tables        Tables holding the filter bank weights
+         *                            and the first and last FFT bin of each
+         *                            Mel bin.
+         * @param[out]  melEnergies   Pre-allocated vector of MEL energies to be
+         *                            populated.
          * @return      true if successful, false otherwise
          */
         virtual bool ApplyMelFilterBank(
-                std::vector<float>&                 fftVec,
-                std::vector<std::vector<float>>&    melFilterBank,
-                std::vector<uint32_t>&               filterBankFilterFirst,
-                std::vector<uint32_t>&               filterBankFilterLast,
-                std::vector<float>&                 melEnergies);
+                std::vector<float>&     fftVec,
+                const MelTables&        tables,
+                std::vector<float>&     melEnergies);
 
         /**
          * @brief           Converts the Mel energies for logarithmic scale
@@ -189,20 +213,43 @@ namespace audio {
                 const float&   rightMel,
                 const bool     useHTKMethod);
 
+        /**
+         * @brief       Describes ApplyMelFilterBank and ConvertToLogarithmicScale
+         *              to the fixed point version. Classes overriding those should
+         *              override this as well.
+         * @return      Fixed point feature parameters.
+         */
+        virtual FixedPointFeatureParams GetFixedPointParams() const;
+
+        /**
+         * @brief       Gets tables computed at compile time, see ConstMelTables.
+         *              They are used when computed for this instance's
+         *              parameters, and in place of GetMelFilterBankNormaliser,
+         *              so must match it. Otherwise the tables are computed
+         *              at run time.
+         * @return      Pointer to the tables, or nullptr if there are none.
+         */
+        virtual const MelTables* GetPrecomputedTables() const;
+
     private:
         MelSpecParams                   m_params;
         std::vector<float>              m_frame;
         std::vector<float>              m_buffer;
         std::vector<float>              m_melEnergies;
-        std::vector<float>              m_windowFunc;
-        std::vector<std::vector<float>> m_melFilterBank;
+        const MelTables*                m_precomputedTables{nullptr};
+        std::vector<float>              m_windowFunc;   /* Run time tables, when not precomputed */
+        std::vector<float>              m_melWeights;
+        std::vector<uint32_t>            m_melWeightsStart;
         std::vector<uint32_t>            m_filterBankFilterFirst;
         std::vector<uint32_t>            m_filterBankFilterLast;
         bool                            m_filterBankInitialised;
         arm::app::math::FftInstance     m_fftInstance;
+        std::vector<math::float16>      m_frameF16;     /* Only used with FEATURE_EXTRACTION_F16 */
+        std::vector<math::float16>      m_bufferF16;
+        arm::app::math::FftInstanceF16  m_fftInstanceF16;
 
         /**
-         * @brief       Initialises the filter banks.
+         * @brief       Initialises the window and filter banks.
          **/
         void InitMelFilterBank();
 
@@ -214,10 +261,16 @@ namespace audio {
         bool IsMelFilterBankInited() const;
 
         /**
-         * @brief       Create mel filter banks for Mel Spectrogram calculation.
-         * @return      2D vector of floats
+         * @brief       Create mel filter banks for Mel Spectrogram calculation,
+         *              into m_melWeights and the indices alongside.
          **/
-        std::vector<std::vector<float>> CreateMelFilterBank();
+        void CreateMelFilterBank();
+
+        /** @brief  Gets the parameters the tables are computed for. */
+        MelTableParams TableParams() const;
+
+        /** @brief  Gets the tables in use, precomputed or not. */
+        MelTables Tables() const;
 
         /**
          * @brief       Computes the magnitude from an interleaved complex array
@@ -25,26 +25,23 @@ namespace app {
 namespace audio {
 
     bool AdMelSpectrogram::ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&               filterBankFilterFirst,
-            std::vector<uint32_t>&               filterBankFilterLast,
-            std::vector<float>&                 melEnergies)
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies)
     {
         const size_t numBanks = melEnergies.size();
 
-        if (numBanks != filterBankFilterFirst.size() ||
-            numBanks != filterBankFilterLast.size()) {
+        if (numBanks != tables.m_params.m_numFbankBins) {
             printf_err("unexpected filter bank lengths\n");
             return false;
         }
 
         for (size_t bin = 0; bin < numBanks; ++bin) {
-            auto filterBankIter = melFilterBank[bin].begin();
-            auto end = melFilterBank[bin].end();
+            const float* filterBankIter = tables.m_weights + tables.m_weightsStart[bin];
+            const float* end = tables.m_weights + tables.m_weightsStart[bin + 1];
             float melEnergy = FLT_MIN; /* Avoid log of zero at later stages. */
-            const uint32_t firstIndex = filterBankFilterFirst[bin];
-            const uint32_t lastIndex = std::min<int32_t>(filterBankFilterLast[bin], fftVec.size() - 1);
+            const uint32_t firstIndex = tables.m_filterFirst[bin];
+            const uint32_t lastIndex = std::min<int32_t>(tables.m_filterLast[bin], fftVec.size() - 1);
 
             for (uint32_t i = firstIndex; i <= lastIndex && filterBankIter != end; ++i) {
                 melEnergy += (*filterBankIter++ * fftVec[i]);
@@ -88,6 +85,24 @@ namespace audio {
                         AdMelSpectrogram::InverseMelScale(leftMel, useHTKMethod)));
     }
 
+    FixedPointFeatureParams AdMelSpectrogram::GetFixedPointParams() const
+    {
+        FixedPointFeatureParams params;
+        params.m_usePower = true;
+        params.m_logMultiplier = 10.0 * 0.4342944819032518; /* 10 * log10f(std::exp(1.0)) */
+        return params;
+    }
+
+    const MelTables* AdMelSpectrogram::GetPrecomputedTables() const
+    {
+        using Tables = ConstMelTables<ms_defaultSamplingFreq, ms_defaultNumFbankBins,
+                                      ms_defaultMelLoFreq, ms_defaultMelHiFreq,
+                                      0, ms_defaultFrameLen,
+                                      ms_defaultUseHtkMethod,
+                                      MelNormalisation::slaney, DctType::none>;
+        return &Tables::ms_tables;
+    }
+
 } /* namespace audio */
 } /* namespace app */
 } /* namespace arm */
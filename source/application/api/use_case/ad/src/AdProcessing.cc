@@ -18,6 +18,9 @@
 
 #include "AdModel.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace arm {
 namespace app {
 
@@ -63,7 +66,7 @@ AdPreProcess::AdPreProcess(TfLiteTensor* inputTensor,
 
     /* Creating a Mel Spectrogram sliding window for the data required for 1 inference.
      * "resizing" done here by multiplying stride by resize scale. */
-    this->m_melWindowSlider = audio::SlidingWindow<const int16_t>(
+    this->m_melWindowSlider = audio::WindowView<const int16_t>(
             nullptr, /* to be populated later. */
             this->m_audioDataWindowSize,
             melSpectrogramFrameLen,
@@ -99,13 +102,10 @@ bool AdPreProcess::DoPreProcess(const void* input, size_t inputSize)
 
     /* Start calculating features inside one audio sliding window. */
     while (this->m_melWindowSlider.HasNext()) {
-        const int16_t* melSpecWindow = this->m_melWindowSlider.Next();
-        std::vector<int16_t> melSpecAudioData = std::vector<int16_t>(
-                melSpecWindow,
-                melSpecWindow + this->m_melSpectrogramFrameLen);
+        const auto melSpecWindow = this->m_melWindowSlider.Next();
 
         /* Compute features for this window and write them to input tensor. */
-        this->m_featureCalc(melSpecAudioData,
+        this->m_featureCalc(melSpecWindow,
                             this->m_melWindowSlider.Index(),
                             useCache,
                             this->m_numMelSpecVectorsInAudioStride,
@@ -136,6 +136,10 @@ AdPostProcess::AdPostProcess(TfLiteTensor* outputTensor) :
 
 bool AdPostProcess::DoPostProcess()
 {
+    if (this->m_monitoredIndex >= 0) {
+        return this->MonitoredSoftmax();
+    }
+
     switch (this->m_outputTensor->type) {
         case kTfLiteInt8:
             this->Dequantize<int8_t>();
@@ -154,17 +158,61 @@ float AdPostProcess::GetOutputValue(uint32_t index)
     if (index < this->m_dequantizedOutputVec.size()) {
         return this->m_dequantizedOutputVec[index];
     }
+    if (this->m_monitoredIndex >= 0 && index == static_cast<uint32_t>(this->m_monitoredIndex)) {
+        return this->m_monitoredValue;
+    }
     printf_err("Invalid index for output\n");
     return 0.0;
 }
 
-std::function<void (std::vector<int16_t>&, int, bool, size_t, size_t)>
+bool AdPostProcess::SetMonitoredIndex(uint32_t index)
+{
+    TfLiteTensor* tensor = this->m_outputTensor;
+    if (tensor == nullptr || tensor->type != kTfLiteInt8) {
+        printf_err("Unsupported output tensor\n");
+        return false;
+    }
+
+    if (index >= tensor->bytes) {
+        printf_err("Invalid index for output\n");
+        return false;
+    }
+
+    /* The softmax is taken relative to the largest output, so the quantised
+     * difference to it is in [0, 255] and its exponential can be tabulated. */
+    const float scale = GetTensorQuantParams(tensor).scale;
+    this->m_expTable.resize(256);
+    for (size_t n = 0; n < this->m_expTable.size(); ++n) {
+        this->m_expTable[n] = std::exp(-scale * n);
+    }
+
+    this->m_monitoredIndex = index;
+    this->m_dequantizedOutputVec.clear();
+    return true;
+}
+
+bool AdPostProcess::MonitoredSoftmax()
+{
+    const int8_t* data = tflite::GetTensorData<int8_t>(this->m_outputTensor);
+    const size_t size = this->m_outputTensor->bytes;
+
+    const int32_t maxVal = *std::max_element(data, data + size);
+    float sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        sum += this->m_expTable[maxVal - data[i]];
+    }
+
+    this->m_monitoredValue = this->m_expTable[maxVal - data[this->m_monitoredIndex]] / sum;
+    return true;
+}
+
+std::function<void (audio::Span<const int16_t>, int, bool, size_t, size_t)>
 GetFeatureCalculator(audio::AdMelSpectrogram& melSpec,
                      TfLiteTensor* inputTensor,
                      size_t cacheSize,
                      float trainingMean)
 {
-    std::function<void (std::vector<int16_t>&, size_t, bool, size_t, size_t)> melSpecFeatureCalc = nullptr;
+    std::function<void (audio::Span<const int16_t>, size_t, bool, size_t, size_t)> melSpecFeatureCalc = nullptr;
 
     TfLiteQuantization quant = inputTensor->quantization;
 
@@ -179,7 +227,7 @@ GetFeatureCalculator(audio::AdMelSpectrogram& melSpec,
                 melSpecFeatureCalc = FeatureCalc<int8_t>(
                         inputTensor,
                         cacheSize,
-                        [=, &melSpec](std::vector<int16_t>& audioDataWindow) {
+                        [=, &melSpec](audio::Span<const int16_t> audioDataWindow) {
                             return melSpec.MelSpecComputeQuant<int8_t>(
                                     audioDataWindow,
                                     quantScale,
@@ -197,7 +245,7 @@ GetFeatureCalculator(audio::AdMelSpectrogram& melSpec,
                 inputTensor,
                 cacheSize,
                 [=, &melSpec](
-                        std::vector<int16_t>& audioDataWindow) {
+                        audio::Span<const int16_t> audioDataWindow) {
                     return melSpec.ComputeMelSpec(
                             audioDataWindow,
                             trainingMean);
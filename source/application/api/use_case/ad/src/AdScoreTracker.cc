@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AdScoreTracker.hpp"
+
+#include <cmath>
+
+namespace arm {
+namespace app {
+
+    AdScoreTracker::AdScoreTracker(const AdScoreTrackerConfig& config)
+    :   m_config{config}
+    {
+        if (this->m_config.minWindows == 0) {
+            this->m_config.minWindows = 1;
+        }
+        if (this->m_config.hysteresis < 0) {
+            this->m_config.hysteresis = 0;
+        }
+    }
+
+    AdVerdict AdScoreTracker::Update(float score)
+    {
+        ++this->m_windows;
+        this->m_mean += (score - this->m_mean) / this->m_windows;
+        this->m_ema = this->m_windows == 1 ? score :
+                      this->m_ema + this->m_config.emaAlpha * (score - this->m_ema);
+
+        this->m_changed = false;
+        if (this->m_windows < this->m_config.minWindows) {
+            return this->m_verdict;
+        }
+
+        const float smoothed = this->GetScore();
+        AdVerdict verdict = this->m_verdict;
+        if (smoothed > this->m_config.threshold + this->m_config.hysteresis) {
+            verdict = AdVerdict::Anomaly;
+        } else if (smoothed <= this->m_config.threshold - this->m_config.hysteresis) {
+            verdict = AdVerdict::Normal;
+        }
+
+        this->m_changed = verdict != this->m_verdict;
+        this->m_verdict = verdict;
+        return verdict;
+    }
+
+    void AdScoreTracker::Reset()
+    {
+        this->m_windows = 0;
+        this->m_mean = 0.f;
+        this->m_ema = 0.f;
+        this->m_verdict = AdVerdict::Undecided;
+        this->m_changed = false;
+    }
+
+    AdVerdict AdScoreTracker::GetVerdict() const
+    {
+        return this->m_verdict;
+    }
+
+    bool AdScoreTracker::VerdictChanged() const
+    {
+        return this->m_changed;
+    }
+
+    bool AdScoreTracker::IsConfident() const
+    {
+        return this->m_config.confidenceMargin >= 0 &&
+               this->m_verdict != AdVerdict::Undecided &&
+               std::fabs(this->GetScore() - this->m_config.threshold) >= this->m_config.confidenceMargin;
+    }
+
+    float AdScoreTracker::GetScore() const
+    {
+        return this->m_config.emaAlpha > 0 ? this->m_ema : this->m_mean;
+    }
+
+    float AdScoreTracker::GetMeanScore() const
+    {
+        return this->m_mean;
+    }
+
+    uint32_t AdScoreTracker::GetWindowCount() const
+    {
+        return this->m_windows;
+    }
+
+    const char* AdVerdictName(AdVerdict verdict)
+    {
+        switch (verdict) {
+            case AdVerdict::Normal:
+                return "normal";
+            case AdVerdict::Anomaly:
+                return "anomaly";
+            default:
+                return "undecided";
+        }
+    }
+
+} /* namespace app */
+} /* namespace arm */
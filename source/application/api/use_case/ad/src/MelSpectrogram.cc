@@ -72,16 +72,13 @@ namespace audio {
         this->m_melEnergies = std::vector<float>(
                 this->m_params.m_numFbankBins, 0.0);
 
-        this->m_windowFunc = std::vector<float>(this->m_params.m_frameLen);
-        const auto multiplier = static_cast<float>(2 * M_PI / this->m_params.m_frameLen);
-
-        /* Create window function. */
-        for (size_t i = 0; i < this->m_params.m_frameLen; ++i) {
-            this->m_windowFunc[i] = (0.5 - (0.5 *
-                                             math::MathUtils::CosineF32(static_cast<float>(i) * multiplier)));
-        }
-
+#if FEATURE_EXTRACTION_F16
+        this->m_frameF16 = std::vector<math::float16>(this->m_params.m_frameLenPadded, 0);
+        this->m_bufferF16 = std::vector<math::float16>(this->m_params.m_frameLenPadded, 0);
+        math::MathUtils::FftInitF16(this->m_params.m_frameLenPadded, this->m_fftInstanceF16);
+#else /* FEATURE_EXTRACTION_F16 */
         math::MathUtils::FftInitF32(this->m_params.m_frameLenPadded, this->m_fftInstance);
+#endif /* FEATURE_EXTRACTION_F16 */
         debug("Instantiated Mel Spectrogram object: %s\n", this->m_params.Str().c_str());
     }
 
@@ -121,26 +118,23 @@ namespace audio {
     }
 
     bool MelSpectrogram::ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&               filterBankFilterFirst,
-            std::vector<uint32_t>&               filterBankFilterLast,
-            std::vector<float>&                 melEnergies)
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies)
     {
         const size_t numBanks = melEnergies.size();
 
-        if (numBanks != filterBankFilterFirst.size() ||
-            numBanks != filterBankFilterLast.size()) {
+        if (numBanks != tables.m_params.m_numFbankBins) {
             printf_err("unexpected filter bank lengths\n");
             return false;
         }
 
         for (size_t bin = 0; bin < numBanks; ++bin) {
-            auto filterBankIter = melFilterBank[bin].begin();
-            auto end = melFilterBank[bin].end();
+            const float* filterBankIter = tables.m_weights + tables.m_weightsStart[bin];
+            const float* end = tables.m_weights + tables.m_weightsStart[bin + 1];
             float melEnergy = FLT_MIN; /* Avoid log of zero at later stages */
-            const uint32_t firstIndex = filterBankFilterFirst[bin];
-            const uint32_t lastIndex = std::min<int32_t>(filterBankFilterLast[bin], fftVec.size() - 1);
+            const uint32_t firstIndex = tables.m_filterFirst[bin];
+            const uint32_t lastIndex = std::min<int32_t>(tables.m_filterLast[bin], fftVec.size() - 1);
 
             for (uint32_t i = firstIndex; i <= lastIndex && filterBankIter != end; ++i) {
                 float energyRep = math::MathUtils::SqrtF32(fftVec[i]);
@@ -189,12 +183,74 @@ namespace audio {
         return 1.f;
     }
 
+    FixedPointFeatureParams MelSpectrogram::GetFixedPointParams() const
+    {
+        /* Magnitude spectrum and natural logs, see ApplyMelFilterBank. */
+        return FixedPointFeatureParams{};
+    }
+
+    const MelTables* MelSpectrogram::GetPrecomputedTables() const
+    {
+        return nullptr;
+    }
+
+    FixedPointFeatures MelSpectrogram::MakeFixedPoint()
+    {
+        this->InitMelFilterBank();
+        return FixedPointFeatures(this->Tables(), this->GetFixedPointParams());
+    }
+
+    MelTableParams MelSpectrogram::TableParams() const
+    {
+        return MelTableParams{this->m_params.m_samplingFreq,
+                              this->m_params.m_numFbankBins,
+                              this->m_params.m_melLoFreq,
+                              this->m_params.m_melHiFreq,
+                              0,
+                              this->m_params.m_frameLen,
+                              this->m_params.m_frameLenPadded,
+                              this->m_params.m_useHtkMethod};
+    }
+
+    MelTables MelSpectrogram::Tables() const
+    {
+        if (this->m_precomputedTables) {
+            return *this->m_precomputedTables;
+        }
+        return MelTables{this->TableParams(),
+                         this->m_windowFunc.data(),
+                         this->m_melWeights.data(),
+                         this->m_melWeightsStart.data(),
+                         this->m_filterBankFilterFirst.data(),
+                         this->m_filterBankFilterLast.data(),
+                         nullptr};
+    }
+
     void MelSpectrogram::InitMelFilterBank()
     {
-        if (!this->IsMelFilterBankInited()) {
-            this->m_melFilterBank = this->CreateMelFilterBank();
-            this->m_filterBankInitialised = true;
+        if (this->IsMelFilterBankInited()) {
+            return;
+        }
+        this->m_filterBankInitialised = true;
+
+        /* Tables from flash if there are some for these parameters. */
+        const MelTables* precomputed = this->GetPrecomputedTables();
+        if (precomputed && precomputed->m_params == this->TableParams()) {
+            this->m_precomputedTables = precomputed;
+            debug("Using precomputed Mel Spectrogram tables\n");
+            return;
         }
+
+        this->m_windowFunc = std::vector<float>(this->m_params.m_frameLen);
+        const auto multiplier = static_cast<float>(2 * M_PI / this->m_params.m_frameLen);
+
+        /* Create window function. */
+        for (size_t i = 0; i < this->m_params.m_frameLen; ++i) {
+            this->m_windowFunc[i] = (0.5 - (0.5 *
+                                             math::MathUtils::CosineF32(static_cast<float>(i) * multiplier)));
+        }
+
+        this->CreateMelFilterBank();
     }
 
     bool MelSpectrogram::IsMelFilterBankInited() const
@@ -202,35 +258,45 @@ namespace audio {
         return this->m_filterBankInitialised;
     }
 
-    std::vector<float> MelSpectrogram::ComputeMelSpec(const std::vector<int16_t>& audioData, float trainingMean)
+    std::vector<float> MelSpectrogram::ComputeMelSpec(Span<const int16_t> audioData, float trainingMean)
     {
         this->InitMelFilterBank();
+        const MelTables tables = this->Tables();
 
         /* TensorFlow way of normalizing .wav data to (-1, 1). */
         constexpr float normaliser = 1.0/(1<<15);
-        for (size_t i = 0; i < this->m_params.m_frameLen; ++i) {
+        const size_t numSamples = std::min<size_t>(audioData.size(), this->m_params.m_frameLen);
+        for (size_t i = 0; i < numSamples; ++i) {
             this->m_frame[i] = static_cast<float>(audioData[i]) * normaliser;
         }
 
         /* Apply window function to input frame. */
-        for(size_t i = 0; i < this->m_params.m_frameLen; ++i) {
-            this->m_frame[i] *= this->m_windowFunc[i];
+        for(size_t i = 0; i < numSamples; ++i) {
+            this->m_frame[i] *= tables.m_window[i];
         }
 
         /* Set remaining frame values to 0. */
-        std::fill(this->m_frame.begin() + this->m_params.m_frameLen,this->m_frame.end(), 0);
+        std::fill(this->m_frame.begin() + numSamples,this->m_frame.end(), 0);
 
         /* Compute FFT. */
+#if FEATURE_EXTRACTION_F16
+        /* In half precision, and back to float32 for the power spectrum,
+         * which would overflow it. */
+        math::MathUtils::VecConvertF32ToF16(this->m_frame.data(), this->m_frameF16.data(),
+                                            this->m_frameF16.size());
+        math::MathUtils::FftF16(this->m_frameF16, this->m_bufferF16, this->m_fftInstanceF16);
+        math::MathUtils::VecConvertF16ToF32(this->m_bufferF16.data(), this->m_buffer.data(),
+                                            this->m_buffer.size());
+#else /* FEATURE_EXTRACTION_F16 */
         math::MathUtils::FftF32(this->m_frame, this->m_buffer, this->m_fftInstance);
+#endif /* FEATURE_EXTRACTION_F16 */
 
         /* Convert to power spectrum. */
         this->ConvertToPowerSpectrum();
 
         /* Apply mel filterbanks. */
         if (!this->ApplyMelFilterBank(this->m_buffer,
-                                      this->m_melFilterBank,
-                                      this->m_filterBankFilterFirst,
-                                      this->m_filterBankFilterLast,
+                                      tables,
                                       this->m_melEnergies)) {
             printf_err("Failed to apply MEL filter banks\n");
         }
@@ -246,7 +312,7 @@ namespace audio {
         return this->m_melEnergies;
     }
 
-    std::vector<std::vector<float>> MelSpectrogram::CreateMelFilterBank()
+    void MelSpectrogram::CreateMelFilterBank()
     {
         size_t numFftBins = this->m_params.m_frameLenPadded / 2;
         float fftBinWidth = static_cast<float>(this->m_params.m_samplingFreq) / this->m_params.m_frameLenPadded;
@@ -258,8 +324,8 @@ namespace audio {
         float melFreqDelta = (melHighFreq - melLowFreq) / (this->m_params.m_numFbankBins + 1);
 
         std::vector<float> thisBin = std::vector<float>(numFftBins);
-        std::vector<std::vector<float>> melFilterBank(
-                this->m_params.m_numFbankBins);
+        this->m_melWeights.clear();
+        this->m_melWeightsStart = std::vector<uint32_t>(1, 0);
         this->m_filterBankFilterFirst =
                 std::vector<uint32_t>(this->m_params.m_numFbankBins);
         this->m_filterBankFilterLast =
@@ -302,11 +368,10 @@ namespace audio {
 
             /* Copy the part we care about. */
             for (uint32_t i = firstIndex; i <= lastIndex; ++i) {
-                melFilterBank[bin].push_back(thisBin[i]);
+                this->m_melWeights.push_back(thisBin[i]);
             }
+            this->m_melWeightsStart.push_back(this->m_melWeights.size());
         }
-
-        return melFilterBank;
     }
 
 } /* namespace audio */
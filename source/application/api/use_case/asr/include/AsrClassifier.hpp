@@ -30,14 +30,14 @@ namespace app {
          * @param[in]   outputTensor   Inference output tensor from an NN model.
          * @param[out]  vecResults     A vector of classification results
          *                             populated by this function.
-         * @param[in]   labels         Labels vector to match classified classes
+         * @param[in]   labels         Label table to match classified classes
          * @param[in]   topNCount      Number of top classifications to pick.
          * @param[in]   use_softmax    Whether softmax scaling should be applied to model output.
          * @return      true if successful, false otherwise.
          **/
         bool GetClassificationResults(TfLiteTensor* outputTensor,
                                       std::vector<ClassificationResult>& vecResults,
-                                      const std::vector<std::string>& labels,
+                                      const LabelTable& labels,
                                       uint32_t topNCount, bool use_softmax = false) override;
 
     private:
@@ -46,7 +46,7 @@ namespace app {
          *              output tensor (vector of vector).
          * @param[in]   tensor       Inference output tensor from an NN model.
          * @param[out]  vecResults   Vector of classification results populated by this function.
-         * @param[in]   labels       Labels vector to match classified classes.
+         * @param[in]   labels       Label table to match classified classes.
          * @param[in]   scale        Quantization scale.
          * @param[in]   zeroPoint    Quantization zero point.
          * @return      true if successful, false otherwise.
@@ -54,7 +54,7 @@ namespace app {
         template<typename T>
         bool GetTopResults(TfLiteTensor* tensor,
                            std::vector<ClassificationResult>& vecResults,
-                           const std::vector<std::string>& labels, double scale, double zeroPoint);
+                           const LabelTable& labels, double scale, double zeroPoint);
     };
 
 } /* namespace app */
@@ -19,6 +19,7 @@
 
 #include "ClassificationResult.hpp"
 
+#include <string>
 #include <vector>
 
 namespace arm {
@@ -56,6 +57,13 @@ namespace asr {
         ~AsrResult() = default;
     };
 
+    /* Text decoded from the output of a single ASR inference. */
+    struct AsrTextResult {
+        std::string     m_text;             /* Decoded text. */
+        float           m_timeStamp;        /* Audio timestamp for this result. */
+        uint32_t        m_inferenceNumber;  /* Corresponding inference number. */
+    };
+
 } /* namespace asr */
 } /* namespace app */
 } /* namespace arm */
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ASR_CTC_GREEDY_DECODER_HPP
+#define ASR_CTC_GREEDY_DECODER_HPP
+
+#include "LabelTable.hpp"
+#include "TensorFlowLiteMicro.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace asr {
+
+    /** A token emitted by the CTC decoder. */
+    struct CtcToken {
+        uint16_t    m_tokenId  = 0;     /* Index of the token's label. */
+        int8_t      m_maxLogit = 0;     /* Largest quantised logit over the token's frames. */
+        uint32_t    m_frameIdx = 0;     /* Output row at which the token starts. */
+    };
+
+    /**
+     * @brief   CTC greedy decoder for int8 model outputs. Takes the argmax of
+     *          each output row and collapses repeated and blank tokens on
+     *          their IDs, writing tokens into a caller provided buffer.
+     *          Turning tokens into text is a separate, optional step.
+     *          The last token is kept between calls, so consecutive output
+     *          windows decode as one stream until Reset() is called.
+     *          Rows scoring below an optional threshold are skipped before
+     *          collapsing, so the rows either side of them can merge.
+     */
+    class CtcGreedyDecoder {
+    public:
+        /**
+         * @brief     Constructor.
+         * @param[in] numClasses      Number of classes in each output row.
+         * @param[in] blankTokenIdx   Index of the CTC blank token.
+         */
+        CtcGreedyDecoder(uint32_t numClasses, uint32_t blankTokenIdx);
+
+        /**
+         * @brief       Decodes rows of int8 logits.
+         * @param[in]   logits      Row-major logits, rows x numClasses.
+         * @param[in]   rows        Number of rows.
+         * @param[out]  tokens      Buffer for the decoded tokens.
+         * @param[in]   maxTokens   Capacity of the token buffer. Tokens that
+         *                          do not fit are dropped.
+         * @return      Number of tokens written.
+         */
+        size_t Decode(const int8_t* logits, uint32_t rows, CtcToken* tokens, size_t maxTokens);
+
+        /**
+         * @brief       Decodes an int8 output tensor of a CTC model.
+         * @param[in]   outputTensor   Output tensor, numClasses in the innermost
+         *                             dimension.
+         * @param[out]  tokens         Buffer for the decoded tokens.
+         * @param[in]   maxTokens      Capacity of the token buffer.
+         * @param[out]  numTokens      Number of tokens written.
+         * @return      true if successful, false otherwise.
+         */
+        bool Decode(const TfLiteTensor* outputTensor, CtcToken* tokens, size_t maxTokens,
+                    size_t& numTokens);
+
+        /** @brief  Starts a new stream, forgetting the last token seen. */
+        void Reset();
+
+        /**
+         * @brief       Sets the lowest score a row's best class needs for the row
+         *              to be decoded. Lower scoring rows are skipped as if absent.
+         *              By default no rows are skipped.
+         * @param[in]   threshold     Lowest score kept.
+         * @param[in]   quantParams   Quantisation parameters of the output tensor.
+         */
+        void SetScoreThreshold(float threshold, const QuantParams& quantParams);
+
+        /**
+         * @brief       Gets the score of a token, the dequantised value of
+         *              its largest logit.
+         * @param[in]   token         Decoded token.
+         * @param[in]   quantParams   Quantisation parameters of the output tensor.
+         * @return      Token score.
+         */
+        static float GetTokenScore(const CtcToken& token, const QuantParams& quantParams);
+
+        /**
+         * @brief       Writes the labels of tokens as a null terminated string.
+         * @param[in]   tokens      Decoded tokens.
+         * @param[in]   numTokens   Number of tokens.
+         * @param[in]   labels      Labels indexed by token ID.
+         * @param[out]  text        Output buffer. Text that does not fit is cut short.
+         * @param[in]   textSize    Size of the output buffer, in bytes.
+         * @return      Number of characters written, excluding the terminator.
+         */
+        static size_t TokensToText(const CtcToken* tokens, size_t numTokens,
+                                   const LabelTable& labels, char* text, size_t textSize);
+
+    private:
+        uint32_t    m_numClasses;           /* Number of classes per row. */
+        uint32_t    m_blankTokenIdx;        /* CTC blank token index. */
+        uint32_t    m_prevTokenId;          /* Argmax of the last row decoded. */
+        uint32_t    m_framesDecoded = 0;    /* Rows decoded since the last reset. */
+        int16_t     m_minLogit = INT8_MIN;  /* Lowest row logit decoded; above INT8_MAX skips all. */
+    };
+
+} /* namespace asr */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* ASR_CTC_GREEDY_DECODER_HPP */
@@ -33,6 +33,10 @@ namespace audio {
         static constexpr uint32_t  ms_defaultMelHiFreq    =  8000;
         static constexpr bool      ms_defaultUseHtkMethod = false;
 
+        /* Frame the tables are computed for at compile time. */
+        static constexpr uint32_t  ms_defaultNumMfccFeats =    13;
+        static constexpr uint32_t  ms_defaultFrameLen     =   512;
+
         explicit Wav2LetterMFCC(const size_t numFeats, const size_t frameLen)
             :  MFCC(MfccParams(
                         ms_defaultSamplingFreq, ms_defaultNumFbankBins,
@@ -47,22 +51,18 @@ namespace audio {
 
         /**
          * @brief       Overrides base class implementation of this function.
-         * @param[in]   fftVec                  Vector populated with FFT magnitudes
-         * @param[in]   melFilterBank           2D Vector with filter bank weights
-         * @param[in]   filterBankFilterFirst   Vector containing the first indices of filter bank
-         *                                      to be used for each bin.
-         * @param[in]   filterBankFilterLast    Vector containing the last indices of filter bank
-         *                                      to be used for each bin.
-         * @param[out]  melEnergies             Pre-allocated vector of MEL energies to be
-         *                                      populated.
+         * @param[in]   fftVec        Vector populated with FFT magnitudes
+         * @param[in]   tables        Tables holding the filter bank weights
+         *                            and the first and last FFT bin of each
+         *                            Mel bin.
+         * @param[out]  melEnergies   Pre-allocated vector of MEL energies to be
+         *                            populated.
          * @return      true if successful, false otherwise
          */
         bool ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&              filterBankFilterFirst,
-            std::vector<uint32_t>&              filterBankFilterLast,
-            std::vector<float>&                 melEnergies) override;
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies) override;
 
         /**
          * @brief           Override for the base class implementation convert mel
@@ -100,6 +100,22 @@ namespace audio {
         float GetMelFilterBankNormaliser(const float&   leftMel,
                                          const float&   rightMel,
                                          bool     useHTKMethod) override;
+
+        /**
+         * @brief       Describes the overridden filter bank and logarithm to the
+         *              fixed point version: power spectrum, decibels clamped
+         *              to 80dB below the maximum.
+         * @return      Fixed point feature parameters.
+         */
+        FixedPointFeatureParams GetFixedPointParams() const override;
+
+        /**
+         * @brief       Gets the tables for the default parameters, computed
+         *              at compile time with the Slaney normalisation and
+         *              orthonormal DCT above.
+         * @return      Pointer to the tables.
+         */
+        const MelTables* GetPrecomputedTables() const override;
     };
 
 } /* namespace audio */
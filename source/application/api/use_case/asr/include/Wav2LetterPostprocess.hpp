@@ -46,10 +46,22 @@ namespace app {
          * @param[in]       reductionAxis      The axis that the logits of each time step is on.
          **/
         AsrPostProcess(TfLiteTensor* outputTensor, AsrClassifier& classifier,
-                       const std::vector<std::string>& labels, asr::ResultVec& result,
+                       const LabelTable& labels, asr::ResultVec& result,
                        uint32_t outputContextLen,
                        uint32_t blankTokenIdx, uint32_t reductionAxis);
 
+        /**
+         * @brief           Constructor for post-processing that only blanks out the
+         *                  output context, leaving decoding to the caller
+         *                  (e.g. a CtcGreedyDecoder).
+         * @param[in]       outputTensor       Pointer to the TFLite Micro output Tensor.
+         * @param[in]       outputContextLen   Left/right context length for output tensor.
+         * @param[in]       blankTokenIdx      Index in the labels that the "Blank token" takes.
+         * @param[in]       reductionAxis      The axis that the logits of each time step is on.
+         **/
+        AsrPostProcess(TfLiteTensor* outputTensor, uint32_t outputContextLen,
+                       uint32_t blankTokenIdx, uint32_t reductionAxis);
+
         /**
          * @brief    Should perform post-processing of the result of inference then
          *           populate ASR result data for any later use.
@@ -67,10 +79,10 @@ namespace app {
         static uint32_t GetNumFeatureVectors(const Model& model);
 
     private:
-        AsrClassifier& m_classifier;                /* ASR Classifier object. */
+        AsrClassifier* m_classifier;                /* ASR Classifier object, if classifying. */
         TfLiteTensor* m_outputTensor;               /* Model output tensor. */
-        const std::vector<std::string>& m_labels;   /* ASR Labels. */
-        asr::ResultVec & m_results;                 /* Results vector for a single inference. */
+        LabelTable m_labels;                        /* ASR Labels. */
+        asr::ResultVec* m_results;                  /* Results vector for a single inference. */
         uint32_t m_outputContextLen;                /* lengths of left/right contexts for output. */
         uint32_t m_outputInnerLen;                  /* Length of output inner context. */
         uint32_t m_totalLen;                        /* Total length of the required axis. */
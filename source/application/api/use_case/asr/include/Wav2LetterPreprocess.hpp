@@ -29,7 +29,7 @@ namespace app {
 
     /* Class to facilitate pre-processing calculation for Wav2Letter model
      * for ASR. */
-    using AudioWindow = audio::SlidingWindow<const int16_t>;
+    using AudioWindow = audio::WindowView<const int16_t>;
 
     class AsrPreProcess : public BasePreProcess {
     public:
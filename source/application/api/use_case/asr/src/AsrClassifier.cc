@@ -26,7 +26,7 @@ namespace app {
     template<typename T>
     bool AsrClassifier::GetTopResults(TfLiteTensor* tensor,
                                       std::vector<ClassificationResult>& vecResults,
-                                      const std::vector <std::string>& labels, double scale, double zeroPoint)
+                                      const LabelTable& labels, double scale, double zeroPoint)
     {
         const uint32_t nElems = tensor->dims->data[Wav2LetterModel::ms_outputRowsIdx];
         const uint32_t nLetters = tensor->dims->data[Wav2LetterModel::ms_outputColsIdx];
@@ -68,17 +68,17 @@ namespace app {
     }
     template bool AsrClassifier::GetTopResults<uint8_t>(TfLiteTensor* tensor,
                                                         std::vector<ClassificationResult>& vecResults,
-                                                        const std::vector <std::string>& labels,
+                                                        const LabelTable& labels,
                                                         double scale, double zeroPoint);
     template bool AsrClassifier::GetTopResults<int8_t>(TfLiteTensor* tensor,
                                                        std::vector<ClassificationResult>& vecResults,
-                                                       const std::vector <std::string>& labels,
+                                                       const LabelTable& labels,
                                                        double scale, double zeroPoint);
 
     bool AsrClassifier::GetClassificationResults(
             TfLiteTensor* outputTensor,
             std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels, uint32_t topNCount, bool use_softmax)
+            const LabelTable& labels, uint32_t topNCount, bool use_softmax)
     {
             UNUSED(use_softmax);
             vecResults.clear();
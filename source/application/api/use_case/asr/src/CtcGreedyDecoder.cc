@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "CtcGreedyDecoder.hpp"
+
+#include "PlatformMath.hpp"
+#include "log_macros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+namespace arm {
+namespace app {
+namespace asr {
+
+    CtcGreedyDecoder::CtcGreedyDecoder(const uint32_t numClasses, const uint32_t blankTokenIdx)
+    :   m_numClasses{numClasses},
+        m_blankTokenIdx{blankTokenIdx},
+        m_prevTokenId{blankTokenIdx}
+    {}
+
+    size_t CtcGreedyDecoder::Decode(const int8_t* logits, const uint32_t rows,
+                                    CtcToken* tokens, const size_t maxTokens)
+    {
+        if (this->m_numClasses == 0) {
+            return 0;
+        }
+
+        size_t numTokens = 0;
+        CtcToken* current = nullptr;    /* Token of the current run, if written in this call. */
+
+        for (uint32_t row = 0; row < rows; ++row, logits += this->m_numClasses) {
+            int8_t maxLogit;
+            const uint32_t tokenId = math::MathUtils::ArgMaxQ7(logits, this->m_numClasses, maxLogit);
+
+            /* Low scoring rows are skipped without ending the current run. */
+            if (maxLogit < this->m_minLogit) {
+                continue;
+            }
+
+            if (tokenId == this->m_prevTokenId) {
+                /* Repeat of the current token; keep its most confident frame. */
+                if (current && maxLogit > current->m_maxLogit) {
+                    current->m_maxLogit = maxLogit;
+                }
+                continue;
+            }
+
+            this->m_prevTokenId = tokenId;
+            current = nullptr;
+
+            if (tokenId == this->m_blankTokenIdx || numTokens == maxTokens) {
+                continue;
+            }
+
+            current = &tokens[numTokens++];
+            current->m_tokenId = static_cast<uint16_t>(tokenId);
+            current->m_maxLogit = maxLogit;
+            current->m_frameIdx = this->m_framesDecoded + row;
+        }
+
+        this->m_framesDecoded += rows;
+        return numTokens;
+    }
+
+    bool CtcGreedyDecoder::Decode(const TfLiteTensor* outputTensor, CtcToken* tokens,
+                                  const size_t maxTokens, size_t& numTokens)
+    {
+        numTokens = 0;
+
+        if (outputTensor == nullptr) {
+            printf_err("Output tensor is null pointer.\n");
+            return false;
+        } else if (outputTensor->type != kTfLiteInt8) {
+            printf_err("Tensor type %s not supported by CTC decoder\n",
+                       TfLiteTypeGetName(outputTensor->type));
+            return false;
+        } else if (outputTensor->dims->size < 1 ||
+                   static_cast<uint32_t>(outputTensor->dims->data[outputTensor->dims->size - 1]) !=
+                   this->m_numClasses) {
+            printf_err("Output tensor expected to have %" PRIu32 " classes\n", this->m_numClasses);
+            return false;
+        }
+
+        const auto rows = static_cast<uint32_t>(outputTensor->bytes / this->m_numClasses);
+        numTokens = this->Decode(tflite::GetTensorData<int8_t>(outputTensor), rows, tokens, maxTokens);
+        return true;
+    }
+
+    void CtcGreedyDecoder::Reset()
+    {
+        this->m_prevTokenId = this->m_blankTokenIdx;
+        this->m_framesDecoded = 0;
+    }
+
+    void CtcGreedyDecoder::SetScoreThreshold(const float threshold, const QuantParams& quantParams)
+    {
+        /* Lowest logit whose score reaches the threshold, matching GetTokenScore. */
+        int16_t minLogit = INT8_MIN;
+        while (minLogit <= INT8_MAX &&
+               quantParams.scale * static_cast<float>(minLogit - quantParams.offset) < threshold) {
+            ++minLogit;
+        }
+        this->m_minLogit = minLogit;
+    }
+
+    float CtcGreedyDecoder::GetTokenScore(const CtcToken& token, const QuantParams& quantParams)
+    {
+        return quantParams.scale * static_cast<float>(token.m_maxLogit - quantParams.offset);
+    }
+
+    size_t CtcGreedyDecoder::TokensToText(const CtcToken* tokens, const size_t numTokens,
+                                          const LabelTable& labels, char* text, const size_t textSize)
+    {
+        if (textSize == 0) {
+            return 0;
+        }
+
+        size_t len = 0;
+        for (size_t i = 0; i < numTokens; ++i) {
+            if (tokens[i].m_tokenId >= labels.size()) {
+                continue;
+            }
+
+            const LabelView& label = labels[tokens[i].m_tokenId];
+            const size_t copyLen = std::min(label.size(), textSize - 1 - len);
+            std::memcpy(text + len, label.data(), copyLen);
+            len += copyLen;
+
+            if (copyLen < label.size()) {
+                break;
+            }
+        }
+
+        text[len] = '\0';
+        return len;
+    }
+
+} /* namespace asr */
+} /* namespace app */
+} /* namespace arm */
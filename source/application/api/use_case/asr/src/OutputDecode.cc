@@ -34,7 +34,7 @@ namespace asr {
             }
             if (vecResults[i].m_label != "$")  /* $ is a character used to represent unknown and double characters so should not be in output. */
             {
-                CleanOutputBuffer += vecResults[i].m_label;  /* If the element is different to the next, it will be appended to CleanOutputBuffer. */
+                CleanOutputBuffer.append(vecResults[i].m_label.data(), vecResults[i].m_label.size());  /* If the element is different to the next, it will be appended to CleanOutputBuffer. */
             }
         }
 
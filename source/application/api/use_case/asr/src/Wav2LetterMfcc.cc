@@ -26,28 +26,25 @@ namespace app {
 namespace audio {
 
     bool Wav2LetterMFCC::ApplyMelFilterBank(
-            std::vector<float>&                 fftVec,
-            std::vector<std::vector<float>>&    melFilterBank,
-            std::vector<uint32_t>&               filterBankFilterFirst,
-            std::vector<uint32_t>&               filterBankFilterLast,
-            std::vector<float>&                 melEnergies)
+            std::vector<float>&     fftVec,
+            const MelTables&        tables,
+            std::vector<float>&     melEnergies)
     {
         const size_t numBanks = melEnergies.size();
 
-        if (numBanks != filterBankFilterFirst.size() ||
-                numBanks != filterBankFilterLast.size()) {
+        if (numBanks != tables.m_params.m_numFbankBins) {
             printf_err("Unexpected filter bank lengths\n");
             return false;
         }
 
         for (size_t bin = 0; bin < numBanks; ++bin) {
-            auto filterBankIter = melFilterBank[bin].begin();
-            auto end = melFilterBank[bin].end();
+            const float* filterBankIter = tables.m_weights + tables.m_weightsStart[bin];
+            const float* end = tables.m_weights + tables.m_weightsStart[bin + 1];
             /* Avoid log of zero at later stages, same value used in librosa.
              * The number was used during our default wav2letter model training. */
             float melEnergy = 1e-10;
-            const uint32_t firstIndex = filterBankFilterFirst[bin];
-            const uint32_t lastIndex = std::min<uint32_t>(filterBankFilterLast[bin], fftVec.size() - 1);
+            const uint32_t firstIndex = tables.m_filterFirst[bin];
+            const uint32_t lastIndex = std::min<uint32_t>(tables.m_filterLast[bin], fftVec.size() - 1);
 
             for (uint32_t i = firstIndex; i <= lastIndex && filterBankIter != end; ++i) {
                 melEnergy += (*filterBankIter++ * fftVec[i]);
@@ -136,6 +133,26 @@ namespace audio {
                 MFCC::InverseMelScale(leftMel, useHTKMethod)));
     }
 
+    FixedPointFeatureParams Wav2LetterMFCC::GetFixedPointParams() const
+    {
+        FixedPointFeatureParams params;
+        params.m_usePower = true;
+        params.m_logMultiplier = 10.0 * 0.4342944819032518; /* 10 * log10f(std::exp(1.0)) */
+        params.m_melFloor = 1e-10;
+        params.m_topDb = 80.0;
+        return params;
+    }
+
+    const MelTables* Wav2LetterMFCC::GetPrecomputedTables() const
+    {
+        using Tables = ConstMelTables<ms_defaultSamplingFreq, ms_defaultNumFbankBins,
+                                      ms_defaultMelLoFreq, ms_defaultMelHiFreq,
+                                      ms_defaultNumMfccFeats, ms_defaultFrameLen,
+                                      ms_defaultUseHtkMethod,
+                                      MelNormalisation::slaney, DctType::orthonormal>;
+        return &Tables::ms_tables;
+    }
+
 } /* namespace audio */
 } /* namespace app */
 } /* namespace arm */
@@ -25,14 +25,29 @@ namespace arm {
 namespace app {
 
     AsrPostProcess::AsrPostProcess(TfLiteTensor* outputTensor, AsrClassifier& classifier,
-            const std::vector<std::string>& labels, std::vector<ClassificationResult>& results,
+            const LabelTable& labels, std::vector<ClassificationResult>& results,
             const uint32_t outputContextLen,
             const uint32_t blankTokenIdx, const uint32_t reductionAxisIdx
             ):
-            m_classifier(classifier),
+            m_classifier(&classifier),
             m_outputTensor(outputTensor),
             m_labels{labels},
-            m_results(results),
+            m_results(&results),
+            m_outputContextLen(outputContextLen),
+            m_countIterations(0),
+            m_blankTokenIdx(blankTokenIdx),
+            m_reductionAxisIdx(reductionAxisIdx)
+    {
+        this->m_outputInnerLen = AsrPostProcess::GetOutputInnerLen(this->m_outputTensor, this->m_outputContextLen);
+        this->m_totalLen = (2 * this->m_outputContextLen + this->m_outputInnerLen);
+    }
+
+    AsrPostProcess::AsrPostProcess(TfLiteTensor* outputTensor, const uint32_t outputContextLen,
+            const uint32_t blankTokenIdx, const uint32_t reductionAxisIdx
+            ):
+            m_classifier(nullptr),
+            m_outputTensor(outputTensor),
+            m_results(nullptr),
             m_outputContextLen(outputContextLen),
             m_countIterations(0),
             m_blankTokenIdx(blankTokenIdx),
@@ -73,8 +88,10 @@ namespace app {
                 printf_err("Unsupported axis index: %" PRIu32 "\n", this->m_reductionAxisIdx);
                 return false;
         }
-        this->m_classifier.GetClassificationResults(this->m_outputTensor,
-                this->m_results, this->m_labels, 1);
+        if (this->m_classifier) {
+            this->m_classifier->GetClassificationResults(this->m_outputTensor,
+                    *this->m_results, this->m_labels, 1);
+        }
 
         return true;
     }
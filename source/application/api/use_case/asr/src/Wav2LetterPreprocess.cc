@@ -46,28 +46,22 @@ namespace app {
 
     bool AsrPreProcess::DoPreProcess(const void* audioData, const size_t audioDataLen)
     {
-        this->m_mfccSlidingWindow = audio::SlidingWindow<const int16_t>(
+        this->m_mfccSlidingWindow = AudioWindow(
                 static_cast<const int16_t*>(audioData), audioDataLen,
                 this->m_mfccWindowLen, this->m_mfccWindowStride);
 
-        uint32_t mfccBufIdx = 0;
-
         std::fill(m_mfccBuf.begin(), m_mfccBuf.end(), 0.f);
         std::fill(m_delta1Buf.begin(), m_delta1Buf.end(), 0.f);
         std::fill(m_delta2Buf.begin(), m_delta2Buf.end(), 0.f);
 
-        /* While we can slide over the audio. */
-        while (this->m_mfccSlidingWindow.HasNext()) {
-            const int16_t* mfccWindow = this->m_mfccSlidingWindow.Next();
-            auto mfccAudioData = std::vector<int16_t>(
-                                        mfccWindow,
-                                        mfccWindow + this->m_mfccWindowLen);
-            auto mfcc = this->m_mfcc.MfccCompute(mfccAudioData);
-            for (size_t i = 0; i < this->m_mfccBuf.size(0); ++i) {
-                this->m_mfccBuf(i, mfccBufIdx) = mfcc[i];
-            }
-            ++mfccBufIdx;
+        /* Compute the MFCCs of all the windows over the audio straight into
+         * the buffer, one column per window. */
+        const auto mfccWindows = this->m_mfccSlidingWindow.Windows(0, this->m_numFeatureFrames);
+        if (!this->m_mfcc.MfccComputeBatch(mfccWindows, this->m_mfccBuf.begin(),
+                                           this->m_mfccBuf.size(1))) {
+            return false;
         }
+        uint32_t mfccBufIdx = mfccWindows.Count();
 
         /* Pad MFCC if needed by adding MFCC for zeros. */
         if (mfccBufIdx != this->m_numFeatureFrames) {
@@ -19,6 +19,7 @@
 
 #include "BaseProcessing.hpp"
 #include "Classifier.hpp"
+#include "ImageTensorConverter.hpp"
 
 namespace arm {
 namespace app {
@@ -49,7 +50,7 @@ namespace app {
 
     private:
         TfLiteTensor* m_inputTensor;
-        bool m_convertToInt8;
+        image::ImageToTensorConverter m_converter;
     };
 
     /**
@@ -68,7 +69,7 @@ namespace app {
          * @param[in]   results       Vector of classification results to store decoded outputs.
          **/
         ImgClassPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
-                            const std::vector<std::string>& labels,
+                            const LabelTable& labels,
                             std::vector<ClassificationResult>& results);
 
         /**
@@ -81,7 +82,7 @@ namespace app {
     private:
         TfLiteTensor* m_outputTensor;
         Classifier& m_imgClassifier;
-        const std::vector<std::string>& m_labels;
+        LabelTable m_labels;
         std::vector<ClassificationResult>& m_results;
     };
 
@@ -24,7 +24,8 @@ namespace app {
 
     ImgClassPreProcess::ImgClassPreProcess(TfLiteTensor* inputTensor, bool convertToInt8)
     :m_inputTensor{inputTensor},
-     m_convertToInt8{convertToInt8}
+     m_converter{inputTensor, false,
+                 convertToInt8 ? image::PixelScaling::Centred : image::PixelScaling::Raw}
     {}
 
     bool ImgClassPreProcess::DoPreProcess(const void* data, size_t inputSize)
@@ -34,20 +35,16 @@ namespace app {
             return false;
         }
 
-        auto input = static_cast<const uint8_t*>(data);
-
-        std::memcpy(this->m_inputTensor->data.data, input, inputSize);
-        debug("Input tensor populated \n");
-
-        if (this->m_convertToInt8) {
-            image::ConvertImgToInt8(this->m_inputTensor->data.data, this->m_inputTensor->bytes);
+        if (!this->m_converter.Convert(static_cast<const uint8_t*>(data), inputSize)) {
+            return false;
         }
+        debug("Input tensor populated \n");
 
         return true;
     }
 
     ImgClassPostProcess::ImgClassPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
-                                             const std::vector<std::string>& labels,
+                                             const LabelTable& labels,
                                              std::vector<ClassificationResult>& results)
             :m_outputTensor{outputTensor},
              m_imgClassifier{classifier},
@@ -20,6 +20,7 @@
 #include "ClassificationResult.hpp"
 #include "TensorFlowLiteMicro.hpp"
 #include "Classifier.hpp"
+#include "KwsPosteriorSmoother.hpp"
 
 #include <vector>
 
@@ -40,7 +41,7 @@ namespace app {
          * @param[in]       outputTensor   Inference output tensor from an NN model.
          * @param[out]      vecResults     A vector of classification results.
          *                                 populated by this function.
-         * @param[in]       labels         Labels vector to match classified classes.
+         * @param[in]       labels         Label table to match classified classes.
          * @param[in]       topNCount      Number of top classifications to pick. Default is 1.
          * @param[in]       useSoftmax     Whether Softmax normalisation should be applied to output. Default is false.
          * @param[in/out]   resultHistory  History of previous classification results to be updated.
@@ -48,9 +49,30 @@ namespace app {
          **/
          using Classifier::GetClassificationResults;  /* We are overloading not overriding. */
          bool GetClassificationResults(TfLiteTensor* outputTensor, std::vector<ClassificationResult>& vecResults,
-                 const std::vector <std::string>& labels, uint32_t topNCount,
+                 const LabelTable& labels, uint32_t topNCount,
                  bool use_softmax, std::vector<std::vector<float>>& resultHistory);
 
+        /**
+         * @brief           Gets the top N classification results from the
+         *                  output vector, smoothing them with the given smoother.
+         *                  Scores are averaged in the integer domain: raw quantised
+         *                  values when Softmax isn't used, Q15 probabilities otherwise.
+         *                  Works in the smoother's buffers and selects the top N in
+         *                  place, so only the first call grows vecResults on the heap.
+         * @param[in]       outputTensor   Inference output tensor from an NN model.
+         * @param[out]      vecResults     A vector of classification results.
+         *                                 populated by this function.
+         * @param[in]       labels         Label table to match classified classes.
+         * @param[in]       topNCount      Number of top classifications to pick.
+         * @param[in]       useSoftmax     Whether Softmax normalisation should be applied to output.
+         *                                 Float output tensors require Softmax to be applied.
+         * @param[in/out]   smoother       Posterior smoother holding the history of previous results.
+         * @return          true if successful, false otherwise.
+         **/
+         bool GetClassificationResults(TfLiteTensor* outputTensor, std::vector<ClassificationResult>& vecResults,
+                 const LabelTable& labels, uint32_t topNCount,
+                 bool useSoftmax, KwsPosteriorSmoother& smoother);
+
         /**
          * @brief        Average the given history of results.
          * @param[in]    resultHistory   The history of results to take on average of.
@@ -58,6 +80,19 @@ namespace app {
          **/
          static void AveragResults(const std::vector<std::vector<float>>& resultHistory,
                  std::vector<float>& averageResult);
+
+    private:
+        /**
+         * @brief        Picks the top N scores by insertion into vecResults, without
+         *               the temporary set GetTopNResults builds.
+         * @param[in]    scores       Scores for each class.
+         * @param[out]   vecResults   Resized to topNCount and populated, highest first.
+         * @param[in]    topNCount    Number of top classifications to pick.
+         * @param[in]    labels       Label table to match classified classes.
+         **/
+         static void SelectTopN(const std::vector<float>& scores,
+                 std::vector<ClassificationResult>& vecResults, uint32_t topNCount,
+                 const LabelTable& labels);
     };
 
 } /* namespace app */
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef KWS_POSTERIOR_SMOOTHER_HPP
+#define KWS_POSTERIOR_SMOOTHER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Smooths per-class KWS posteriors across consecutive inferences.
+     *
+     *          Scores are held as 16-bit integers (either the raw quantised output
+     *          values or Q15 probabilities) in a fixed circular buffer, and a 32-bit
+     *          running sum is kept for each class. Every update adds the newest score
+     *          and subtracts the one dropping out of the window, so the cost does not
+     *          depend on the window length. Alternatively, an exponential moving
+     *          average can be used in which case no history is stored at all.
+     *
+     *          All memory is allocated at construction time; Update() and
+     *          GetSmoothed() do not touch the heap.
+     **/
+    class KwsPosteriorSmoother {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   numClasses   Number of classes (model outputs) to smooth.
+         * @param[in]   windowLen    Number of inferences to average over for the moving
+         *                           average. 0 and 1 both mean no averaging.
+         * @param[in]   emaAlpha     Weight (0, 1] given to the newest score when an
+         *                           exponential moving average is wanted instead of the
+         *                           windowed one. 0 selects the windowed moving average.
+         **/
+        explicit KwsPosteriorSmoother(size_t numClasses, size_t windowLen = 1, float emaAlpha = 0.f);
+
+        /** @brief  Clears the history and running sums. */
+        void Reset();
+
+        /**
+         * @brief       Adds a new set of scores to the smoother.
+         * @param[in]   scores   Pointer to NumClasses() integer scores.
+         **/
+        void Update(const int16_t* scores);
+
+        /**
+         * @brief       Gets the smoothed score for each class, mapped back to the
+         *              real domain as: scale * (smoothed - offset).
+         * @param[out]  output   Vector to populate; must hold NumClasses() elements.
+         * @param[in]   scale    Scale of the integer scores.
+         * @param[in]   offset   Zero point of the integer scores.
+         * @return      true if successful, false otherwise.
+         **/
+        bool GetSmoothed(std::vector<float>& output, float scale, int offset) const;
+
+        /**
+         * @brief       Gets the raw running sum for one class. For the windowed mode this
+         *              is the sum over the window, for the exponential mode it is the
+         *              average with 8 fractional bits.
+         * @param[in]   classIdx   Class index.
+         * @return      The running sum.
+         **/
+        int32_t GetRunningSum(size_t classIdx) const;
+
+        /** @brief  Gets the number of classes this smoother was created for. */
+        size_t NumClasses() const;
+
+        /** @brief  Gets the averaging window length (1 for the exponential mode). */
+        size_t WindowLen() const;
+
+        /** @brief  Checks if the exponential moving average is in use. */
+        bool IsExponential() const;
+
+        /**
+         * @brief   Gets the pre-allocated integer scratch buffer holding NumClasses()
+         *          elements. Callers can write new scores here before Update().
+         **/
+        int16_t* GetScoreBuffer();
+
+        /**
+         * @brief   Gets the pre-allocated float scratch buffer holding NumClasses()
+         *          elements, for callers to de-quantise into and read results from.
+         **/
+        std::vector<float>& GetFloatBuffer();
+
+    private:
+        size_t                  m_numClasses;       /* Number of classes. */
+        size_t                  m_windowLen;        /* Moving average window length. */
+        size_t                  m_head{0};          /* Slot in the history holding the oldest scores. */
+        int32_t                 m_emaAlphaQ15{0};   /* EMA weight in Q15; 0 when disabled. */
+        std::vector<int16_t>    m_history;          /* Circular buffer of m_windowLen x m_numClasses scores. */
+        std::vector<int32_t>    m_runningSum;       /* Per-class sum over window (or EMA with 8 fractional bits). */
+        std::vector<int16_t>    m_scoreBuffer;      /* Scratch for incoming integer scores. */
+        std::vector<float>      m_floatBuffer;      /* Scratch for de-quantised scores. */
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* KWS_POSTERIOR_SMOOTHER_HPP */
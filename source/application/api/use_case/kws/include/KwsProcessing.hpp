@@ -23,6 +23,7 @@
 #include "MicroNetKwsMfcc.hpp"
 
 #include <functional>
+#include <memory>
 
 namespace arm {
 namespace app {
@@ -57,6 +58,23 @@ namespace app {
          **/
         bool DoPreProcess(const void* input, size_t inferenceIndex = 0) override;
 
+        /**
+         * @brief       Marks the cached MFCC features as stale, so that the next call to
+         *              DoPreProcess computes all features from scratch. Must be called when
+         *              one or more audio strides have been skipped (e.g. on silence) as the
+         *              cached features no longer overlap with the next window.
+         **/
+        void InvalidateFeatureCache();
+
+        /**
+         * @brief       Selects the integer only MFCC path, which writes int8
+         *              features straight from a q31 FFT and q15 filter bank and
+         *              DCT, or the floating point one quantised at the end.
+         * @param[in]   enable   true for fixed point features.
+         * @return      true if successful, false if the input tensor is not int8.
+         **/
+        bool UseFixedPointFeatures(bool enable);
+
         size_t m_audioDataWindowSize;   /* Amount of audio needed for 1 inference. */
         size_t m_audioDataStride;       /* Amount of audio to stride across if doing >1 inference in longer clips. */
 
@@ -67,10 +85,13 @@ namespace app {
         const size_t m_numMfccFrames;   /* How many sets of m_numMfccFeats. */
 
         audio::MicroNetKwsMFCC m_mfcc;
-        audio::SlidingWindow<const int16_t> m_mfccSlidingWindow;
+        std::unique_ptr<audio::FixedPointFeatures> m_fixedPointMfcc;
+        bool m_useFixedPoint{false};
+        audio::WindowView<const int16_t> m_mfccSlidingWindow;
         size_t m_numMfccVectorsInAudioStride;
         size_t m_numReusedMfccVectors;
-        std::function<void (std::vector<int16_t>&, int, bool, size_t)> m_mfccFeatureCalculator;
+        bool m_featureCacheValid{true};
+        std::function<void (audio::Span<const int16_t>, int, bool, size_t)> m_mfccFeatureCalculator;
 
         /**
          * @brief Returns a function to perform feature calculation and populates input tensor data with
@@ -86,15 +107,15 @@ namespace app {
          * @param[in]       cacheSize     Size of the feature vectors cache (number of feature vectors).
          * @return          Function to be called providing audio sample and sliding window index.
          */
-        std::function<void (std::vector<int16_t>&, int, bool, size_t)>
+        std::function<void (audio::Span<const int16_t>, int, bool, size_t)>
         GetFeatureCalculator(audio::MicroNetKwsMFCC&  mfcc,
                              TfLiteTensor*            inputTensor,
                              size_t                   cacheSize);
 
         template<class T>
-        std::function<void (std::vector<int16_t>&, size_t, bool, size_t)>
+        std::function<void (audio::Span<const int16_t>, size_t, bool, size_t)>
         FeatureCalc(TfLiteTensor* inputTensor, size_t cacheSize,
-                    std::function<std::vector<T> (std::vector<int16_t>& )> compute);
+                    std::function<const std::vector<T>& (audio::Span<const int16_t>)> compute);
     };
 
     /**
@@ -107,9 +128,9 @@ namespace app {
     private:
         TfLiteTensor* m_outputTensor;                      /* Model output tensor. */
         KwsClassifier& m_kwsClassifier;                    /* KWS Classifier object. */
-        const std::vector<std::string>& m_labels;          /* KWS Labels. */
+        LabelTable m_labels;                               /* KWS Labels. */
         std::vector<ClassificationResult>& m_results;      /* Results vector for a single inference. */
-        std::vector<std::vector<float>> m_resultHistory;   /* Store previous results so they can be averaged. */
+        KwsPosteriorSmoother m_smoother;                   /* Smooths results across inferences. */
     public:
         /**
          * @brief           Constructor
@@ -117,10 +138,14 @@ namespace app {
          * @param[in]       classifier     Classifier object used to get top N results from classification.
          * @param[in]       labels         Vector of string labels to identify each output of the model.
          * @param[in/out]   results        Vector of classification results to store decoded outputs.
+         * @param[in]       averagingWindowLen   Number of inferences the results are averaged over.
+         * @param[in]       emaAlpha       If non-zero, an exponential moving average with this
+         *                                 weight for the newest result is used instead.
          **/
         KwsPostProcess(TfLiteTensor* outputTensor, KwsClassifier& classifier,
-                       const std::vector<std::string>& labels,
-                       std::vector<ClassificationResult>& results, size_t averagingWindowLen = 1);
+                       const LabelTable& labels,
+                       std::vector<ClassificationResult>& results, size_t averagingWindowLen = 1,
+                       float emaAlpha = 0.f);
 
         /**
          * @brief    Should perform post-processing of the result of inference then
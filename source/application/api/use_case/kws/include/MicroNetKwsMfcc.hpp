@@ -33,6 +33,10 @@ namespace audio {
         static constexpr uint32_t  ms_defaultMelHiFreq    =  4000;
         static constexpr bool      ms_defaultUseHtkMethod =  true;
 
+        /* Frame the tables are computed for at compile time. */
+        static constexpr uint32_t  ms_defaultNumMfccFeats =    10;
+        static constexpr uint32_t  ms_defaultFrameLen     =   640;
+
         explicit MicroNetKwsMFCC(const size_t numFeats, const size_t frameLen)
             :  MFCC(MfccParams(
                         ms_defaultSamplingFreq, ms_defaultNumFbankBins,
@@ -41,6 +45,22 @@ namespace audio {
         {}
         MicroNetKwsMFCC()  = delete;
         ~MicroNetKwsMFCC() = default;
+
+    protected:
+        /**
+         * @brief       Gets the tables for the default parameters, computed
+         *              at compile time.
+         * @return      Pointer to the tables.
+         */
+        const MelTables* GetPrecomputedTables() const override
+        {
+            using Tables = ConstMelTables<ms_defaultSamplingFreq, ms_defaultNumFbankBins,
+                                          ms_defaultMelLoFreq, ms_defaultMelHiFreq,
+                                          ms_defaultNumMfccFeats, ms_defaultFrameLen,
+                                          ms_defaultUseHtkMethod,
+                                          MelNormalisation::none, DctType::scaled>;
+            return &Tables::ms_tables;
+        }
     };
 
 } /* namespace audio */
@@ -34,7 +34,7 @@ namespace arm {
 namespace app {
 
     bool KwsClassifier::GetClassificationResults(TfLiteTensor* outputTensor,
-            std::vector<ClassificationResult>& vecResults, const std::vector <std::string>& labels,
+            std::vector<ClassificationResult>& vecResults, const LabelTable& labels,
             uint32_t topNCount, bool useSoftmax, std::vector<std::vector<float>>& resultHistory)
     {
         if (outputTensor == nullptr) {
@@ -124,6 +124,120 @@ namespace app {
         return true;
     }
 
+    bool KwsClassifier::GetClassificationResults(TfLiteTensor* outputTensor,
+            std::vector<ClassificationResult>& vecResults, const LabelTable& labels,
+            uint32_t topNCount, bool useSoftmax, KwsPosteriorSmoother& smoother)
+    {
+        if (outputTensor == nullptr) {
+            printf_err("Output vector is null pointer.\n");
+            return false;
+        }
+
+        uint32_t totalOutputSize = 1;
+        for (int inputDim = 0; inputDim < outputTensor->dims->size; inputDim++) {
+            totalOutputSize *= outputTensor->dims->data[inputDim];
+        }
+
+        /* Sanity checks. */
+        if (totalOutputSize < topNCount) {
+            printf_err("Output vector is smaller than %" PRIu32 "\n", topNCount);
+            return false;
+        } else if (totalOutputSize != labels.size()) {
+            printf_err("Output size doesn't match the labels' size\n");
+            return false;
+        } else if (totalOutputSize != smoother.NumClasses()) {
+            printf_err("Output size doesn't match the smoother's size\n");
+            return false;
+        } else if (topNCount == 0) {
+            printf_err("Top N results cannot be zero\n");
+            return false;
+        } else if (outputTensor->type == kTfLiteFloat32 && !useSoftmax) {
+            printf_err("Float output can only be smoothed after Softmax\n");
+            return false;
+        }
+
+        QuantParams quantParams = GetTensorQuantParams(outputTensor);
+        std::vector<float>& resultData = smoother.GetFloatBuffer();
+        int16_t* scores = smoother.GetScoreBuffer();
+
+        /* Without Softmax the raw quantised values are smoothed directly, offset by the
+         * zero point so that an empty history stands for a score of zero. */
+        switch (outputTensor->type) {
+            case kTfLiteUInt8: {
+                uint8_t* tensor_buffer = tflite::GetTensorData<uint8_t>(outputTensor);
+                for (size_t i = 0; i < totalOutputSize; ++i) {
+                    scores[i] = static_cast<int16_t>(tensor_buffer[i] - quantParams.offset);
+                }
+                break;
+            }
+            case kTfLiteInt8: {
+                int8_t* tensor_buffer = tflite::GetTensorData<int8_t>(outputTensor);
+                for (size_t i = 0; i < totalOutputSize; ++i) {
+                    scores[i] = static_cast<int16_t>(tensor_buffer[i] - quantParams.offset);
+                }
+                break;
+            }
+            case kTfLiteFloat32: {
+                float* tensor_buffer = tflite::GetTensorData<float>(outputTensor);
+                std::copy(tensor_buffer, tensor_buffer + totalOutputSize, resultData.begin());
+                break;
+            }
+            default:
+                printf_err("Tensor type %s not supported by classifier\n",
+                    TfLiteTypeGetName(outputTensor->type));
+                return false;
+        }
+
+        float scoreScale = quantParams.scale;
+        if (useSoftmax) {
+            if (outputTensor->type != kTfLiteFloat32) {
+                for (size_t i = 0; i < totalOutputSize; ++i) {
+                    resultData[i] = quantParams.scale * static_cast<float>(scores[i]);
+                }
+            }
+            math::MathUtils::SoftmaxF32(resultData);
+
+            /* Probabilities are smoothed as Q15. */
+            constexpr float q15One = static_cast<float>(INT16_MAX);
+            for (size_t i = 0; i < totalOutputSize; ++i) {
+                scores[i] = static_cast<int16_t>(resultData[i] * q15One + 0.5f);
+            }
+            scoreScale = 1.f / q15One;
+        }
+
+        smoother.Update(scores);
+        if (!smoother.GetSmoothed(resultData, scoreScale, 0)) {
+            return false;
+        }
+
+        SelectTopN(resultData, vecResults, topNCount, labels);
+        return true;
+    }
+
+    void KwsClassifier::SelectTopN(const std::vector<float>& scores,
+            std::vector<ClassificationResult>& vecResults, uint32_t topNCount,
+            const LabelTable& labels)
+    {
+        /* Keeps vecResults sorted, highest first, while scanning the scores once. Resizing
+         * reuses the vector's capacity, so only the first call allocates. */
+        vecResults.resize(topNCount);
+        uint32_t filled = 0;
+        for (uint32_t i = 0; i < scores.size(); ++i) {
+            const float score = scores[i];
+            if (filled == topNCount && score <= vecResults[filled - 1].m_normalisedVal) {
+                continue;
+            }
+
+            uint32_t pos = filled < topNCount ? filled++ : topNCount - 1;
+            for (; pos > 0 && vecResults[pos - 1].m_normalisedVal < score; --pos) {
+                vecResults[pos] = vecResults[pos - 1];
+            }
+            vecResults[pos].m_normalisedVal = score;
+            vecResults[pos].m_label = labels[i];
+            vecResults[pos].m_labelIdx = i;
+        }
+    }
+
     void app::KwsClassifier::AveragResults(const std::vector<std::vector<float>>& resultHistory,
             std::vector<float>& averageResult)
     {
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "KwsPosteriorSmoother.hpp"
+#include "log_macros.h"
+
+#include <algorithm>
+
+namespace arm {
+namespace app {
+
+    /* Fractional bits kept by the exponential moving average. */
+    static constexpr int ms_emaFracBits = 8;
+
+    KwsPosteriorSmoother::KwsPosteriorSmoother(size_t numClasses, size_t windowLen, float emaAlpha)
+    :   m_numClasses{numClasses},
+        m_windowLen{std::max<size_t>(windowLen, 1)},
+        m_runningSum(numClasses, 0),
+        m_scoreBuffer(numClasses, 0),
+        m_floatBuffer(numClasses, 0.f)
+    {
+        if (emaAlpha > 0.f) {
+            const float alpha = std::min(emaAlpha, 1.f);
+            this->m_emaAlphaQ15 = static_cast<int32_t>(alpha * (1 << 15) + 0.5f);
+            this->m_windowLen = 1;
+        } else {
+            this->m_history = std::vector<int16_t>(this->m_windowLen * numClasses, 0);
+        }
+    }
+
+    void KwsPosteriorSmoother::Reset()
+    {
+        std::fill(this->m_history.begin(), this->m_history.end(), 0);
+        std::fill(this->m_runningSum.begin(), this->m_runningSum.end(), 0);
+        this->m_head = 0;
+    }
+
+    void KwsPosteriorSmoother::Update(const int16_t* scores)
+    {
+        if (this->m_emaAlphaQ15 > 0) {
+            for (size_t i = 0; i < this->m_numClasses; ++i) {
+                const int32_t target = static_cast<int32_t>(scores[i]) * (1 << ms_emaFracBits);
+                const int64_t delta = static_cast<int64_t>(target - this->m_runningSum[i]) * this->m_emaAlphaQ15;
+                this->m_runningSum[i] += static_cast<int32_t>(delta / (1 << 15));
+            }
+            return;
+        }
+
+        /* Overwrite the oldest slot, adjusting the sums by the difference. */
+        int16_t* oldest = this->m_history.data() + this->m_head * this->m_numClasses;
+        for (size_t i = 0; i < this->m_numClasses; ++i) {
+            this->m_runningSum[i] += static_cast<int32_t>(scores[i]) - oldest[i];
+            oldest[i] = scores[i];
+        }
+
+        if (++this->m_head == this->m_windowLen) {
+            this->m_head = 0;
+        }
+    }
+
+    bool KwsPosteriorSmoother::GetSmoothed(std::vector<float>& output, float scale, int offset) const
+    {
+        if (output.size() < this->m_numClasses) {
+            printf_err("Output vector too small for %zu classes\n", this->m_numClasses);
+            return false;
+        }
+
+        const float divisor = (this->m_emaAlphaQ15 > 0) ?
+                static_cast<float>(1 << ms_emaFracBits) : static_cast<float>(this->m_windowLen);
+        const float sumScale = scale / divisor;
+        const float sumOffset = scale * static_cast<float>(offset);
+
+        for (size_t i = 0; i < this->m_numClasses; ++i) {
+            output[i] = sumScale * static_cast<float>(this->m_runningSum[i]) - sumOffset;
+        }
+        return true;
+    }
+
+    int32_t KwsPosteriorSmoother::GetRunningSum(size_t classIdx) const
+    {
+        return this->m_runningSum[classIdx];
+    }
+
+    size_t KwsPosteriorSmoother::NumClasses() const
+    {
+        return this->m_numClasses;
+    }
+
+    size_t KwsPosteriorSmoother::WindowLen() const
+    {
+        return this->m_windowLen;
+    }
+
+    bool KwsPosteriorSmoother::IsExponential() const
+    {
+        return this->m_emaAlphaQ15 > 0;
+    }
+
+    int16_t* KwsPosteriorSmoother::GetScoreBuffer()
+    {
+        return this->m_scoreBuffer.data();
+    }
+
+    std::vector<float>& KwsPosteriorSmoother::GetFloatBuffer()
+    {
+        return this->m_floatBuffer;
+    }
+
+} /* namespace app */
+} /* namespace arm */
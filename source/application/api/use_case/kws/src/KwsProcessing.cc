@@ -18,6 +18,8 @@
 #include "log_macros.h"
 #include "MicroNetKwsModel.hpp"
 
+#include <memory>
+
 namespace arm {
 namespace app {
 
@@ -37,7 +39,7 @@ namespace app {
                 (this->m_mfccFrameLength - this->m_mfccFrameStride);
 
         /* Creating an MFCC feature sliding window for the data required for 1 inference. */
-        this->m_mfccSlidingWindow = audio::SlidingWindow<const int16_t>(nullptr, this->m_audioDataWindowSize,
+        this->m_mfccSlidingWindow = audio::WindowView<const int16_t>(nullptr, this->m_audioDataWindowSize,
                 this->m_mfccFrameLength, this->m_mfccFrameStride);
 
         /* For longer audio clips we choose to move by half the audio window size
@@ -54,7 +56,7 @@ namespace app {
 
         /* Calculate number of the feature vectors in the window overlap region.
          * These feature vectors will be reused.*/
-        this->m_numReusedMfccVectors = this->m_mfccSlidingWindow.TotalStrides() + 1
+        this->m_numReusedMfccVectors = this->m_mfccSlidingWindow.NumWindows()
                 - this->m_numMfccVectorsInAudioStride;
 
         /* Construct feature calculation function. */
@@ -76,18 +78,17 @@ namespace app {
         auto input = static_cast<const int16_t*>(data);
         this->m_mfccSlidingWindow.Reset(input);
 
-        /* Cache is only usable if we have more than 1 inference to do and it's not the first inference. */
-        bool useCache = inferenceIndex > 0 && this->m_numReusedMfccVectors > 0;
+        /* Cache is only usable if we have more than 1 inference to do, it's not the first inference
+         * and no audio has been skipped since the previous one. */
+        bool useCache = inferenceIndex > 0 && this->m_numReusedMfccVectors > 0 && this->m_featureCacheValid;
+        this->m_featureCacheValid = true;
 
         /* Use a sliding window to calculate MFCC features frame by frame. */
         while (this->m_mfccSlidingWindow.HasNext()) {
-            const int16_t* mfccWindow = this->m_mfccSlidingWindow.Next();
-
-            std::vector<int16_t> mfccFrameAudioData = std::vector<int16_t>(mfccWindow,
-                    mfccWindow + this->m_mfccFrameLength);
+            const auto mfccWindow = this->m_mfccSlidingWindow.Next();
 
             /* Compute features for this window and write them to input tensor. */
-            this->m_mfccFeatureCalculator(mfccFrameAudioData, this->m_mfccSlidingWindow.Index(),
+            this->m_mfccFeatureCalculator(mfccWindow, this->m_mfccSlidingWindow.Index(),
                                           useCache, this->m_numMfccVectorsInAudioStride);
         }
 
@@ -96,6 +97,27 @@ namespace app {
         return true;
     }
 
+    void KwsPreProcess::InvalidateFeatureCache()
+    {
+        this->m_featureCacheValid = false;
+    }
+
+    bool KwsPreProcess::UseFixedPointFeatures(const bool enable)
+    {
+        if (enable && this->m_inputTensor->type != kTfLiteInt8) {
+            printf_err("Fixed point features need an int8 input tensor\n");
+            return false;
+        }
+
+        this->m_useFixedPoint = enable;
+        this->m_mfccFeatureCalculator = GetFeatureCalculator(this->m_mfcc, this->m_inputTensor,
+                                                             this->m_numReusedMfccVectors);
+
+        /* Cached features may come from the other path. */
+        this->InvalidateFeatureCache();
+        return this->m_mfccFeatureCalculator != nullptr;
+    }
+
     /**
      * @brief Generic feature calculator factory.
      *
@@ -106,58 +128,60 @@ namespace app {
      * @tparam T                Feature vector type.
      * @param[in] inputTensor   Model input tensor pointer.
      * @param[in] cacheSize     Number of feature vectors to cache. Defined by the sliding window overlap.
-     * @param[in] compute       Features calculator function.
+     * @param[in] compute       Features calculator function. The returned vector only needs to stay
+     *                          valid until the next call, so it can be a buffer owned by the calculator.
      * @return                  Lambda function to compute features.
      */
     template<class T>
-    std::function<void (std::vector<int16_t>&, size_t, bool, size_t)>
+    std::function<void (audio::Span<const int16_t>, size_t, bool, size_t)>
     KwsPreProcess::FeatureCalc(TfLiteTensor* inputTensor, size_t cacheSize,
-                               std::function<std::vector<T> (std::vector<int16_t>& )> compute)
+                               std::function<const std::vector<T>& (audio::Span<const int16_t>)> compute)
     {
-        /* Feature cache to be captured by lambda function. */
-        static std::vector<std::vector<T>> featureCache = std::vector<std::vector<T>>(cacheSize);
+        /* Feature cache to be captured by lambda function. Owned by this pre-processor,
+         * so independent pipelines don't share it. */
+        auto featureCache = std::make_shared<std::vector<std::vector<T>>>(cacheSize);
 
-        return [=](std::vector<int16_t>& audioDataWindow,
+        return [=](audio::Span<const int16_t> audioDataWindow,
                    size_t index,
                    bool useCache,
                    size_t featuresOverlapIndex)
         {
             T* tensorData = tflite::GetTensorData<T>(inputTensor);
-            std::vector<T> features;
 
             /* Reuse features from cache if cache is ready and sliding windows overlap.
              * Overlap is in the beginning of sliding window with a size of a feature cache. */
-            if (useCache && index < featureCache.size()) {
-                features = std::move(featureCache[index]);
-            } else {
-                features = std::move(compute(audioDataWindow));
-            }
+            const std::vector<T>& features = (useCache && index < featureCache->size()) ?
+                (*featureCache)[index] : compute(audioDataWindow);
             auto size = features.size();
             auto sizeBytes = sizeof(T) * size;
             std::memcpy(tensorData + (index * size), features.data(), sizeBytes);
 
-            /* Start renewing cache as soon iteration goes out of the windows overlap. */
+            /* Start renewing cache as soon iteration goes out of the windows overlap.
+             * Copying into the cache entry reuses its storage once it has been filled. */
             if (index >= featuresOverlapIndex) {
-                featureCache[index - featuresOverlapIndex] = std::move(features);
+                auto& cached = (*featureCache)[index - featuresOverlapIndex];
+                if (&cached != &features) {
+                    cached.assign(features.begin(), features.end());
+                }
             }
         };
     }
 
-    template std::function<void (std::vector<int16_t>&, size_t , bool, size_t)>
+    template std::function<void (audio::Span<const int16_t>, size_t , bool, size_t)>
     KwsPreProcess::FeatureCalc<int8_t>(TfLiteTensor* inputTensor,
                                        size_t cacheSize,
-                                       std::function<std::vector<int8_t> (std::vector<int16_t>&)> compute);
+                                       std::function<const std::vector<int8_t>& (audio::Span<const int16_t>)> compute);
 
-    template std::function<void(std::vector<int16_t>&, size_t, bool, size_t)>
+    template std::function<void(audio::Span<const int16_t>, size_t, bool, size_t)>
     KwsPreProcess::FeatureCalc<float>(TfLiteTensor* inputTensor,
                                       size_t cacheSize,
-                                      std::function<std::vector<float>(std::vector<int16_t>&)> compute);
+                                      std::function<const std::vector<float>& (audio::Span<const int16_t>)> compute);
 
 
-    std::function<void (std::vector<int16_t>&, int, bool, size_t)>
+    std::function<void (audio::Span<const int16_t>, int, bool, size_t)>
     KwsPreProcess::GetFeatureCalculator(audio::MicroNetKwsMFCC& mfcc, TfLiteTensor* inputTensor, size_t cacheSize)
     {
-        std::function<void (std::vector<int16_t>&, size_t, bool, size_t)> mfccFeatureCalc = nullptr;
+        std::function<void (audio::Span<const int16_t>, size_t, bool, size_t)> mfccFeatureCalc = nullptr;
 
         TfLiteQuantization quant = inputTensor->quantization;
 
@@ -168,12 +192,33 @@ namespace app {
 
             switch (inputTensor->type) {
                 case kTfLiteInt8: {
+                    if (this->m_useFixedPoint) {
+                        if (!this->m_fixedPointMfcc) {
+                            this->m_fixedPointMfcc.reset(new audio::FixedPointFeatures(mfcc.MakeFixedPoint()));
+                        }
+                        if (!this->m_fixedPointMfcc->SetQuantisation(quantScale, quantOffset)) {
+                            break;
+                        }
+
+                        audio::FixedPointFeatures* fixedPoint = this->m_fixedPointMfcc.get();
+                        mfccFeatureCalc = this->FeatureCalc<int8_t>(inputTensor,
+                                                              cacheSize,
+                                                              [fixedPoint](audio::Span<const int16_t> audioDataWindow)
+                                                                      -> const std::vector<int8_t>& {
+                                                                  return fixedPoint->ComputeQuant<int8_t>(audioDataWindow);
+                                                              }
+                        );
+                        break;
+                    }
+                    auto features = std::make_shared<std::vector<int8_t>>();
                     mfccFeatureCalc = this->FeatureCalc<int8_t>(inputTensor,
                                                           cacheSize,
-                                                          [=, &mfcc](std::vector<int16_t>& audioDataWindow) {
-                                                              return mfcc.MfccComputeQuant<int8_t>(audioDataWindow,
-                                                                                                   quantScale,
-                                                                                                   quantOffset);
+                                                          [=, &mfcc](audio::Span<const int16_t> audioDataWindow)
+                                                                  -> const std::vector<int8_t>& {
+                                                              *features = mfcc.MfccComputeQuant<int8_t>(audioDataWindow,
+                                                                                                        quantScale,
+                                                                                                        quantOffset);
+                                                              return *features;
                                                           }
                     );
                     break;
@@ -182,30 +227,32 @@ namespace app {
                 printf_err("Tensor type %s not supported\n", TfLiteTypeGetName(inputTensor->type));
             }
         } else {
+            auto features = std::make_shared<std::vector<float>>();
             mfccFeatureCalc = this->FeatureCalc<float>(inputTensor, cacheSize,
-                    [&mfcc](std::vector<int16_t>& audioDataWindow) {
-                return mfcc.MfccCompute(audioDataWindow); }
+                    [features, &mfcc](audio::Span<const int16_t> audioDataWindow) -> const std::vector<float>& {
+                *features = mfcc.MfccCompute(audioDataWindow);
+                return *features; }
                 );
         }
         return mfccFeatureCalc;
     }
 
     KwsPostProcess::KwsPostProcess(TfLiteTensor* outputTensor, KwsClassifier& classifier,
-                                   const std::vector<std::string>& labels,
-                                   std::vector<ClassificationResult>& results, size_t averagingWindowLen)
+                                   const LabelTable& labels,
+                                   std::vector<ClassificationResult>& results, size_t averagingWindowLen,
+                                   float emaAlpha)
             :m_outputTensor{outputTensor},
              m_kwsClassifier{classifier},
              m_labels{labels},
-             m_results{results}
-    {
-        this->m_resultHistory = {averagingWindowLen, std::vector<float>(labels.size())};
-    }
+             m_results{results},
+             m_smoother{labels.size(), averagingWindowLen, emaAlpha}
+    {}
 
     bool KwsPostProcess::DoPostProcess()
     {
         return this->m_kwsClassifier.GetClassificationResults(
                 this->m_outputTensor, this->m_results,
-                this->m_labels, 1, true, this->m_resultHistory);
+                this->m_labels, 1, true, this->m_smoother);
     }
 
 } /* namespace app */
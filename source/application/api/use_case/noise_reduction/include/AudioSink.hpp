@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AUDIO_SINK_HPP
+#define AUDIO_SINK_HPP
+
+#include "SpscRing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Destination for denoised audio, written a frame at a time so
+     *          clips of any length go out in constant memory.
+     */
+    class AudioSink {
+    public:
+        virtual ~AudioSink() = default;
+
+        /**
+         * @brief       Starts a new clip.
+         * @param[in]   name         Name of the input clip.
+         * @param[in]   numSamples   Number of samples that will be written.
+         * @return      true if successful, false otherwise.
+         **/
+        virtual bool Begin(const char* name, size_t numSamples) = 0;
+
+        /**
+         * @brief       Appends samples to the current clip.
+         * @param[in]   samples      Audio samples.
+         * @param[in]   numSamples   Number of samples.
+         * @return      true if successful, false otherwise.
+         **/
+        virtual bool Write(const int16_t* samples, size_t numSamples) = 0;
+
+        /**
+         * @brief   Finishes the current clip, flushing anything buffered.
+         * @return  true if successful, false otherwise.
+         **/
+        virtual bool End() = 0;
+    };
+
+    /** A block of the denoised audio stream, as passed through a RingAudioSink. */
+    template<size_t ChunkBytes>
+    struct AudioChunk {
+        uint32_t m_sequence;            /* Running count of chunks, to spot dropped ones. */
+        uint32_t m_numBytes;            /* Bytes of m_data in use. */
+        uint8_t  m_data[ChunkBytes];
+    };
+
+    /**
+     * @brief   Sink streaming the denoised audio, in the memory dump format read
+     *          by rnnoise_dump_extractor.py, through a ring of fixed-size chunks.
+     *          The ring lives in memory the caller provides, for example the
+     *          MEM_DUMP_BASE_ADDR region, and is drained by whatever consumes
+     *          the stream (another core, a debugger script or a transport task),
+     *          so the output is no longer capped by the size of the region.
+     *          Chunks are never waited for: if the ring is full the chunk is
+     *          dropped and counted, and the gap shows in the sequence numbers.
+     *
+     *          In memory the ring is laid out as follows, all fields 32-bit
+     *          little endian and offsets in bytes from the start of the ring:
+     *            0     head, the count of chunks pushed
+     *            4     count of chunks dropped because the ring was full
+     *            32    tail, the count of chunks popped by the consumer
+     *            36    consumer doorbell flag
+     *            64    NumChunks chunks of (8 + ChunkBytes) bytes, each
+     *                  { m_sequence, m_numBytes, m_data[ChunkBytes] }
+     *          Chunks tail to head - 1 (modulo NumChunks) are pending. A
+     *          consumer copies them out and then stores the new tail; for a
+     *          memory dump, rnnoise_dump_extractor.py --ring reads them and
+     *          joins their payloads back into the flat dump format.
+     *
+     * @tparam  ChunkBytes  Payload bytes per chunk.
+     * @tparam  NumChunks   Number of chunks in the ring; a power of two.
+     */
+    template<size_t ChunkBytes, uint32_t NumChunks>
+    class RingAudioSink : public AudioSink {
+    public:
+        using Chunk = AudioChunk<ChunkBytes>;
+        using Ring = SpscRing<Chunk, NumChunks>;
+
+        /**
+         * @brief       Constructor.
+         * @param[in]   ring   Ring to push the chunks to.
+         **/
+        explicit RingAudioSink(Ring& ring)
+        :   m_ring{ring}
+        {
+            this->m_chunk.m_numBytes = 0;
+        }
+
+        bool Begin(const char* name, const size_t numSamples) override
+        {
+            const auto nameLength = static_cast<int32_t>(std::strlen(name));
+            const auto dumpSizeBytes = static_cast<int32_t>(numSamples * sizeof(int16_t));
+            this->Append(&nameLength, sizeof(nameLength));
+            this->Append(name, nameLength);
+            this->Append(&dumpSizeBytes, sizeof(dumpSizeBytes));
+            return true;
+        }
+
+        bool Write(const int16_t* samples, const size_t numSamples) override
+        {
+            this->Append(samples, numSamples * sizeof(int16_t));
+            return true;
+        }
+
+        bool End() override
+        {
+            this->Flush();
+            return true;
+        }
+
+        /** @brief  Gets the number of chunks dropped because the ring was full. */
+        uint32_t GetDroppedCount() const
+        {
+            return this->m_ring.GetDroppedCount();
+        }
+
+    private:
+        Ring&       m_ring;
+        Chunk       m_chunk;            /* Chunk being filled. */
+        uint32_t    m_sequence{0};
+
+        void Append(const void* data, size_t bytes)
+        {
+            auto src = static_cast<const uint8_t*>(data);
+            while (bytes > 0) {
+                const size_t toCopy = std::min(bytes, ChunkBytes - this->m_chunk.m_numBytes);
+                std::memcpy(this->m_chunk.m_data + this->m_chunk.m_numBytes, src, toCopy);
+                this->m_chunk.m_numBytes += toCopy;
+                src += toCopy;
+                bytes -= toCopy;
+                if (this->m_chunk.m_numBytes == ChunkBytes) {
+                    this->Flush();
+                }
+            }
+        }
+
+        void Flush()
+        {
+            if (this->m_chunk.m_numBytes == 0) {
+                return;
+            }
+            this->m_chunk.m_sequence = this->m_sequence++;
+            this->m_ring.TryPush(this->m_chunk);
+            this->m_chunk.m_numBytes = 0;
+        }
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* AUDIO_SINK_HPP */
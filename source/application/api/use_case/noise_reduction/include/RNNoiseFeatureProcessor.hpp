@@ -99,11 +99,6 @@ namespace rnn {
     /* Private functions */
     private:
 
-        /**
-         * @brief   Initialises the half window and DCT tables.
-         */
-        void InitTables();
-
         /**
          * @brief           Applies a bi-quadratic filter over the audio window.
          * @param[in]       bHp           Constant coefficient set b (arrHp type).
@@ -315,8 +310,6 @@ namespace rnn {
     private:
         FftInstance m_fftInstReal;  /* FFT instance for real numbers */
         FftInstance m_fftInstCmplx; /* FFT instance for complex numbers */
-        vec1D32F m_halfWindow;      /* Window coefficients */
-        vec1D32F m_dctTable;        /* DCT table */
         vec1D32F m_analysisMem;     /* Buffer used for frame analysis */
         vec2D32F m_cepstralMem;     /* Cepstral coefficients */
         size_t m_memId;             /* memory ID */
@@ -60,6 +60,9 @@ namespace app {
         /** @brief   Adds operations to the op resolver instance. */
         bool EnlistOperations() override;
 
+        /** @brief   Gets the GRU state output to input tensor index pairs. */
+        const std::vector<std::pair<size_t, size_t>>& GetStateTensorMap() override;
+
         /*
         Each inference after the first needs to copy 3 GRU states from a output index to input index (model dependent):
         0 -> 3, 2 -> 2, 3 -> 1
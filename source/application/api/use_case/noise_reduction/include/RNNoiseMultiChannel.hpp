@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RNNOISE_MULTI_CHANNEL_HPP
+#define RNNOISE_MULTI_CHANNEL_HPP
+
+#include "RNNoiseModel.hpp"
+#include "RNNoiseProcessing.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Denoises several audio channels with one RNNoise model
+     *          instance. Each channel keeps its own feature processor,
+     *          frame features and GRU state, and the channels take turns on
+     *          the model: a channel's GRU state is loaded into the model's
+     *          state inputs before its inference and saved from the state
+     *          outputs after it, straight to and from a buffer owned by the
+     *          channel.
+     */
+    class RNNoiseMultiChannel {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   model         Initialised RNNoise model, shared by all channels.
+         * @param[in]   numChannels   Number of audio channels.
+         * @param[in]   frameLength   Audio frame length in samples.
+         **/
+        RNNoiseMultiChannel(RNNoiseModel& model, uint32_t numChannels, uint32_t frameLength);
+
+        /**
+         * @brief       Resets a channel's features and GRU state, before it
+         *              starts on a new, unrelated stream of audio.
+         * @param[in]   channel   Channel index.
+         * @return      true if successful, false otherwise.
+         **/
+        bool ResetChannel(uint32_t channel);
+
+        /**
+         * @brief       Denoises the next frame of a channel.
+         * @param[in]   channel   Channel index.
+         * @param[in]   frame     Audio frame of frameLength samples.
+         * @return      true if successful, false otherwise.
+         **/
+        bool DenoiseFrame(uint32_t channel, const int16_t* frame);
+
+        /**
+         * @brief       Gets the last denoised frame of a channel.
+         * @param[in]   channel   Channel index.
+         * @return      Reference to the denoised audio frame.
+         **/
+        const std::vector<int16_t>& GetDenoisedFrame(uint32_t channel) const;
+
+        /** @brief  Gets the number of channels. */
+        uint32_t NumChannels() const;
+
+    private:
+        /* Everything a channel keeps between its frames. */
+        struct Channel {
+            Channel(TfLiteTensor* inputTensor, TfLiteTensor* outputTensor,
+                    uint32_t frameLength, size_t stateBytes);
+
+            std::shared_ptr<rnn::RNNoiseFeatureProcessor> m_featureProcessor;
+            std::shared_ptr<rnn::FrameFeatures> m_frameFeatures;
+            std::vector<int16_t> m_denoisedFrame;
+            RNNoisePreProcess m_preProcess;
+            RNNoisePostProcess m_postProcess;
+            std::vector<uint8_t> m_gruState;        /* GRU state after the channel's last frame. */
+            bool m_gruStateValid{false};            /* False until the channel's first inference. */
+        };
+
+        RNNoiseModel& m_model;
+        uint32_t m_frameLength;
+        size_t m_stateBytes;
+        std::vector<std::unique_ptr<Channel>> m_channels;
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* RNNOISE_MULTI_CHANNEL_HPP */
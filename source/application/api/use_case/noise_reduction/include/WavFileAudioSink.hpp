@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WAV_FILE_AUDIO_SINK_HPP
+#define WAV_FILE_AUDIO_SINK_HPP
+
+#include "AudioSink.hpp"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Sink writing each clip straight to a 16-bit mono WAV file,
+     *          named denoised_<clip name> as rnnoise_dump_extractor.py would.
+     *          Samples are gathered in one of two buffers while a writer thread
+     *          flushes the other to disk, so inference only waits on the file
+     *          system if it gets a whole buffer ahead. Host builds only.
+     */
+    class WavFileAudioSink : public AudioSink {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   outputDir       Directory the WAV files are written to.
+         * @param[in]   sampleRate      Sample rate of the audio, in Hz.
+         * @param[in]   bufferSamples   Samples per buffer.
+         **/
+        WavFileAudioSink(std::string outputDir, uint32_t sampleRate, size_t bufferSamples = 16384);
+
+        ~WavFileAudioSink() override;
+
+        bool Begin(const char* name, size_t numSamples) override;
+
+        bool Write(const int16_t* samples, size_t numSamples) override;
+
+        bool End() override;
+
+    private:
+        std::string                 m_outputDir;
+        uint32_t                    m_sampleRate;
+        std::vector<int16_t>        m_buffers[2];
+        size_t                      m_fill{0};              /* Samples in the active buffer. */
+        size_t                      m_active{0};            /* Buffer being filled. */
+        FILE*                       m_file{nullptr};
+        size_t                      m_dataBytes{0};         /* Bytes handed to the writer. */
+
+        /* Shared with the writer thread. */
+        std::thread                 m_writer;
+        std::mutex                  m_mutex;
+        std::condition_variable     m_cv;
+        bool                        m_pending{false};       /* A buffer is waiting to be written. */
+        size_t                      m_pendingIndex{0};
+        size_t                      m_pendingSamples{0};
+        bool                        m_stop{false};
+        bool                        m_writeFailed{false};
+
+        /** @brief  Hands the active buffer to the writer and switches to the other one. */
+        void Submit();
+
+        /** @brief  Writer thread body. */
+        void WriterLoop();
+
+        /** @brief  Writes the RIFF header for a given amount of sample data. */
+        bool WriteHeader(uint32_t dataBytes);
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* WAV_FILE_AUDIO_SINK_HPP */
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include "RNNoiseFeatureProcessor.hpp"
+#include "DspTables.hpp"
 #include "log_macros.h"
 
 #include <algorithm>
@@ -33,9 +34,45 @@ do {                                                \
     }                                               \
 } while(0)
 
+using HalfWindow = audio::tables::Array<float, RNNoiseFeatureProcessor::FRAME_SIZE>;
+using DctTable = audio::tables::Array<float, RNNoiseFeatureProcessor::NB_BANDS * RNNoiseFeatureProcessor::NB_BANDS>;
+
+/** @brief  Vorbis power complementary half window. */
+static constexpr HalfWindow MakeHalfWindow()
+{
+    using audio::tables::Sin;
+    constexpr double halfPi = audio::tables::ms_pi / 2;
+    constexpr uint32_t frameSize = RNNoiseFeatureProcessor::FRAME_SIZE;
+
+    HalfWindow halfWindow{};
+    for (uint32_t i = 0; i < frameSize; i++) {
+        const double sinVal = Sin(halfPi / frameSize * (i + 0.5));
+        halfWindow[i] = static_cast<float>(Sin(halfPi * sinVal * sinVal));
+    }
+    return halfWindow;
+}
+
+/** @brief  DCT-II of the band energies, first column scaled by sqrt(0.5). */
+static constexpr DctTable MakeDctTable()
+{
+    constexpr uint32_t numBands = RNNoiseFeatureProcessor::NB_BANDS;
+
+    DctTable dctTable{};
+    for (uint32_t i = 0; i < numBands; i++) {
+        for (uint32_t j = 0; j < numBands; j++) {
+            dctTable[i * numBands + j] = static_cast<float>(
+                audio::tables::Cos((i + 0.5) * j * audio::tables::ms_pi / numBands));
+        }
+        dctTable[i * numBands] *= static_cast<float>(audio::tables::Sqrt(0.5));
+    }
+    return dctTable;
+}
+
+/* Computed at compile time, so they are shared read-only data. */
+static constexpr HalfWindow ms_halfWindow = MakeHalfWindow();
+static constexpr DctTable ms_dctTable = MakeDctTable();
+
 RNNoiseFeatureProcessor::RNNoiseFeatureProcessor() :
-        m_halfWindow(FRAME_SIZE, 0),
-        m_dctTable(NB_BANDS * NB_BANDS),
         m_analysisMem(FRAME_SIZE, 0),
         m_cepstralMem(CEPS_MEM, vec1D32F(NB_BANDS, 0)),
         m_memId{0},
@@ -51,7 +88,6 @@ RNNoiseFeatureProcessor::RNNoiseFeatureProcessor() :
 
     math::MathUtils::FftInitF32(numFFt, this->m_fftInstReal, FftType::real);
     math::MathUtils::FftInitF32(numFFt, this->m_fftInstCmplx, FftType::complex);
-    this->InitTables();
 }
 
 void RNNoiseFeatureProcessor::PreprocessFrame(const float*   audioData,
@@ -92,25 +128,6 @@ void RNNoiseFeatureProcessor::PostProcessFrame(vec1D32F& modelOutput, FrameFeatu
     FrameSynthesis(outFrame, features.m_fftX);
 }
 
-void RNNoiseFeatureProcessor::InitTables()
-{
-    constexpr float pi = M_PI;
-    constexpr float halfPi = M_PI / 2;
-    constexpr float halfPiOverFrameSz = halfPi/FRAME_SIZE;
-
-    for (uint32_t i = 0; i < FRAME_SIZE; i++) {
-        const float sinVal = math::MathUtils::SineF32(halfPiOverFrameSz * (i + 0.5f));
-        m_halfWindow[i] = math::MathUtils::SineF32(halfPi * sinVal * sinVal);
-    }
-
-    for (uint32_t i = 0; i < NB_BANDS; i++) {
-        for (uint32_t j = 0; j < NB_BANDS; j++) {
-            m_dctTable[i * NB_BANDS + j] = math::MathUtils::CosineF32((i + 0.5f) * j * pi / NB_BANDS);
-        }
-        m_dctTable[i * NB_BANDS] *= math::MathUtils::SqrtF32(0.5f);
-    }
-}
-
 void RNNoiseFeatureProcessor::BiQuad(
         const arrHp& bHp,
         const arrHp& aHp,
@@ -296,12 +313,12 @@ void RNNoiseFeatureProcessor::ApplyWindow(vec1D32F& x)
         return;
     }
 
-    VERIFY(this->m_halfWindow.size() >= FRAME_SIZE);
+    static_assert(ms_halfWindow.size() >= FRAME_SIZE, "Half window too short");
 
     /* Multiply input by sinusoidal function. */
     for (size_t i = 0; i < FRAME_SIZE; i++) {
-        x[i] *= this->m_halfWindow[i];
-        x[WINDOW_SIZE - 1 - i] *= this->m_halfWindow[i];
+        x[i] *= ms_halfWindow[i];
+        x[WINDOW_SIZE - 1 - i] *= ms_halfWindow[i];
     }
 }
 
@@ -376,12 +393,12 @@ void RNNoiseFeatureProcessor::ComputeBandCorr(const vec1D32F& X, const vec1D32F&
 
 void RNNoiseFeatureProcessor::DCT(vec1D32F& input, vec1D32F& output)
 {
-    VERIFY(this->m_dctTable.size() >= NB_BANDS * NB_BANDS);
+    static_assert(ms_dctTable.size() >= NB_BANDS * NB_BANDS, "DCT table too small");
     for (uint32_t i = 0; i < NB_BANDS; ++i) {
         float sum = 0;
 
         for (uint32_t j = 0, k = 0; j < NB_BANDS; ++j, k += NB_BANDS) {
-            sum += input[j] * this->m_dctTable[k + i];
+            sum += input[j] * ms_dctTable[k + i];
         }
         output[i] = sum * math::MathUtils::SqrtF32(2.0/22);
     }
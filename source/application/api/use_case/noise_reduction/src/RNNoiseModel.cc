@@ -54,43 +54,17 @@ bool arm::app::RNNoiseModel::RunInference()
     return Model::RunInference();
 }
 
+const std::vector<std::pair<size_t, size_t>>& arm::app::RNNoiseModel::GetStateTensorMap()
+{
+    return this->m_gruStateMap;
+}
+
 void arm::app::RNNoiseModel::ResetGruState()
 {
-    for (auto& stateMapping: this->m_gruStateMap) {
-        TfLiteTensor* inputGruStateTensor = this->GetInputTensor(stateMapping.second);
-        auto* inputGruState = tflite::GetTensorData<int8_t>(inputGruStateTensor);
-        /* Initial value of states is 0, but this is affected by quantization zero point. */
-        auto quantParams = arm::app::GetTensorQuantParams(inputGruStateTensor);
-        memset(inputGruState, quantParams.offset, inputGruStateTensor->bytes);
-    }
+    this->ResetStates();
 }
 
 bool arm::app::RNNoiseModel::CopyGruStates()
 {
-    std::vector<std::pair<size_t, std::vector<int8_t>>> tempOutGruStates;
-    /* Saving output states before copying them to input states to avoid output states modification in the tensor.
-     * tflu shares input and output tensors memory, thus writing to input tensor can change output tensor values. */
-    for (auto& stateMapping: this->m_gruStateMap) {
-        TfLiteTensor* outputGruStateTensor = this->GetOutputTensor(stateMapping.first);
-        std::vector<int8_t> tempOutGruState(outputGruStateTensor->bytes);
-        auto* outGruState = tflite::GetTensorData<int8_t>(outputGruStateTensor);
-        memcpy(tempOutGruState.data(), outGruState, outputGruStateTensor->bytes);
-        /* Index of the input tensor and the data to copy. */
-        tempOutGruStates.emplace_back(stateMapping.second, std::move(tempOutGruState));
-    }
-    /* Updating input GRU states with saved GRU output states. */
-    for (auto& stateMapping: tempOutGruStates) {
-        auto outputGruStateTensorData = stateMapping.second;
-        TfLiteTensor* inputGruStateTensor = this->GetInputTensor(stateMapping.first);
-        if (outputGruStateTensorData.size() != inputGruStateTensor->bytes) {
-            printf_err("Unexpected number of bytes for GRU state mapping. Input = %zuz, output = %zuz.\n",
-                       inputGruStateTensor->bytes,
-                       outputGruStateTensorData.size());
-            return false;
-        }
-        auto* inputGruState = tflite::GetTensorData<int8_t>(inputGruStateTensor);
-        auto* outGruState = outputGruStateTensorData.data();
-        memcpy(inputGruState, outGruState, inputGruStateTensor->bytes);
-    }
-    return true;
+    return this->CarryOverStates();
 }
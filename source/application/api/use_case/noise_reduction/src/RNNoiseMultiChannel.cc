@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RNNoiseMultiChannel.hpp"
+#include "log_macros.h"
+
+namespace arm {
+namespace app {
+
+    RNNoiseMultiChannel::Channel::Channel(TfLiteTensor* inputTensor, TfLiteTensor* outputTensor,
+                                          const uint32_t frameLength, const size_t stateBytes)
+    :   m_featureProcessor{std::make_shared<rnn::RNNoiseFeatureProcessor>()},
+        m_frameFeatures{std::make_shared<rnn::FrameFeatures>()},
+        m_denoisedFrame(frameLength),
+        m_preProcess{inputTensor, m_featureProcessor, m_frameFeatures},
+        m_postProcess{outputTensor, m_denoisedFrame, m_featureProcessor, m_frameFeatures},
+        m_gruState(stateBytes)
+    {}
+
+    RNNoiseMultiChannel::RNNoiseMultiChannel(RNNoiseModel& model, const uint32_t numChannels,
+                                             const uint32_t frameLength)
+    :   m_model{model},
+        m_frameLength{frameLength},
+        m_stateBytes{model.GetStateBytes()}
+    {
+        for (uint32_t channel = 0; channel < numChannels; ++channel) {
+            this->m_channels.emplace_back(nullptr);
+            this->ResetChannel(channel);
+        }
+    }
+
+    bool RNNoiseMultiChannel::ResetChannel(const uint32_t channel)
+    {
+        if (channel >= this->NumChannels()) {
+            printf_err("Invalid channel %" PRIu32 "\n", channel);
+            return false;
+        }
+
+        this->m_channels[channel].reset(new Channel(
+            this->m_model.GetInputTensor(0),
+            this->m_model.GetOutputTensor(this->m_model.m_indexForModelOutput),
+            this->m_frameLength, this->m_stateBytes));
+        return true;
+    }
+
+    bool RNNoiseMultiChannel::DenoiseFrame(const uint32_t channel, const int16_t* frame)
+    {
+        if (channel >= this->NumChannels()) {
+            printf_err("Invalid channel %" PRIu32 "\n", channel);
+            return false;
+        }
+        Channel& state = *this->m_channels[channel];
+
+        if (!state.m_preProcess.DoPreProcess(frame, this->m_frameLength)) {
+            printf_err("Pre-processing failed for channel %" PRIu32 "\n", channel);
+            return false;
+        }
+
+        /* Swap the channel's GRU state in. */
+        if (state.m_gruStateValid) {
+            if (!this->m_model.LoadStates(state.m_gruState.data(), state.m_gruState.size())) {
+                return false;
+            }
+        } else {
+            this->m_model.ResetGruState();
+        }
+
+        if (!this->m_model.RunInference()) {
+            printf_err("Inference failed for channel %" PRIu32 "\n", channel);
+            return false;
+        }
+
+        /* And out again, before the next channel overwrites it. */
+        if (!this->m_model.SaveStates(state.m_gruState.data(), state.m_gruState.size())) {
+            return false;
+        }
+        state.m_gruStateValid = true;
+
+        if (!state.m_postProcess.DoPostProcess()) {
+            printf_err("Post-processing failed for channel %" PRIu32 "\n", channel);
+            return false;
+        }
+        return true;
+    }
+
+    const std::vector<int16_t>& RNNoiseMultiChannel::GetDenoisedFrame(const uint32_t channel) const
+    {
+        return this->m_channels.at(channel)->m_denoisedFrame;
+    }
+
+    uint32_t RNNoiseMultiChannel::NumChannels() const
+    {
+        return static_cast<uint32_t>(this->m_channels.size());
+    }
+
+} /* namespace app */
+} /* namespace arm */
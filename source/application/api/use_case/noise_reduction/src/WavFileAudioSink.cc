@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "WavFileAudioSink.hpp"
+#include "log_macros.h"
+
+namespace arm {
+namespace app {
+
+    /** @brief  Stores a value little-endian, as WAV headers are. */
+    static void PutLe(uint8_t* dst, uint32_t value, const size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; ++i) {
+            dst[i] = static_cast<uint8_t>(value);
+            value >>= 8;
+        }
+    }
+
+    WavFileAudioSink::WavFileAudioSink(std::string outputDir, const uint32_t sampleRate,
+                                       const size_t bufferSamples)
+    :   m_outputDir{std::move(outputDir)},
+        m_sampleRate{sampleRate}
+    {
+        this->m_buffers[0].resize(bufferSamples);
+        this->m_buffers[1].resize(bufferSamples);
+    }
+
+    WavFileAudioSink::~WavFileAudioSink()
+    {
+        if (this->m_file) {
+            this->End();
+        }
+    }
+
+    bool WavFileAudioSink::Begin(const char* name, const size_t numSamples)
+    {
+        if (this->m_file) {
+            printf_err("Previous clip has not been ended\n");
+            return false;
+        }
+
+        const std::string path = this->m_outputDir + "/denoised_" + name;
+        this->m_file = std::fopen(path.c_str(), "wb");
+        if (!this->m_file) {
+            printf_err("Cannot open %s for writing\n", path.c_str());
+            return false;
+        }
+
+        /* The sizes are filled in again at the end, numSamples is only a guess. */
+        if (!this->WriteHeader(numSamples * sizeof(int16_t))) {
+            std::fclose(this->m_file);
+            this->m_file = nullptr;
+            return false;
+        }
+
+        this->m_fill = 0;
+        this->m_active = 0;
+        this->m_dataBytes = 0;
+        this->m_pending = false;
+        this->m_stop = false;
+        this->m_writeFailed = false;
+        this->m_writer = std::thread(&WavFileAudioSink::WriterLoop, this);
+        info("Writing denoised audio to %s\n", path.c_str());
+        return true;
+    }
+
+    bool WavFileAudioSink::Write(const int16_t* samples, size_t numSamples)
+    {
+        if (!this->m_file) {
+            printf_err("No clip started\n");
+            return false;
+        }
+
+        while (numSamples > 0) {
+            auto& buffer = this->m_buffers[this->m_active];
+            const size_t toCopy = std::min(numSamples, buffer.size() - this->m_fill);
+            std::copy(samples, samples + toCopy, buffer.begin() + this->m_fill);
+            this->m_fill += toCopy;
+            samples += toCopy;
+            numSamples -= toCopy;
+            if (this->m_fill == buffer.size()) {
+                this->Submit();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        return !this->m_writeFailed;
+    }
+
+    bool WavFileAudioSink::End()
+    {
+        if (!this->m_file) {
+            return false;
+        }
+
+        if (this->m_fill > 0) {
+            this->Submit();
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_stop = true;
+        }
+        this->m_cv.notify_all();
+        this->m_writer.join();
+
+        bool success = !this->m_writeFailed && std::fseek(this->m_file, 0, SEEK_SET) == 0 &&
+                       this->WriteHeader(this->m_dataBytes);
+        success = std::fclose(this->m_file) == 0 && success;
+        this->m_file = nullptr;
+
+        if (!success) {
+            printf_err("Failed to write denoised audio\n");
+        }
+        return success;
+    }
+
+    void WavFileAudioSink::Submit()
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        /* Only waits if the writer is still busy with the other buffer. */
+        this->m_cv.wait(lock, [this] { return !this->m_pending; });
+        this->m_pending = true;
+        this->m_pendingIndex = this->m_active;
+        this->m_pendingSamples = this->m_fill;
+        this->m_dataBytes += this->m_fill * sizeof(int16_t);
+        lock.unlock();
+        this->m_cv.notify_all();
+
+        this->m_active ^= 1;
+        this->m_fill = 0;
+    }
+
+    void WavFileAudioSink::WriterLoop()
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        while (true) {
+            this->m_cv.wait(lock, [this] { return this->m_pending || this->m_stop; });
+            if (!this->m_pending) {
+                return;
+            }
+
+            const auto& buffer = this->m_buffers[this->m_pendingIndex];
+            const size_t numSamples = this->m_pendingSamples;
+
+            /* The producer leaves a pending buffer alone, so write it unlocked. */
+            lock.unlock();
+            const bool written =
+                std::fwrite(buffer.data(), sizeof(int16_t), numSamples, this->m_file) == numSamples;
+            lock.lock();
+
+            this->m_writeFailed = this->m_writeFailed || !written;
+            this->m_pending = false;
+            this->m_cv.notify_all();
+        }
+    }
+
+    bool WavFileAudioSink::WriteHeader(const uint32_t dataBytes)
+    {
+        constexpr uint32_t numChannels = 1;
+        constexpr uint32_t bitsPerSample = 16;
+        const uint32_t blockAlign = numChannels * bitsPerSample / 8;
+
+        uint8_t header[44];
+        std::memcpy(header, "RIFF", 4);
+        PutLe(header + 4, 36 + dataBytes, 4);
+        std::memcpy(header + 8, "WAVEfmt ", 8);
+        PutLe(header + 16, 16, 4);                                  /* fmt chunk size. */
+        PutLe(header + 20, 1, 2);                                   /* PCM. */
+        PutLe(header + 22, numChannels, 2);
+        PutLe(header + 24, this->m_sampleRate, 4);
+        PutLe(header + 28, this->m_sampleRate * blockAlign, 4);     /* Byte rate. */
+        PutLe(header + 32, blockAlign, 2);
+        PutLe(header + 34, bitsPerSample, 2);
+        std::memcpy(header + 36, "data", 4);
+        PutLe(header + 40, dataBytes, 4);
+
+        return std::fwrite(header, 1, sizeof(header), this->m_file) == sizeof(header);
+    }
+
+} /* namespace app */
+} /* namespace arm */
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DETECTION_TRACKER_HPP
+#define DETECTION_TRACKER_HPP
+
+#include "DetectionResult.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace object_detection {
+
+    /** Keyframe policy and association parameters for the tracker. */
+    struct TrackerParams {
+        uint32_t keyframeInterval = 1;      /* Run the detector at least every N frames. */
+        float minConfidence = 0.3f;         /* Run the detector when a track's confidence drops below. */
+        float confidenceDecay = 0.8f;       /* Track confidence multiplier per predicted frame. */
+        float iouThreshold = 0.3f;          /* Minimum IoU to match a detection to a track. */
+        float velocitySmoothing = 0.5f;     /* Weight of the newest velocity measurement. */
+    };
+
+    /**
+     * @brief   Tracks detections between keyframes so the detector does not
+     *          need to run on every frame. On keyframes, detections are
+     *          matched to tracks by IoU against the tracks' predicted boxes.
+     *          Between keyframes, boxes are moved by a constant velocity
+     *          model and the tracks' confidence decays.
+     */
+    class DetectionTracker {
+    public:
+        /**
+         * @brief     Constructor.
+         * @param[in] params   Tracker parameters.
+         */
+        explicit DetectionTracker(const TrackerParams& params = TrackerParams{});
+
+        /**
+         * @brief   Applies the keyframe policy to the next frame.
+         * @return  true if the detector should run on the next frame,
+         *          false if its boxes can be predicted.
+         */
+        bool NeedsDetection() const;
+
+        /**
+         * @brief       Updates the tracks with the detector's results for a
+         *              keyframe. Unmatched detections start new tracks and
+         *              unmatched tracks are dropped.
+         * @param[in]   detections   Detector results for the frame.
+         */
+        void Update(const std::vector<DetectionResult>& detections);
+
+        /**
+         * @brief       Predicts boxes for a frame the detector did not run on.
+         * @param[out]  results   Predicted boxes, one per track.
+         */
+        void Predict(std::vector<DetectionResult>& results);
+
+        /** @brief  Drops all tracks, so the next frame is a keyframe. */
+        void Reset();
+
+        /** @brief  Gets the number of frames processed since the last reset. */
+        uint32_t GetFrameCount() const;
+
+        /** @brief  Gets the number of keyframes since the last reset. */
+        uint32_t GetKeyframeCount() const;
+
+    private:
+        struct Track {
+            float       cx;                 /* Box centre, x. */
+            float       cy;                 /* Box centre, y. */
+            float       w;                  /* Box width. */
+            float       h;                  /* Box height. */
+            float       vx = 0.f;           /* Velocity in pixels per frame, x. */
+            float       vy = 0.f;           /* Velocity in pixels per frame, y. */
+            float       confidence = 1.f;   /* Decays while the track is predicted. */
+            double      score;              /* Detector score of the last match. */
+            float       detCx;              /* Centre of the last matched detection, x. */
+            float       detCy;              /* Centre of the last matched detection, y. */
+            uint32_t    framesSinceDet = 0; /* Frames since the last matched detection. */
+        };
+
+        /** @brief  Moves all tracks forward by one frame. */
+        void Advance();
+
+        static float IoU(const Track& track, const DetectionResult& det);
+
+        TrackerParams           m_params;
+        std::vector<Track>      m_tracks;
+        uint32_t                m_framesSinceKeyframe = 0;
+        uint32_t                m_frameCount = 0;
+        uint32_t                m_keyframeCount = 0;
+    };
+
+} /* namespace object_detection */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* DETECTION_TRACKER_HPP */
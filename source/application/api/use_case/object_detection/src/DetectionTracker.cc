@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DetectionTracker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace arm {
+namespace app {
+namespace object_detection {
+
+    DetectionTracker::DetectionTracker(const TrackerParams& params)
+    :   m_params{params}
+    {}
+
+    bool DetectionTracker::NeedsDetection() const
+    {
+        if (this->m_keyframeCount == 0 ||
+            this->m_framesSinceKeyframe + 1 >= this->m_params.keyframeInterval) {
+            return true;
+        }
+
+        /* Re-detect before any track's predicted box becomes unreliable. */
+        return std::any_of(this->m_tracks.begin(), this->m_tracks.end(), [this](const Track& track) {
+            return track.confidence * this->m_params.confidenceDecay < this->m_params.minConfidence;
+        });
+    }
+
+    void DetectionTracker::Update(const std::vector<DetectionResult>& detections)
+    {
+        ++this->m_frameCount;
+        ++this->m_keyframeCount;
+        this->m_framesSinceKeyframe = 0;
+        this->Advance();
+
+        /* Greedy association, best overlapping pairs first. */
+        std::vector<std::tuple<float, size_t, size_t>> pairs;
+        for (size_t t = 0; t < this->m_tracks.size(); ++t) {
+            for (size_t d = 0; d < detections.size(); ++d) {
+                const float iou = IoU(this->m_tracks[t], detections[d]);
+                if (iou >= this->m_params.iouThreshold) {
+                    pairs.emplace_back(iou, t, d);
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end(),
+                  [](const std::tuple<float, size_t, size_t>& a, const std::tuple<float, size_t, size_t>& b) {
+                      return std::get<0>(a) > std::get<0>(b);
+                  });
+
+        std::vector<bool> trackMatched(this->m_tracks.size(), false);
+        std::vector<bool> detMatched(detections.size(), false);
+        std::vector<Track> tracks;
+        tracks.reserve(detections.size());
+
+        for (const auto& pair : pairs) {
+            const size_t t = std::get<1>(pair);
+            const size_t d = std::get<2>(pair);
+            if (trackMatched[t] || detMatched[d]) {
+                continue;
+            }
+            trackMatched[t] = true;
+            detMatched[d] = true;
+
+            Track track = this->m_tracks[t];
+            const DetectionResult& det = detections[d];
+            const float cx = det.m_x0 + det.m_w * 0.5f;
+            const float cy = det.m_y0 + det.m_h * 0.5f;
+
+            /* Blend the velocity measured since the last detection into the estimate. */
+            const float alpha = this->m_params.velocitySmoothing;
+            const auto frames = static_cast<float>(track.framesSinceDet);
+            track.vx = alpha * (cx - track.detCx) / frames + (1.f - alpha) * track.vx;
+            track.vy = alpha * (cy - track.detCy) / frames + (1.f - alpha) * track.vy;
+
+            track.cx = track.detCx = cx;
+            track.cy = track.detCy = cy;
+            track.w = det.m_w;
+            track.h = det.m_h;
+            track.score = det.m_normalisedVal;
+            track.confidence = 1.f;
+            track.framesSinceDet = 0;
+            tracks.push_back(track);
+        }
+
+        /* Unmatched detections start new, stationary tracks. */
+        for (size_t d = 0; d < detections.size(); ++d) {
+            if (detMatched[d]) {
+                continue;
+            }
+            const DetectionResult& det = detections[d];
+            Track track;
+            track.cx = track.detCx = det.m_x0 + det.m_w * 0.5f;
+            track.cy = track.detCy = det.m_y0 + det.m_h * 0.5f;
+            track.w = det.m_w;
+            track.h = det.m_h;
+            track.score = det.m_normalisedVal;
+            tracks.push_back(track);
+        }
+
+        this->m_tracks.swap(tracks);
+    }
+
+    void DetectionTracker::Predict(std::vector<DetectionResult>& results)
+    {
+        ++this->m_frameCount;
+        ++this->m_framesSinceKeyframe;
+        this->Advance();
+
+        results.clear();
+        for (auto& track : this->m_tracks) {
+            track.confidence *= this->m_params.confidenceDecay;
+            results.emplace_back(track.score,
+                                 static_cast<int>(std::lround(track.cx - track.w * 0.5f)),
+                                 static_cast<int>(std::lround(track.cy - track.h * 0.5f)),
+                                 static_cast<int>(std::lround(track.w)),
+                                 static_cast<int>(std::lround(track.h)));
+        }
+    }
+
+    void DetectionTracker::Reset()
+    {
+        this->m_tracks.clear();
+        this->m_framesSinceKeyframe = 0;
+        this->m_frameCount = 0;
+        this->m_keyframeCount = 0;
+    }
+
+    uint32_t DetectionTracker::GetFrameCount() const
+    {
+        return this->m_frameCount;
+    }
+
+    uint32_t DetectionTracker::GetKeyframeCount() const
+    {
+        return this->m_keyframeCount;
+    }
+
+    void DetectionTracker::Advance()
+    {
+        for (auto& track : this->m_tracks) {
+            track.cx += track.vx;
+            track.cy += track.vy;
+            ++track.framesSinceDet;
+        }
+    }
+
+    float DetectionTracker::IoU(const Track& track, const DetectionResult& det)
+    {
+        const float tx0 = track.cx - track.w * 0.5f;
+        const float ty0 = track.cy - track.h * 0.5f;
+        const float ix = std::min(tx0 + track.w, static_cast<float>(det.m_x0 + det.m_w)) -
+                         std::max(tx0, static_cast<float>(det.m_x0));
+        const float iy = std::min(ty0 + track.h, static_cast<float>(det.m_y0 + det.m_h)) -
+                         std::max(ty0, static_cast<float>(det.m_y0));
+        if (ix <= 0.f || iy <= 0.f) {
+            return 0.f;
+        }
+
+        const float intersection = ix * iy;
+        const float unionArea = track.w * track.h + static_cast<float>(det.m_w * det.m_h) - intersection;
+        return unionArea > 0.f ? intersection / unionArea : 0.f;
+    }
+
+} /* namespace object_detection */
+} /* namespace app */
+} /* namespace arm */
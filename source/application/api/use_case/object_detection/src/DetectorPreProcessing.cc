@@ -24,27 +24,23 @@ namespace app {
     DetectorPreProcess::DetectorPreProcess(TfLiteTensor* inputTensor, bool rgb2Gray, bool convertToInt8)
     :   m_inputTensor{inputTensor},
         m_rgb2Gray{rgb2Gray},
-        m_convertToInt8{convertToInt8}
+        m_converter{inputTensor, rgb2Gray,
+                    convertToInt8 ? image::PixelScaling::Centred : image::PixelScaling::Raw}
     {}
 
     bool DetectorPreProcess::DoPreProcess(const void* data, size_t inputSize) {
         if (data == nullptr) {
             printf_err("Data pointer is null");
+            return false;
         }
 
-        auto input = static_cast<const uint8_t*>(data);
-
-        if (this->m_rgb2Gray) {
-            image::RgbToGrayscale(input, this->m_inputTensor->data.uint8, this->m_inputTensor->bytes);
-        } else {
-            std::memcpy(this->m_inputTensor->data.data, input, inputSize);
+        /* A grayscale conversion always fills the whole tensor. */
+        const size_t numPixels = this->m_rgb2Gray ? this->m_inputTensor->bytes : inputSize;
+        if (!this->m_converter.Convert(static_cast<const uint8_t*>(data), numPixels)) {
+            return false;
         }
         debug("Input tensor populated \n");
 
-        if (this->m_convertToInt8) {
-            image::ConvertImgToInt8(this->m_inputTensor->data.data, this->m_inputTensor->bytes);
-        }
-
         return true;
     }
 
@@ -20,6 +20,7 @@
 #include "BaseProcessing.hpp"
 #include "Model.hpp"
 #include "Classifier.hpp"
+#include "ImageTensorConverter.hpp"
 
 namespace arm {
 namespace app {
@@ -50,7 +51,7 @@ namespace app {
 
     private:
         TfLiteTensor* m_inputTensor;
-        bool m_rgb2Gray;
+        image::ImageToTensorConverter m_converter;
     };
 
     /**
@@ -63,7 +64,7 @@ namespace app {
     private:
         TfLiteTensor* m_outputTensor;
         Classifier& m_vwwClassifier;
-        const std::vector<std::string>& m_labels;
+        LabelTable m_labels;
         std::vector<ClassificationResult>& m_results;
 
     public:
@@ -76,7 +77,7 @@ namespace app {
          * @param[out]  results        Vector of classification results to store decoded outputs.
          **/
         VisualWakeWordPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
-                const std::vector<std::string>& labels,
+                const LabelTable& labels,
                 std::vector<ClassificationResult>& results);
 
         /**
@@ -25,35 +25,21 @@ namespace app {
 
     VisualWakeWordPreProcess::VisualWakeWordPreProcess(TfLiteTensor* inputTensor, bool rgb2Gray)
     :m_inputTensor{inputTensor},
-     m_rgb2Gray{rgb2Gray}
+     m_converter{inputTensor, rgb2Gray, image::PixelScaling::Normalised}
     {}
 
     bool VisualWakeWordPreProcess::DoPreProcess(const void* data, size_t inputSize)
     {
         if (data == nullptr) {
             printf_err("Data pointer is null");
-        }
-
-        auto input = static_cast<const uint8_t*>(data);
-
-        uint8_t* unsignedDstPtr = this->m_inputTensor->data.uint8;
-
-        if (this->m_rgb2Gray) {
-            image::RgbToGrayscale(input, unsignedDstPtr, inputSize);
-        } else {
-            std::memcpy(unsignedDstPtr, input, inputSize);
+            return false;
         }
 
         /* VWW model pre-processing is image conversion from uint8 to [0,1] float values,
-         * then quantize them with input quantization info. */
-        QuantParams inQuantParams = GetTensorQuantParams(this->m_inputTensor);
-
-        int8_t* signedDstPtr = this->m_inputTensor->data.int8;
-        for (size_t i = 0; i < this->m_inputTensor->bytes; i++) {
-            auto i_data_int8 = static_cast<int8_t>(
-                    ((static_cast<float>(unsignedDstPtr[i]) / 255.0f) / inQuantParams.scale) + inQuantParams.offset
-                    );
-            signedDstPtr[i] = std::min<int8_t>(INT8_MAX, std::max<int8_t>(i_data_int8, INT8_MIN));
+         * then quantize them with input quantization info. The converter does both
+         * (and the optional grayscale conversion) through a lookup table. */
+        if (!this->m_converter.Convert(static_cast<const uint8_t*>(data), inputSize)) {
+            return false;
         }
 
         debug("Input tensor populated \n");
@@ -62,7 +48,7 @@ namespace app {
     }
 
     VisualWakeWordPostProcess::VisualWakeWordPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
-            const std::vector<std::string>& labels, std::vector<ClassificationResult>& results)
+            const LabelTable& labels, std::vector<ClassificationResult>& results)
             :m_outputTensor{outputTensor},
              m_vwwClassifier{classifier},
              m_labels{labels},
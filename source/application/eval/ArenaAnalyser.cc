@@ -0,0 +1,350 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ArenaAnalyser.hpp"
+
+#include "Model.hpp"
+#include "log_macros.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/recording_micro_allocator.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    /* Alignment of tensors in the arena. */
+    constexpr size_t tensorAlignment = 16;
+
+    static size_t AlignUp(size_t bytes, size_t alignment)
+    {
+        return (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    /* Stand-in for the Ethos-U operator of Vela optimised models, which only
+     * needs to be prepared to size the arena. The real kernel keeps a small
+     * persistent state per operator; its scratch buffers are model tensors. */
+    static void* EthosUInit(TfLiteContext* context, const char*, size_t)
+    {
+        return context->AllocatePersistentBuffer(context, 64);
+    }
+
+    static TfLiteStatus EthosUPrepare(TfLiteContext*, TfLiteNode*)
+    {
+        return kTfLiteOk;
+    }
+
+    static TfLiteStatus EthosUInvoke(TfLiteContext*, TfLiteNode*)
+    {
+        return kTfLiteError;
+    }
+
+    /**
+     * @brief   Model resolving every built-in operator, and the Ethos-U one
+     *          with a stand-in, so any use case's model can be allocated.
+     */
+    class ArenaProbeModel : public Model {
+    protected:
+        const tflite::MicroOpResolver& GetOpResolver() override
+        {
+            return this->m_opResolver;
+        }
+
+        bool EnlistOperations() override
+        {
+            static auto ethosU = tflite::micro::RegisterOp(EthosUInit, EthosUPrepare, EthosUInvoke);
+            if (!this->m_opResolver.FindOp("ethos-u")) {
+                this->m_opResolver.AddCustom("ethos-u", &ethosU);
+            }
+            return true;
+        }
+
+    private:
+        tflite::AllOpsResolver m_opResolver;
+    };
+
+    bool ArenaFits(const std::vector<ArenaModel>& models, size_t arenaSize, size_t* usedBytes)
+    {
+        std::unique_ptr<uint8_t[]> arena{new uint8_t[arenaSize]};
+        std::vector<std::unique_ptr<ArenaProbeModel>> probes;
+        tflite::MicroAllocator* allocator = nullptr;
+
+        for (const auto& model : models) {
+            probes.emplace_back(new ArenaProbeModel);
+            if (!probes.back()->Init(arena.get(), arenaSize, model.data, model.size, allocator)) {
+                return false;
+            }
+            allocator = probes.back()->GetAllocator();
+        }
+
+        if (usedBytes && allocator) {
+            *usedBytes = allocator->used_bytes();
+        }
+        return allocator != nullptr;
+    }
+
+    static size_t TensorTypeSize(tflite::TensorType type)
+    {
+        switch (type) {
+            case tflite::TensorType_BOOL:
+            case tflite::TensorType_INT8:
+            case tflite::TensorType_UINT8:
+                return 1;
+            case tflite::TensorType_FLOAT16:
+            case tflite::TensorType_INT16:
+            case tflite::TensorType_UINT16:
+                return 2;
+            case tflite::TensorType_FLOAT32:
+            case tflite::TensorType_INT32:
+            case tflite::TensorType_UINT32:
+                return 4;
+            case tflite::TensorType_FLOAT64:
+            case tflite::TensorType_INT64:
+            case tflite::TensorType_COMPLEX64:
+                return 8;
+            default:
+                return 0;
+        }
+    }
+
+    bool AnalyseTensorLifetimes(const ArenaModel& model, ModelArenaInfo& modelInfo)
+    {
+        const tflite::Model* tfModel = tflite::GetModel(model.data);
+        if (!tfModel->subgraphs() || tfModel->subgraphs()->size() == 0) {
+            printf_err("%s has no subgraph\n", model.name.c_str());
+            return false;
+        }
+
+        /* As Model, we expect there to be only one subgraph. */
+        const tflite::SubGraph* subgraph = tfModel->subgraphs()->Get(0);
+        const auto* tensors = subgraph->tensors();
+        const auto* buffers = tfModel->buffers();
+        const uint32_t numOps = subgraph->operators() ? subgraph->operators()->size() : 0;
+        const int32_t lastOp = numOps ? static_cast<int32_t>(numOps) - 1 : 0;
+
+        modelInfo.name = model.name;
+        modelInfo.numOperators = numOps;
+        modelInfo.tensors.clear();
+        modelInfo.peakLiveBytes = 0;
+        modelInfo.peakOp = -1;
+        if (!tensors) {
+            return true;
+        }
+
+        std::vector<int32_t> first(tensors->size(), INT32_MAX);
+        std::vector<int32_t> last(tensors->size(), -1);
+        auto use = [&](const flatbuffers::Vector<int32_t>* indices, int32_t op) {
+            if (!indices) {
+                return;
+            }
+            for (int32_t index : *indices) {
+                /* Optional inputs are -1. */
+                if (index >= 0 && static_cast<size_t>(index) < tensors->size()) {
+                    first[index] = std::min(first[index], op);
+                    last[index] = std::max(last[index], op);
+                }
+            }
+        };
+
+        for (uint32_t i = 0; i < numOps; ++i) {
+            const tflite::Operator* op = subgraph->operators()->Get(i);
+            use(op->inputs(), i);
+            use(op->outputs(), i);
+            use(op->intermediates(), i);
+        }
+        /* Inputs are written before, and outputs read after, the graph runs. */
+        use(subgraph->inputs(), 0);
+        use(subgraph->outputs(), lastOp);
+
+        for (uint32_t i = 0; i < tensors->size(); ++i) {
+            const tflite::Tensor* tensor = tensors->Get(i);
+            const tflite::Buffer* buffer = buffers ? buffers->Get(tensor->buffer()) : nullptr;
+            const bool constant = buffer && buffer->data() && buffer->data()->size() > 0;
+            if (constant || last[i] < 0) {
+                continue;
+            }
+
+            TensorLifetime lifetime;
+            lifetime.index = static_cast<int32_t>(i);
+            lifetime.name = tensor->name() ? tensor->name()->str() : std::string{};
+            lifetime.bytes = TensorTypeSize(tensor->type());
+            if (tensor->shape()) {
+                for (int32_t dim : *tensor->shape()) {
+                    lifetime.bytes *= static_cast<size_t>(std::max(dim, 1));
+                }
+            }
+            lifetime.variable = tensor->is_variable();
+            lifetime.firstOp = lifetime.variable ? 0 : first[i];
+            lifetime.lastOp = lifetime.variable ? lastOp : last[i];
+            modelInfo.tensors.push_back(lifetime);
+        }
+
+        /* Variable tensors are persistent, the rest share the planned head. */
+        for (uint32_t op = 0; op < std::max<uint32_t>(numOps, 1); ++op) {
+            size_t live = 0;
+            for (const auto& tensor : modelInfo.tensors) {
+                if (!tensor.variable && tensor.firstOp <= static_cast<int32_t>(op) &&
+                        static_cast<int32_t>(op) <= tensor.lastOp) {
+                    live += AlignUp(tensor.bytes, tensorAlignment);
+                }
+            }
+            if (live > modelInfo.peakLiveBytes) {
+                modelInfo.peakLiveBytes = live;
+                modelInfo.peakOp = static_cast<int32_t>(op);
+            }
+        }
+        return true;
+    }
+
+    /* Head (non-persistent) and tail (persistent) usage, measured with a
+     * recording allocator. */
+    static bool MeasureArenaUsage(const std::vector<ArenaModel>& models, size_t arenaSize,
+                                  size_t& headBytes, size_t& tailBytes)
+    {
+        std::unique_ptr<uint8_t[]> arena{new uint8_t[arenaSize]};
+        tflite::RecordingMicroAllocator* allocator =
+            tflite::RecordingMicroAllocator::Create(arena.get(), arenaSize);
+        if (!allocator) {
+            return false;
+        }
+
+        std::vector<std::unique_ptr<ArenaProbeModel>> probes;
+        for (const auto& model : models) {
+            probes.emplace_back(new ArenaProbeModel);
+            if (!probes.back()->Init(arena.get(), arenaSize, model.data, model.size, allocator)) {
+                return false;
+            }
+        }
+        headBytes = allocator->GetSimpleMemoryAllocator()->GetHeadUsedBytes();
+        tailBytes = allocator->GetSimpleMemoryAllocator()->GetTailUsedBytes();
+        return true;
+    }
+
+    bool AnalyseArena(const std::vector<ArenaModel>& models, size_t maxArena, ArenaReport& report)
+    {
+        report = ArenaReport{};
+        if (models.empty()) {
+            printf_err("No model to analyse\n");
+            return false;
+        }
+
+        for (const auto& model : models) {
+            ModelArenaInfo modelInfo;
+            if (!AnalyseTensorLifetimes(model, modelInfo)) {
+                return false;
+            }
+            report.models.push_back(std::move(modelInfo));
+        }
+
+        size_t usedBytes = 0;
+        if (!ArenaFits(models, maxArena, &usedBytes)) {
+            printf_err("Models don't fit in a %zu bytes arena\n", maxArena);
+            return false;
+        }
+
+        /* Used bytes in a large arena is a tight estimate already, failed
+         * allocations logged while narrowing it down are expected. */
+        info("Searching the minimum arena size between %zu and %zu bytes\n", usedBytes / 2, usedBytes);
+        size_t fits = AlignUp(usedBytes, tensorAlignment);
+        if (!ArenaFits(models, fits)) {
+            fits = maxArena;
+        }
+        size_t fails = AlignUp(usedBytes / 2, tensorAlignment);
+        if (ArenaFits(models, fails)) {
+            fits = fails;
+            fails = 0;
+        }
+        while (fits - fails > tensorAlignment) {
+            const size_t mid = AlignUp(fails + (fits - fails) / 2, tensorAlignment);
+            if (mid >= fits) {
+                break;
+            }
+            if (ArenaFits(models, mid)) {
+                fits = mid;
+            } else {
+                fails = mid;
+            }
+        }
+        report.minArenaBytes = fits;
+
+        if (!MeasureArenaUsage(models, maxArena, report.nonPersistentBytes, report.persistentBytes)) {
+            printf_err("Failed to measure the arena usage\n");
+            return false;
+        }
+        return true;
+    }
+
+    void PrintArenaReport(const ArenaReport& report, bool verbose)
+    {
+        printf("\nMinimum arena size:    %zu bytes (0x%08zx)\n", report.minArenaBytes, report.minArenaBytes);
+        printf("  persistent:          %zu bytes\n", report.persistentBytes);
+        printf("  non-persistent:      %zu bytes\n", report.nonPersistentBytes);
+
+        for (const auto& model : report.models) {
+            printf("\n%s: %" PRIu32 " operators, %zu activation tensors\n",
+                   model.name.c_str(), model.numOperators, model.tensors.size());
+            printf("  Peak of live activation tensors: %zu bytes at operator %" PRIi32 "\n",
+                   model.peakLiveBytes, model.peakOp);
+
+            if (!verbose) {
+                continue;
+            }
+            printf("  %6s %10s %6s %6s  %s\n", "tensor", "bytes", "first", "last", "name");
+            for (const auto& tensor : model.tensors) {
+                printf("  %6" PRIi32 " %10zu %6" PRIi32 " %6" PRIi32 "  %s%s\n",
+                       tensor.index, tensor.bytes, tensor.firstOp, tensor.lastOp,
+                       tensor.name.c_str(), tensor.variable ? " (variable)" : "");
+            }
+        }
+    }
+
+    size_t RecommendedArenaSize(const ArenaReport& report, uint32_t marginPct)
+    {
+        return AlignUp(report.minArenaBytes + report.minArenaBytes * marginPct / 100, tensorAlignment);
+    }
+
+    bool WriteArenaHeader(const std::string& path, const ArenaReport& report, uint32_t marginPct)
+    {
+        FILE* header = fopen(path.c_str(), "w");
+        if (!header) {
+            printf_err("Cannot write %s\n", path.c_str());
+            return false;
+        }
+
+        fprintf(header, "/* Generated by arena_analyser, do not edit. Models:");
+        for (const auto& model : report.models) {
+            fprintf(header, " %s", model.name.c_str());
+        }
+        fprintf(header, " */\n");
+        fprintf(header, "#ifndef ARENA_SIZE_H\n#define ARENA_SIZE_H\n\n");
+        fprintf(header, "#define ARENA_MIN_BYTES             (%zu)\n", report.minArenaBytes);
+        fprintf(header, "#define ARENA_PERSISTENT_BYTES      (%zu)\n", report.persistentBytes);
+        fprintf(header, "#define ARENA_NON_PERSISTENT_BYTES  (%zu)\n", report.nonPersistentBytes);
+        fprintf(header, "\n/* Minimum plus %" PRIu32 "%% margin. */\n", marginPct);
+        fprintf(header, "#define ACTIVATION_BUF_SZ           0x%08zx\n",
+                RecommendedArenaSize(report, marginPct));
+        fprintf(header, "\n#endif /* ARENA_SIZE_H */\n");
+
+        return fclose(header) == 0;
+    }
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BatchEvaluator.hpp"
+
+#include "log_macros.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    static const char* const s_stageNames[NumEvalStages] = {
+        "Load", "Pre-processing", "Inference", "Post-processing"
+    };
+
+    StageTimer::StageTimer(ItemResult& result)
+    :   m_result{result},
+        m_last{std::chrono::steady_clock::now()}
+    {}
+
+    void StageTimer::Lap(EvalStage stage)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        this->m_result.stageMs[stage] +=
+            std::chrono::duration<double, std::milli>(now - this->m_last).count();
+        this->m_last = now;
+    }
+
+    bool ReadManifest(const std::string& path, std::vector<ManifestEntry>& entries)
+    {
+        std::ifstream manifest(path);
+        if (!manifest) {
+            printf_err("Cannot open manifest %s\n", path.c_str());
+            return false;
+        }
+
+        const size_t slash = path.find_last_of('/');
+        const std::string baseDir = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+
+        std::string line;
+        size_t lineNo = 0;
+        while (std::getline(manifest, line)) {
+            ++lineNo;
+            std::replace(line.begin(), line.end(), ',', ' ');
+            std::istringstream fields(line);
+            ManifestEntry entry;
+            if (!(fields >> entry.path) || entry.path[0] == '#') {
+                continue;
+            }
+            if (!(fields >> entry.label)) {
+                printf_err("%s:%zu: missing label\n", path.c_str(), lineNo);
+                return false;
+            }
+            if (entry.path[0] != '/') {
+                entry.path = baseDir + entry.path;
+            }
+            entries.push_back(std::move(entry));
+        }
+        return true;
+    }
+
+    BatchEvaluator::BatchEvaluator(PipelineFactory factory, uint32_t numWorkers)
+    :   m_factory{std::move(factory)},
+        m_numWorkers{numWorkers}
+    {
+        if (this->m_numWorkers == 0) {
+            this->m_numWorkers = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+
+    uint32_t BatchEvaluator::GetNumWorkers() const
+    {
+        return this->m_numWorkers;
+    }
+
+    static LatencyStats Summarise(std::vector<double>& samples)
+    {
+        LatencyStats stats;
+        if (samples.empty()) {
+            return stats;
+        }
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double s : samples) {
+            sum += s;
+        }
+        stats.mean = sum / samples.size();
+        stats.min = samples.front();
+        stats.max = samples.back();
+        stats.p50 = samples[(samples.size() - 1) / 2];
+        stats.p95 = samples[(samples.size() - 1) * 95 / 100];
+        return stats;
+    }
+
+    bool BatchEvaluator::Run(const std::vector<ManifestEntry>& entries, EvalReport& report,
+                             std::vector<ItemResult>* results)
+    {
+        std::vector<ItemResult> itemResults(entries.size());
+        std::atomic<size_t> nextItem{0};
+        std::atomic<size_t> done{0};
+        std::atomic<bool> pipelineFailed{false};
+
+        const uint32_t numWorkers = std::min<uint32_t>(
+            this->m_numWorkers, std::max<size_t>(1, entries.size()));
+        const auto start = std::chrono::steady_clock::now();
+
+        auto worker = [&]() {
+            std::unique_ptr<EvalPipeline> pipeline = this->m_factory();
+            if (!pipeline) {
+                pipelineFailed = true;
+                return;
+            }
+            for (size_t i = nextItem++; i < entries.size(); i = nextItem++) {
+                itemResults[i].ok = pipeline->Run(entries[i], itemResults[i]);
+                const size_t finished = ++done;
+                if (finished % 100 == 0) {
+                    info("%zu/%zu items evaluated\n", finished, entries.size());
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t w = 1; w < numWorkers; ++w) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        report = EvalReport{};
+        report.total = entries.size();
+        report.workers = numWorkers;
+        report.wallSeconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> stageSamples[NumEvalStages];
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const ItemResult& result = itemResults[i];
+            if (!result.ok) {
+                ++report.failed;
+                continue;
+            }
+            const bool correct = result.predicted == entries[i].label;
+            report.correct += correct;
+            auto& labelStats = report.perLabel[entries[i].label];
+            labelStats.first += correct;
+            ++labelStats.second;
+            for (int s = 0; s < NumEvalStages; ++s) {
+                stageSamples[s].push_back(result.stageMs[s]);
+            }
+        }
+
+        const size_t evaluated = report.total - report.failed;
+        report.accuracy = evaluated ? static_cast<double>(report.correct) / evaluated : 0;
+        for (int s = 0; s < NumEvalStages; ++s) {
+            report.stages[s] = Summarise(stageSamples[s]);
+        }
+
+        if (results) {
+            *results = std::move(itemResults);
+        }
+
+        if (pipelineFailed) {
+            printf_err("Failed to create an evaluation pipeline\n");
+            return false;
+        }
+        return true;
+    }
+
+    void PrintReport(const EvalReport& report)
+    {
+        const size_t evaluated = report.total - report.failed;
+        printf("\nEvaluated %zu/%zu items with %" PRIu32 " workers in %.2f s (%.1f items/s)\n",
+               evaluated, report.total, report.workers, report.wallSeconds,
+               report.wallSeconds > 0 ? evaluated / report.wallSeconds : 0.0);
+        printf("Accuracy: %.2f%% (%zu/%zu)\n", 100.0 * report.accuracy, report.correct, evaluated);
+
+        printf("\n%-16s %10s %10s %10s %10s %10s\n", "Stage (ms)", "mean", "min", "p50", "p95", "max");
+        for (int s = 0; s < NumEvalStages; ++s) {
+            const LatencyStats& st = report.stages[s];
+            printf("%-16s %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                   s_stageNames[s], st.mean, st.min, st.p50, st.p95, st.max);
+        }
+
+        printf("\n%-24s %10s %10s\n", "Label", "accuracy", "items");
+        for (const auto& label : report.perLabel) {
+            printf("%-24s %9.2f%% %10zu\n", label.first.c_str(),
+                   100.0 * label.second.first / label.second.second, label.second.second);
+        }
+    }
+
+    bool WriteResultsCsv(const std::string& path, const std::vector<ManifestEntry>& entries,
+                         const std::vector<ItemResult>& results)
+    {
+        FILE* csv = fopen(path.c_str(), "w");
+        if (!csv) {
+            printf_err("Cannot write %s\n", path.c_str());
+            return false;
+        }
+
+        fprintf(csv, "path,label,predicted,score,ok,load_ms,pre_ms,inference_ms,post_ms\n");
+        for (size_t i = 0; i < entries.size() && i < results.size(); ++i) {
+            const ItemResult& r = results[i];
+            fprintf(csv, "%s,%s,%s,%f,%d,%.3f,%.3f,%.3f,%.3f\n",
+                    entries[i].path.c_str(), entries[i].label.c_str(), r.predicted.c_str(),
+                    r.score, r.ok ? 1 : 0, r.stageMs[StageLoad], r.stageMs[StagePreProcess],
+                    r.stageMs[StageInference], r.stageMs[StagePostProcess]);
+        }
+        fclose(csv);
+        return true;
+    }
+
+    int EvalMain(int argc, char** argv, PipelineFactory factory)
+    {
+        std::string manifestPath;
+        std::string csvPath;
+        uint32_t numWorkers = 0;
+
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+                numWorkers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                csvPath = argv[++i];
+            } else if (argv[i][0] != '-' && manifestPath.empty()) {
+                manifestPath = argv[i];
+            } else {
+                manifestPath.clear();
+                break;
+            }
+        }
+
+        if (manifestPath.empty()) {
+            printf("Usage: %s <manifest> [-j workers] [-o results.csv]\n", argv[0]);
+            printf("Each manifest line holds an input file and its expected label.\n");
+            return EXIT_FAILURE;
+        }
+
+        std::vector<ManifestEntry> entries;
+        if (!ReadManifest(manifestPath, entries)) {
+            return EXIT_FAILURE;
+        }
+
+        BatchEvaluator evaluator{std::move(factory), numWorkers};
+        info("Evaluating %zu items from %s with %" PRIu32 " workers\n",
+             entries.size(), manifestPath.c_str(), evaluator.GetNumWorkers());
+
+        EvalReport report;
+        std::vector<ItemResult> results;
+        if (!evaluator.Run(entries, report, &results)) {
+            return EXIT_FAILURE;
+        }
+
+        PrintReport(report);
+
+        if (!csvPath.empty() && !WriteResultsCsv(csvPath, entries, results)) {
+            return EXIT_FAILURE;
+        }
+        return report.failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
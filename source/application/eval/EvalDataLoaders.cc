@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "EvalDataLoaders.hpp"
+
+#include "log_macros.h"
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    static uint32_t ReadLe32(const uint8_t* p)
+    {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    static uint16_t ReadLe16(const uint8_t* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    bool LoadWav(const std::string& path, std::vector<int16_t>& samples, uint32_t& sampleRate)
+    {
+        std::ifstream wav(path, std::ios::binary);
+        uint8_t riff[12];
+        if (!wav.read(reinterpret_cast<char*>(riff), sizeof(riff)) ||
+                std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) {
+            printf_err("%s is not a WAV file\n", path.c_str());
+            return false;
+        }
+
+        uint16_t channels = 0;
+        uint8_t chunk[8];
+        while (wav.read(reinterpret_cast<char*>(chunk), sizeof(chunk))) {
+            const uint32_t size = ReadLe32(chunk + 4);
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+                std::vector<uint8_t> fmt(size + (size & 1));
+                if (!wav.read(reinterpret_cast<char*>(fmt.data()), fmt.size())) {
+                    break;
+                }
+                const uint16_t format = ReadLe16(&fmt[0]);
+                channels = ReadLe16(&fmt[2]);
+                sampleRate = ReadLe32(&fmt[4]);
+                if ((format != 1 && format != 0xFFFE) || ReadLe16(&fmt[14]) != 16 || channels == 0) {
+                    printf_err("%s: only 16-bit PCM is supported\n", path.c_str());
+                    return false;
+                }
+            } else if (std::memcmp(chunk, "data", 4) == 0 && channels != 0) {
+                std::vector<int16_t> interleaved(size / sizeof(int16_t));
+                wav.read(reinterpret_cast<char*>(interleaved.data()),
+                         interleaved.size() * sizeof(int16_t));
+                interleaved.resize(wav.gcount() / sizeof(int16_t));
+
+                samples.resize(interleaved.size() / channels);
+                for (size_t i = 0; i < samples.size(); ++i) {
+                    int32_t sum = 0;
+                    for (uint16_t c = 0; c < channels; ++c) {
+                        sum += interleaved[i * channels + c];
+                    }
+                    samples[i] = static_cast<int16_t>(sum / channels);
+                }
+                return true;
+            } else {
+                wav.seekg(size + (size & 1), std::ios::cur);
+            }
+        }
+
+        printf_err("%s: no PCM data found\n", path.c_str());
+        return false;
+    }
+
+    /* Reads the next header field of a PNM file, skipping whitespace and comments. */
+    static bool ReadPnmField(std::ifstream& file, uint32_t& value)
+    {
+        int c = file.get();
+        while (c != EOF && (std::isspace(c) || c == '#')) {
+            if (c == '#') {
+                while (c != EOF && c != '\n') {
+                    c = file.get();
+                }
+            }
+            c = file.get();
+        }
+        if (!std::isdigit(c)) {
+            return false;
+        }
+        value = 0;
+        while (std::isdigit(c)) {
+            value = value * 10 + (c - '0');
+            c = file.get();
+        }
+        /* Exactly one whitespace character separates the header from the pixels. */
+        return c != EOF;
+    }
+
+    bool LoadImageRgb(const std::string& path, uint32_t width, uint32_t height,
+                      std::vector<uint8_t>& rgb)
+    {
+        std::ifstream file(path, std::ios::binary);
+        char magic[2];
+        if (!file.read(magic, sizeof(magic)) || magic[0] != 'P' || (magic[1] != '5' && magic[1] != '6')) {
+            printf_err("%s is not a binary PPM/PGM image\n", path.c_str());
+            return false;
+        }
+
+        const uint32_t channels = magic[1] == '6' ? 3 : 1;
+        uint32_t srcWidth;
+        uint32_t srcHeight;
+        uint32_t maxVal;
+        if (!ReadPnmField(file, srcWidth) || !ReadPnmField(file, srcHeight) ||
+                !ReadPnmField(file, maxVal) || maxVal == 0 || maxVal > 255 ||
+                srcWidth == 0 || srcHeight == 0) {
+            printf_err("%s: unsupported image header\n", path.c_str());
+            return false;
+        }
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(srcWidth) * srcHeight * channels);
+        if (!file.read(reinterpret_cast<char*>(pixels.data()), pixels.size())) {
+            printf_err("%s: truncated image\n", path.c_str());
+            return false;
+        }
+
+        rgb.resize(static_cast<size_t>(width) * height * 3);
+        uint8_t* dst = rgb.data();
+        for (uint32_t y = 0; y < height; ++y) {
+            const uint32_t srcY = y * srcHeight / height;
+            for (uint32_t x = 0; x < width; ++x) {
+                const uint32_t srcX = x * srcWidth / width;
+                const uint8_t* src = &pixels[(static_cast<size_t>(srcY) * srcWidth + srcX) * channels];
+                for (uint32_t c = 0; c < 3; ++c) {
+                    const uint32_t value = src[channels == 3 ? c : 0];
+                    *dst++ = static_cast<uint8_t>(maxVal == 255 ? value : value * 255 / maxVal);
+                }
+            }
+        }
+        return true;
+    }
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ARENA_ANALYSER_HPP
+#define ARENA_ANALYSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    /** A model to place in the arena. */
+    struct ArenaModel {
+        std::string     name;           /**< Name used in the report. */
+        const uint8_t*  data{nullptr};  /**< TensorFlow Lite flatbuffer. */
+        size_t          size{0};        /**< Size of the flatbuffer in bytes. */
+    };
+
+    /** Lifetime of a tensor the memory planner places in the arena. */
+    struct TensorLifetime {
+        int32_t     index{-1};          /**< Tensor index in the subgraph. */
+        std::string name;               /**< Tensor name, if the model has one. */
+        size_t      bytes{0};           /**< Size of the tensor. */
+        int32_t     firstOp{0};         /**< First operator using the tensor. */
+        int32_t     lastOp{0};          /**< Last operator using the tensor. */
+        bool        variable{false};    /**< Variable tensors live for the whole graph. */
+    };
+
+    /** Activation tensors of one model. */
+    struct ModelArenaInfo {
+        std::string                 name;
+        uint32_t                    numOperators{0};
+        std::vector<TensorLifetime> tensors;        /**< Non-constant tensors, by index. */
+        size_t                      peakLiveBytes{0}; /**< Largest sum of live tensors. */
+        int32_t                     peakOp{-1};     /**< Operator where peakLiveBytes is reached. */
+    };
+
+    /**
+     * Arena requirements of a set of models sharing one arena. The two parts
+     * are measured with a recording allocator; alignment padding between them
+     * is only counted in the minimum.
+     */
+    struct ArenaReport {
+        size_t  minArenaBytes{0};       /**< Smallest arena AllocateTensors accepts. */
+        size_t  persistentBytes{0};     /**< Tail of the arena: allocator, interpreter and kernel data. */
+        size_t  nonPersistentBytes{0};  /**< Head of the arena: planned activation tensors and scratch. */
+        std::vector<ModelArenaInfo> models;
+    };
+
+    /**
+     * @brief       Checks whether the models can all be initialised in an arena
+     *              of the given size. As in the kws_asr use case, every model
+     *              after the first one reuses the allocator of the first.
+     * @param[in]   models      Models to initialise, in order.
+     * @param[in]   arenaSize   Arena size to try, in bytes.
+     * @param[out]  usedBytes   Optional: arena bytes used on success.
+     * @return      true if all the tensors could be allocated, false otherwise.
+     **/
+    bool ArenaFits(const std::vector<ArenaModel>& models, size_t arenaSize,
+                   size_t* usedBytes = nullptr);
+
+    /**
+     * @brief       Works out the operator range each activation tensor of a
+     *              model is live for, from the flatbuffer alone.
+     * @param[in]   model   Model to analyse.
+     * @param[out]  info    Tensor lifetimes and peak of live tensors.
+     * @return      true if successful, false otherwise.
+     **/
+    bool AnalyseTensorLifetimes(const ArenaModel& model, ModelArenaInfo& info);
+
+    /**
+     * @brief       Finds the smallest arena the models fit in, by bisection
+     *              between half of what they use in a large arena and that
+     *              large arena, and measures its persistent and non-persistent
+     *              parts.
+     * @param[in]   models      Models sharing the arena.
+     * @param[in]   maxArena    Upper bound of the search, in bytes.
+     * @param[out]  report      Arena requirements.
+     * @return      true if successful, false if the models don't fit maxArena.
+     **/
+    bool AnalyseArena(const std::vector<ArenaModel>& models, size_t maxArena, ArenaReport& report);
+
+    /**
+     * @brief       Prints the report, including per tensor lifetimes if asked.
+     * @param[in]   report      Report to print.
+     * @param[in]   verbose     Whether to list every tensor.
+     **/
+    void PrintArenaReport(const ArenaReport& report, bool verbose);
+
+    /**
+     * @brief       Size to build the arena with: the minimum plus a margin,
+     *              rounded up to 16 bytes.
+     * @param[in]   report      Arena requirements.
+     * @param[in]   marginPct   Margin in percent of the minimum.
+     * @return      Arena size in bytes.
+     **/
+    size_t RecommendedArenaSize(const ArenaReport& report, uint32_t marginPct);
+
+    /**
+     * @brief       Writes a header defining ACTIVATION_BUF_SZ, which the build
+     *              checks <use_case>_ACTIVATION_BUF_SZ against when given as
+     *              <use_case>_ARENA_SIZE_HEADER, or builds with if
+     *              <use_case>_ARENA_SIZE_FROM_HEADER is set.
+     * @param[in]   path        Header to write.
+     * @param[in]   report      Arena requirements.
+     * @param[in]   marginPct   Margin in percent of the minimum.
+     * @return      true if successful, false otherwise.
+     **/
+    bool WriteArenaHeader(const std::string& path, const ArenaReport& report, uint32_t marginPct);
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* ARENA_ANALYSER_HPP */
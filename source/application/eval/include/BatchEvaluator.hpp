@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef BATCH_EVALUATOR_HPP
+#define BATCH_EVALUATOR_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    /** One line of a manifest: an input file and its expected label. */
+    struct ManifestEntry {
+        std::string path;
+        std::string label;
+    };
+
+    /** Stages timed for every item. */
+    enum EvalStage {
+        StageLoad = 0,
+        StagePreProcess,
+        StageInference,
+        StagePostProcess,
+        NumEvalStages
+    };
+
+    /** Outcome of evaluating one item. */
+    struct ItemResult {
+        bool        ok{false};                  /**< Whether the item went through the pipeline. */
+        std::string predicted;                  /**< Predicted label. */
+        float       score{0.f};                 /**< Score of the predicted label. */
+        double      stageMs[NumEvalStages]{};   /**< Time spent in each stage, milliseconds. */
+    };
+
+    /** Latency summary for one stage, in milliseconds. */
+    struct LatencyStats {
+        double mean{0};
+        double min{0};
+        double max{0};
+        double p50{0};
+        double p95{0};
+    };
+
+    /** Accuracy and latency over a whole manifest. */
+    struct EvalReport {
+        size_t          total{0};       /**< Items in the manifest. */
+        size_t          failed{0};      /**< Items that could not be evaluated. */
+        size_t          correct{0};     /**< Items whose prediction matched the label. */
+        double          accuracy{0};    /**< correct / (total - failed). */
+        double          wallSeconds{0}; /**< Elapsed time for the whole run. */
+        uint32_t        workers{0};     /**< Pipelines used. */
+        LatencyStats    stages[NumEvalStages];
+        std::map<std::string, std::pair<size_t, size_t>> perLabel; /**< Label to (correct, evaluated). */
+    };
+
+    /**
+     * @brief   Measures consecutive stages of one item: each call to Lap charges
+     *          the time since the previous call to a stage.
+     */
+    class StageTimer {
+    public:
+        explicit StageTimer(ItemResult& result);
+
+        /** @brief  Charges the time since the last lap to a stage. */
+        void Lap(EvalStage stage);
+
+    private:
+        ItemResult& m_result;
+        std::chrono::steady_clock::time_point m_last;
+    };
+
+    /**
+     * @brief   A complete model pipeline: its own Model, tensor arena and
+     *          pre/post-processing. One is created per worker and only ever used
+     *          from that worker's thread.
+     */
+    class EvalPipeline {
+    public:
+        virtual ~EvalPipeline() = default;
+
+        /**
+         * @brief       Runs one input through the pipeline.
+         * @param[in]   entry    Manifest entry to evaluate.
+         * @param[out]  result   Prediction and per-stage timings (use StageTimer).
+         * @return      true if the item was evaluated, false on error.
+         **/
+        virtual bool Run(const ManifestEntry& entry, ItemResult& result) = 0;
+    };
+
+    /** Creates a pipeline; returns nullptr on failure. Called from the worker thread. */
+    using PipelineFactory = std::function<std::unique_ptr<EvalPipeline>()>;
+
+    /**
+     * @brief       Reads a manifest. Each non-empty line not starting with '#'
+     *              holds a file path and a label separated by whitespace or a
+     *              comma. Relative paths are taken relative to the manifest.
+     * @param[in]   path      Manifest file.
+     * @param[out]  entries   Entries read.
+     * @return      true if successful, false otherwise.
+     **/
+    bool ReadManifest(const std::string& path, std::vector<ManifestEntry>& entries);
+
+    /**
+     * @brief   Runs a manifest through a pool of worker threads, each with its
+     *          own pipeline. Workers take the next unprocessed item until none is
+     *          left, so slow items don't hold the others up.
+     */
+    class BatchEvaluator {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   factory      Creates one pipeline per worker.
+         * @param[in]   numWorkers   Number of workers, 0 for one per hardware thread.
+         **/
+        BatchEvaluator(PipelineFactory factory, uint32_t numWorkers);
+
+        /**
+         * @brief       Evaluates every entry.
+         * @param[in]   entries   Items to evaluate.
+         * @param[out]  report    Accuracy and latency statistics.
+         * @param[out]  results   Optional per-item results, in manifest order.
+         * @return      true if every worker could create its pipeline, false otherwise.
+         **/
+        bool Run(const std::vector<ManifestEntry>& entries, EvalReport& report,
+                 std::vector<ItemResult>* results = nullptr);
+
+        /** @brief  Gets the number of workers used. */
+        uint32_t GetNumWorkers() const;
+
+    private:
+        PipelineFactory m_factory;
+        uint32_t        m_numWorkers;
+    };
+
+    /**
+     * @brief       Prints a report.
+     * @param[in]   report   Report to print.
+     **/
+    void PrintReport(const EvalReport& report);
+
+    /**
+     * @brief       Writes per-item results as CSV (path, label, predicted, score,
+     *              stage timings).
+     * @param[in]   path      Output file.
+     * @param[in]   entries   Evaluated entries.
+     * @param[in]   results   Results for the entries.
+     * @return      true if successful, false otherwise.
+     **/
+    bool WriteResultsCsv(const std::string& path, const std::vector<ManifestEntry>& entries,
+                         const std::vector<ItemResult>& results);
+
+    /**
+     * @brief       Command line driver shared by the use case evaluators:
+     *                  <program> <manifest> [-j workers] [-o results.csv]
+     * @param[in]   argc      Argument count.
+     * @param[in]   argv      Arguments.
+     * @param[in]   factory   Creates the use case pipeline.
+     * @return      Process exit code.
+     **/
+    int EvalMain(int argc, char** argv, PipelineFactory factory);
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* BATCH_EVALUATOR_HPP */
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVAL_DATA_LOADERS_HPP
+#define EVAL_DATA_LOADERS_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace eval {
+
+    /**
+     * @brief       Reads a 16-bit PCM WAV file, mixing all channels down to mono.
+     * @param[in]   path         WAV file.
+     * @param[out]  samples      Mono samples.
+     * @param[out]  sampleRate   Sampling rate of the file.
+     * @return      true if successful, false otherwise.
+     **/
+    bool LoadWav(const std::string& path, std::vector<int16_t>& samples, uint32_t& sampleRate);
+
+    /**
+     * @brief       Reads a binary PPM (P6) or PGM (P5) image with 8-bit samples as
+     *              RGB888, resizing it to the requested size with nearest
+     *              neighbour sampling if needed.
+     * @param[in]   path     Image file.
+     * @param[in]   width    Width wanted.
+     * @param[in]   height   Height wanted.
+     * @param[out]  rgb      width * height * 3 bytes of RGB888.
+     * @return      true if successful, false otherwise.
+     **/
+    bool LoadImageRgb(const std::string& path, uint32_t width, uint32_t height,
+                      std::vector<uint8_t>& rgb);
+
+} /* namespace eval */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* EVAL_DATA_LOADERS_HPP */
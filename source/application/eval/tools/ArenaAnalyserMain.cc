@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ArenaAnalyser.hpp"
+#include "log_macros.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+    /* Default upper bound of the search, twice the largest arena of the use cases. */
+    constexpr size_t defaultMaxArena = 0x00400000;
+
+    /* Flatbuffers are read with 16 bytes alignment, as MODEL_TFLITE_ATTRIBUTE does. */
+    struct alignas(16) Chunk {
+        uint8_t bytes[16];
+    };
+
+    bool ReadModel(const std::string& path, std::vector<Chunk>& storage, arm::app::eval::ArenaModel& model)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            printf_err("Cannot open %s\n", path.c_str());
+            return false;
+        }
+        const size_t size = static_cast<size_t>(file.tellg());
+        storage.resize((size + sizeof(Chunk) - 1) / sizeof(Chunk));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(storage.data()), size)) {
+            printf_err("Cannot read %s\n", path.c_str());
+            return false;
+        }
+
+        model.name = path.substr(path.find_last_of("/\\") + 1);
+        model.data = storage.front().bytes;
+        model.size = size;
+        return true;
+    }
+
+} /* namespace */
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> modelPaths;
+    std::string headerPath;
+    uint32_t marginPct = 0;
+    size_t maxArena = defaultMaxArena;
+    bool verbose = false;
+    bool usage = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            headerPath = argv[++i];
+        } else if (std::strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            marginPct = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+            maxArena = std::strtoull(argv[++i], nullptr, 0);
+        } else if (std::strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (argv[i][0] != '-') {
+            modelPaths.emplace_back(argv[i]);
+        } else {
+            usage = true;
+        }
+    }
+
+    if (usage || modelPaths.empty() || maxArena == 0) {
+        printf("Usage: %s <model.tflite> [<model.tflite> ...] [-o arena_size.h] [-m margin %%]"
+               " [-u max arena bytes] [-v]\n", argv[0]);
+        printf("Models given together share one arena, as in the kws_asr use case.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::vector<Chunk>> storage(modelPaths.size());
+    std::vector<arm::app::eval::ArenaModel> models(modelPaths.size());
+    for (size_t i = 0; i < modelPaths.size(); ++i) {
+        if (!ReadModel(modelPaths[i], storage[i], models[i])) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    arm::app::eval::ArenaReport report;
+    if (!arm::app::eval::AnalyseArena(models, maxArena, report)) {
+        return EXIT_FAILURE;
+    }
+    arm::app::eval::PrintArenaReport(report, verbose);
+
+    printf("\nRecommended ACTIVATION_BUF_SZ: 0x%08zx (%" PRIu32 "%% margin)\n",
+           arm::app::eval::RecommendedArenaSize(report, marginPct), marginPct);
+
+    if (!headerPath.empty()) {
+        if (!arm::app::eval::WriteArenaHeader(headerPath, report, marginPct)) {
+            return EXIT_FAILURE;
+        }
+        info("Arena size written to %s\n", headerPath.c_str());
+    }
+    return EXIT_SUCCESS;
+}
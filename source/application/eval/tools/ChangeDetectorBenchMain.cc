@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ChangeDetector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief   Runs the detector over a synthetic sequence: a fixed scene with
+     *          sensor noise, where a square moves into view for the last
+     *          quarter of the frames.
+     */
+    double RunSequence(uint32_t cols, uint32_t rows, uint32_t channels, uint32_t frames,
+                       arm::app::image::ChangeDetector& detector)
+    {
+        std::mt19937 rng{1234};
+        std::uniform_int_distribution<int> pixel{0, 255};
+        std::uniform_int_distribution<int> noise{-3, 3};
+
+        std::vector<uint8_t> scene(cols * rows * channels);
+        for (auto& value : scene) {
+            value = static_cast<uint8_t>(pixel(rng));
+        }
+
+        std::vector<uint8_t> frame(scene.size());
+        double totalNs = 0;
+        for (uint32_t f = 0; f < frames; ++f) {
+            for (size_t i = 0; i < scene.size(); ++i) {
+                frame[i] = static_cast<uint8_t>(std::min(255, std::max(0, scene[i] + noise(rng))));
+            }
+            if (f >= frames - frames / 4) {
+                const uint32_t side = cols / 4;
+                const uint32_t x0 = (f * 3) % (cols - side);
+                for (uint32_t y = 0; y < side && y < rows; ++y) {
+                    std::memset(&frame[(y * cols + x0) * channels], 255, side * channels);
+                }
+            }
+
+            const auto start = Clock::now();
+            detector.HasChanged(frame.data());
+            totalNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        }
+        return totalNs / frames;
+    }
+
+    double BenchmarkSad(uint32_t len, uint32_t iterations)
+    {
+        std::vector<uint8_t> a(len);
+        std::vector<uint8_t> b(len);
+        for (uint32_t i = 0; i < len; ++i) {
+            a[i] = static_cast<uint8_t>(i * 7);
+            b[i] = static_cast<uint8_t>(i * 13);
+        }
+
+        volatile uint32_t sink = 0;
+        const auto start = Clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            sink = sink + arm::app::image::ChangeDetector::SumAbsDiffU8(a.data(), b.data(), len);
+        }
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        return ns / (static_cast<double>(iterations) * len);
+    }
+
+} /* namespace */
+
+int main(int argc, char** argv)
+{
+    uint32_t cols = 224;
+    uint32_t rows = 224;
+    uint32_t channels = 3;
+    uint32_t frames = 400;
+    arm::app::image::ChangeDetectorParams params;
+    bool usage = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-s") == 0 && i + 2 < argc) {
+            cols = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            rows = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            channels = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            frames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            params.blockThreshold = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            params.subsample = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            params.refreshInterval = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            usage = true;
+        }
+    }
+
+    if (usage || cols < 8 || rows < 8 || (channels != 1 && channels != 3) || frames == 0) {
+        printf("Usage: %s [-s cols rows] [-c 1|3] [-f frames] [-t block threshold]"
+               " [-n subsample] [-r refresh interval]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    arm::app::image::ChangeDetector detector(cols, rows, channels, params);
+    const double frameNs = RunSequence(cols, rows, channels, frames, detector);
+
+    printf("Frame %" PRIu32 "x%" PRIu32 "x%" PRIu32 ", subsample %" PRIu32 ", block %" PRIu32
+           ", threshold %" PRIu32 ", refresh %" PRIu32 "\n",
+           cols, rows, channels, params.subsample, params.blockSize,
+           params.blockThreshold, params.refreshInterval);
+    printf("Change detection: %.0f ns per frame\n", frameNs);
+    printf("Inferences executed: %" PRIu32 ", skipped: %" PRIu32 " (%.1f%%)\n",
+           detector.GetExecutedCount(), detector.GetSkippedCount(),
+           100.0 * detector.GetSkippedCount() / frames);
+    printf("SAD kernel: %.3f ns per byte\n", BenchmarkSad(4096, 10000));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BatchEvaluator.hpp"
+#include "Classifier.hpp"
+#include "EvalDataLoaders.hpp"
+#include "ImgClassProcessing.hpp"
+#include "Labels.hpp"
+#include "MobileNetModel.hpp"
+#include "log_macros.h"
+
+namespace arm {
+namespace app {
+    namespace img_class {
+        extern uint8_t* GetModelPointer();
+        extern size_t GetModelLen();
+    } /* namespace img_class */
+} /* namespace app */
+} /* namespace arm */
+
+namespace {
+
+    using namespace arm::app;
+
+    /**
+     * @brief   Image classification pipeline. Images are resized to the model
+     *          input and classified by the top-1 label.
+     */
+    class ImgClassEvalPipeline : public eval::EvalPipeline {
+    public:
+        explicit ImgClassEvalPipeline(const LabelTable& labels)
+        :   m_arena{new uint8_t[ACTIVATION_BUF_SZ]},
+            m_labels{labels}
+        {}
+
+        bool Init()
+        {
+            if (!this->m_model.Init(this->m_arena.get(), ACTIVATION_BUF_SZ,
+                                    img_class::GetModelPointer(), img_class::GetModelLen())) {
+                return false;
+            }
+
+            TfLiteIntArray* inputShape = this->m_model.GetInputShape(0);
+            this->m_cols = inputShape->data[MobileNetModel::ms_inputColsIdx];
+            this->m_rows = inputShape->data[MobileNetModel::ms_inputRowsIdx];
+            if (inputShape->data[MobileNetModel::ms_inputChannelsIdx] != 3) {
+                printf_err("Expected an RGB model input\n");
+                return false;
+            }
+
+            this->m_preProcess.reset(new ImgClassPreProcess(this->m_model.GetInputTensor(0),
+                                                            this->m_model.IsDataSigned()));
+            this->m_postProcess.reset(new ImgClassPostProcess(this->m_model.GetOutputTensor(0),
+                                                              this->m_classifier, this->m_labels,
+                                                              this->m_results));
+            return true;
+        }
+
+        bool Run(const eval::ManifestEntry& entry, eval::ItemResult& result) override
+        {
+            eval::StageTimer timer{result};
+
+            if (!eval::LoadImageRgb(entry.path, this->m_cols, this->m_rows, this->m_image)) {
+                return false;
+            }
+            timer.Lap(eval::StageLoad);
+
+            if (!this->m_preProcess->DoPreProcess(this->m_image.data(), this->m_image.size())) {
+                return false;
+            }
+            timer.Lap(eval::StagePreProcess);
+
+            if (!this->m_model.RunInference()) {
+                return false;
+            }
+            timer.Lap(eval::StageInference);
+
+            if (!this->m_postProcess->DoPostProcess() || this->m_results.empty()) {
+                return false;
+            }
+            result.predicted = this->m_results[0].m_label.ToString();
+            result.score = this->m_results[0].m_normalisedVal;
+            timer.Lap(eval::StagePostProcess);
+            return true;
+        }
+
+    private:
+        std::unique_ptr<uint8_t[]> m_arena;
+        MobileNetModel m_model;
+        Classifier m_classifier;
+        LabelTable m_labels;
+        std::vector<ClassificationResult> m_results;
+        std::vector<uint8_t> m_image;
+        uint32_t m_cols{0};
+        uint32_t m_rows{0};
+        std::unique_ptr<ImgClassPreProcess> m_preProcess;
+        std::unique_ptr<ImgClassPostProcess> m_postProcess;
+    };
+
+} /* namespace */
+
+int main(int argc, char** argv)
+{
+    const LabelTable labels = GetLabels();
+
+    return arm::app::eval::EvalMain(argc, argv, [labels]() {
+        std::unique_ptr<ImgClassEvalPipeline> pipeline{new ImgClassEvalPipeline(labels)};
+        if (!pipeline->Init()) {
+            return std::unique_ptr<arm::app::eval::EvalPipeline>{};
+        }
+        return std::unique_ptr<arm::app::eval::EvalPipeline>{std::move(pipeline)};
+    });
+}
@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BatchEvaluator.hpp"
+#include "EvalDataLoaders.hpp"
+#include "KwsClassifier.hpp"
+#include "KwsProcessing.hpp"
+#include "Labels.hpp"
+#include "MicroNetKwsModel.hpp"
+#include "log_macros.h"
+
+#include <cinttypes>
+
+namespace arm {
+namespace app {
+    namespace kws {
+        extern uint8_t* GetModelPointer();
+        extern size_t GetModelLen();
+    } /* namespace kws */
+} /* namespace app */
+} /* namespace arm */
+
+namespace {
+
+    using namespace arm::app;
+
+    /**
+     * @brief   Keyword spotting pipeline. A clip is classified as the top label
+     *          with the highest score over all its inference windows, clips
+     *          shorter than one window being padded with silence.
+     */
+    class KwsEvalPipeline : public eval::EvalPipeline {
+    public:
+        explicit KwsEvalPipeline(const LabelTable& labels)
+        :   m_arena{new uint8_t[ACTIVATION_BUF_SZ]},
+            m_labels{labels}
+        {}
+
+        bool Init()
+        {
+            if (!this->m_model.Init(this->m_arena.get(), ACTIVATION_BUF_SZ,
+                                    kws::GetModelPointer(), kws::GetModelLen())) {
+                return false;
+            }
+
+            TfLiteIntArray* inputShape = this->m_model.GetInputShape(0);
+            const uint32_t numMfccFeatures = inputShape->data[MicroNetKwsModel::ms_inputColsIdx];
+            const uint32_t numMfccFrames = inputShape->data[MicroNetKwsModel::ms_inputRowsIdx];
+
+            this->m_preProcess.reset(new KwsPreProcess(this->m_model.GetInputTensor(0),
+                                                       numMfccFeatures, numMfccFrames,
+                                                       kws::g_FrameLength, kws::g_FrameStride));
+            this->m_postProcess.reset(new KwsPostProcess(this->m_model.GetOutputTensor(0),
+                                                         this->m_classifier, this->m_labels,
+                                                         this->m_results));
+            return true;
+        }
+
+        bool Run(const eval::ManifestEntry& entry, eval::ItemResult& result) override
+        {
+            eval::StageTimer timer{result};
+
+            std::vector<int16_t> audio;
+            uint32_t sampleRate = 0;
+            if (!eval::LoadWav(entry.path, audio, sampleRate)) {
+                return false;
+            }
+            if (sampleRate != audio::MicroNetKwsMFCC::ms_defaultSamplingFreq) {
+                warn("%s is sampled at %" PRIu32 " Hz\n", entry.path.c_str(), sampleRate);
+            }
+
+            const size_t windowSize = this->m_preProcess->m_audioDataWindowSize;
+            if (audio.size() < windowSize) {
+                audio.resize(windowSize, 0);
+            }
+            timer.Lap(eval::StageLoad);
+
+            audio::SlidingWindow<const int16_t> audioSlider(audio.data(), audio.size(), windowSize,
+                                                            this->m_preProcess->m_audioDataStride);
+            result.score = -1.f;
+            while (audioSlider.HasNext()) {
+                const int16_t* window = audioSlider.Next();
+
+                if (!this->m_preProcess->DoPreProcess(window, audioSlider.Index())) {
+                    return false;
+                }
+                timer.Lap(eval::StagePreProcess);
+
+                if (!this->m_model.RunInference()) {
+                    return false;
+                }
+                timer.Lap(eval::StageInference);
+
+                if (!this->m_postProcess->DoPostProcess()) {
+                    return false;
+                }
+                if (!this->m_results.empty() && this->m_results[0].m_normalisedVal > result.score) {
+                    result.score = this->m_results[0].m_normalisedVal;
+                    result.predicted = this->m_results[0].m_label.ToString();
+                }
+                timer.Lap(eval::StagePostProcess);
+            }
+            return true;
+        }
+
+    private:
+        std::unique_ptr<uint8_t[]> m_arena;
+        MicroNetKwsModel m_model;
+        KwsClassifier m_classifier;
+        LabelTable m_labels;
+        std::vector<ClassificationResult> m_results;
+        std::unique_ptr<KwsPreProcess> m_preProcess;
+        std::unique_ptr<KwsPostProcess> m_postProcess;
+    };
+
+} /* namespace */
+
+int main(int argc, char** argv)
+{
+    const LabelTable labels = GetLabels();
+
+    return arm::app::eval::EvalMain(argc, argv, [labels]() {
+        std::unique_ptr<KwsEvalPipeline> pipeline{new KwsEvalPipeline(labels)};
+        if (!pipeline->Init()) {
+            return std::unique_ptr<arm::app::eval::EvalPipeline>{};
+        }
+        return std::unique_ptr<arm::app::eval::EvalPipeline>{std::move(pipeline)};
+    });
+}
@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "CascadeScheduler.hpp"
+#include "log_macros.h"
+
+#include <cinttypes>
+#include <utility>
+
+namespace arm {
+namespace app {
+
+    CascadeScheduler::CascadeScheduler(Profiler* profiler)
+    :   m_profiler{profiler}
+    {}
+
+    bool CascadeScheduler::AddStage(const char* name, Model& model,
+                                    BasePreProcess& preProcess, BasePostProcess& postProcess,
+                                    CascadeGate gate, uint32_t minFrameInterval)
+    {
+        return this->AddStage(name, model,
+                              [&preProcess](const void* input, size_t inputSize) {
+                                  return preProcess.DoPreProcess(input, inputSize);
+                              },
+                              postProcess, std::move(gate), minFrameInterval);
+    }
+
+    bool CascadeScheduler::AddStage(const char* name, Model& model,
+                                    CascadePreProcess preProcess, BasePostProcess& postProcess,
+                                    CascadeGate gate, uint32_t minFrameInterval)
+    {
+        if (name == nullptr) {
+            printf_err("Cascade stage needs a name\n");
+            return false;
+        } else if (!preProcess) {
+            printf_err("Cascade stage %s needs a pre-processing step\n", name);
+            return false;
+        }
+
+        Stage stage;
+        stage.name = name;
+        stage.preProfileName = stage.name + " pre-processing";
+        stage.infProfileName = stage.name + " inference";
+        stage.postProfileName = stage.name + " post-processing";
+        stage.model = &model;
+        stage.preProcess = std::move(preProcess);
+        stage.postProcess = &postProcess;
+        stage.gate = std::move(gate);
+        stage.minFrameInterval = minFrameInterval > 0 ? minFrameInterval : 1;
+        this->m_stages.emplace_back(std::move(stage));
+
+        return true;
+    }
+
+    bool CascadeScheduler::Run(const void* input, size_t inputSize)
+    {
+        ++this->m_frameCount;
+        this->m_numStagesRun = 0;
+
+        for (auto& stage : this->m_stages) {
+            /* Rate limited stages stop the cascade; their last results stay valid. */
+            if (stage.runCount > 0 &&
+                    this->m_frameCount - stage.lastRunFrame < stage.minFrameInterval) {
+                break;
+            }
+
+            if (!this->RunStage(stage, input, inputSize)) {
+                return false;
+            }
+
+            stage.lastRunFrame = this->m_frameCount;
+            ++stage.runCount;
+            ++this->m_numStagesRun;
+
+            if (stage.gate && !stage.gate()) {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    bool CascadeScheduler::RunStage(Stage& stage, const void* input, size_t inputSize)
+    {
+        if (this->m_profiler) {
+            this->m_profiler->StartProfiling(stage.preProfileName.c_str());
+        }
+        const bool preOk = stage.preProcess(input, inputSize);
+        if (this->m_profiler) {
+            this->m_profiler->StopProfiling();
+        }
+        if (!preOk) {
+            printf_err("Pre-processing failed for cascade stage %s\n", stage.name.c_str());
+            return false;
+        }
+
+        if (this->m_profiler) {
+            this->m_profiler->StartProfiling(stage.infProfileName.c_str());
+        }
+        const bool infOk = stage.model->RunInference();
+        if (this->m_profiler) {
+            this->m_profiler->StopProfiling();
+        }
+        if (!infOk) {
+            printf_err("Inference failed for cascade stage %s\n", stage.name.c_str());
+            return false;
+        }
+
+        if (this->m_profiler) {
+            this->m_profiler->StartProfiling(stage.postProfileName.c_str());
+        }
+        const bool postOk = stage.postProcess->DoPostProcess();
+        if (this->m_profiler) {
+            this->m_profiler->StopProfiling();
+        }
+        if (!postOk) {
+            printf_err("Post-processing failed for cascade stage %s\n", stage.name.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    size_t CascadeScheduler::GetNumStages() const
+    {
+        return this->m_stages.size();
+    }
+
+    size_t CascadeScheduler::GetNumStagesRun() const
+    {
+        return this->m_numStagesRun;
+    }
+
+    uint32_t CascadeScheduler::GetRunCount(size_t stageIdx) const
+    {
+        if (stageIdx >= this->m_stages.size()) {
+            return 0;
+        }
+        return this->m_stages[stageIdx].runCount;
+    }
+
+    uint32_t CascadeScheduler::GetFrameCount() const
+    {
+        return this->m_frameCount;
+    }
+
+    void CascadeScheduler::Reset()
+    {
+        this->m_frameCount = 0;
+        this->m_numStagesRun = 0;
+        for (auto& stage : this->m_stages) {
+            stage.lastRunFrame = 0;
+            stage.runCount = 0;
+        }
+    }
+
+    void CascadeScheduler::PrintStats() const
+    {
+        info("Cascade ran on %" PRIu32 " inputs\n", this->m_frameCount);
+        for (const auto& stage : this->m_stages) {
+            info("\t%s: %" PRIu32 " runs\n", stage.name.c_str(), stage.runCount);
+        }
+    }
+
+} /* namespace app */
+} /* namespace arm */
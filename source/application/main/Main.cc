@@ -22,6 +22,7 @@
 #include "hal.h"                    /* our hardware abstraction api */
 #include "log_macros.h"
 #include "TensorFlowLiteMicro.hpp"  /* our inference logic api */
+#include "MemoryTracker.hpp"        /* Heap usage counters */
 
 #include <cstdio>
 #include <new>
@@ -44,6 +45,11 @@ static void print_application_intro()
 static void out_of_heap()
 {
     warn("Out of heap\n");
+#if MEMORY_PROFILING
+    const auto heap = arm::app::memory::GetHeapCounters();
+    warn("Heap in use: %zu bytes, peak %zu bytes, %" PRIu32 " allocations\n",
+         heap.inUseBytes, heap.peakBytes, heap.allocations);
+#endif /* MEMORY_PROFILING */
     std::terminate();
 }
 
@@ -64,6 +70,7 @@ int main ()
 
     /* This is unreachable without errors. */
     info("program terminating...\n");
+    log_flush();
 
     /* Release platform. */
     hal_platform_release();
@@ -23,6 +23,7 @@
 
 void DisplayCommonMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -63,7 +64,7 @@ bool PresentInferenceResult(const std::vector<arm::app::ClassificationResult>& r
             resultStr.c_str(), resultStr.size(), dataPsnTxtStartX1, rowIdx1, false);
         rowIdx1 += dataPsnTxtYIncr;
 
-        resultStr = std::to_string(i + 1) + ") " + results[i].m_label;
+        resultStr = std::to_string(i + 1) + ") " + results[i].m_label.c_str();
         hal_lcd_display_text(resultStr.c_str(), resultStr.size(), dataPsnTxtStartX2, rowIdx2, 0);
         rowIdx2 += dataPsnTxtYIncr;
 
@@ -123,6 +124,37 @@ namespace app {
         return runInf;
     }
 
+    void RegisterModelBuffers(uint8_t* tensorArena, uint32_t tensorArenaSize,
+                              const uint8_t* modelAddr, uint32_t modelSize)
+    {
+        hal_buffer_register("tensor_arena", tensorArena, tensorArenaSize, BUFFER_ATTR_AUTO);
+        hal_buffer_register("model", modelAddr, modelSize, BUFFER_ATTR_READ_ONLY);
+    }
+
+    bool BootModel(arm::app::Model& model, Profiler& profiler,
+                   uint8_t* tensorArena, uint32_t tensorArenaSize,
+                   const uint8_t* modelAddr, uint32_t modelSize,
+                   bool fastBoot, bool warmUp)
+    {
+        profiler.StartProfiling(warmUp ? "Time to first inference" : "Model initialisation");
+
+        RegisterModelBuffers(tensorArena, tensorArenaSize, modelAddr, modelSize);
+        model.SetFastBoot(fastBoot);
+        bool booted = model.Init(tensorArena, tensorArenaSize, modelAddr, modelSize);
+        if (booted && warmUp) {
+            booted = model.WarmUp();
+        }
+        profiler.StopProfiling();
+
+        if (!booted) {
+            printf_err("Failed to boot the model\n");
+            profiler.Reset();
+            return false;
+        }
+        profiler.PrintProfilingResult();
+        return true;
+    }
+
     int ReadUserInputAsInt()
     {
         char chInput[128];
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CASCADE_SCHEDULER_HPP
+#define CASCADE_SCHEDULER_HPP
+
+#include "BaseProcessing.hpp"
+#include "Model.hpp"
+#include "Profiler.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace arm {
+namespace app {
+
+    /**
+     * @brief   Called after a stage has been post-processed to decide whether the
+     *          next stage of the cascade should run on the same input, e.g. by
+     *          checking a score in the stage's results vector.
+     */
+    using CascadeGate = std::function<bool()>;
+
+    /**
+     * @brief   Populates a stage's input tensors from the input shared by all
+     *          stages, given as the pointer and size passed to Run().
+     */
+    using CascadePreProcess = std::function<bool(const void* input, size_t inputSize)>;
+
+    /**
+     * @brief   Runs a chain of models where each cheap stage gates the more
+     *          expensive one after it. Every stage receives the same input
+     *          (for example a camera frame or an audio window), so each
+     *          pre-processing step reads directly from the shared buffer.
+     *          Models run one after another, so they can also share a tensor
+     *          arena by initialising later models with the allocator of the
+     *          first (see Model::Init).
+     *
+     *          Example - run VWW on every frame and object detection only when
+     *          a person is likely, at most every other frame:
+     *
+     *              CascadeScheduler cascade{&profiler};
+     *              cascade.AddStage("vww", vwwModel, vwwPre, vwwPost,
+     *                  [&]() { return vwwResults[0].m_labelIdx == 1 &&
+     *                                 vwwResults[0].m_normalisedVal > 0.7; });
+     *              cascade.AddStage("det", detModel, detPre, detPost, nullptr, 2);
+     *              cascade.Run(frame, frameSize);
+     *
+     *          Pre-processing that gives DoPreProcess's second argument another
+     *          meaning, like KwsPreProcess taking the inference index, must be
+     *          adapted with a CascadePreProcess:
+     *
+     *              cascade.AddStage("kws", kwsModel,
+     *                  [&](const void* audio, size_t) { return kwsPre.DoPreProcess(audio, index); },
+     *                  kwsPost, gate);
+     */
+    class CascadeScheduler {
+    public:
+        /**
+         * @brief       Constructor.
+         * @param[in]   profiler   Optional profiler; each stage's pre-processing,
+         *                         inference and post-processing are profiled separately.
+         **/
+        explicit CascadeScheduler(Profiler* profiler = nullptr);
+
+        /**
+         * @brief       Appends a stage to the cascade.
+         * @param[in]   name               Name used for logging and profiling.
+         * @param[in]   model              Initialised model to run.
+         * @param[in]   preProcess         Pre-processing populating the model's input tensors.
+         *                                 Called with the input pointer and size given to Run().
+         * @param[in]   postProcess        Post-processing populating results from the output tensors.
+         * @param[in]   gate               Decides whether the next stage runs. If empty, it always does.
+         * @param[in]   minFrameInterval   Rate limit: the stage runs at most once every this many
+         *                                 calls to Run(). 0 and 1 both mean every call.
+         * @return      true if the stage was added, false otherwise.
+         **/
+        bool AddStage(const char* name, Model& model,
+                      BasePreProcess& preProcess, BasePostProcess& postProcess,
+                      CascadeGate gate = nullptr, uint32_t minFrameInterval = 1);
+
+        /**
+         * @brief       Appends a stage whose pre-processing is given as a callable,
+         *              e.g. to adapt the arguments of an existing pre-processor.
+         * @param[in]   name               Name used for logging and profiling.
+         * @param[in]   model              Initialised model to run.
+         * @param[in]   preProcess         Callable populating the model's input tensors.
+         * @param[in]   postProcess        Post-processing populating results from the output tensors.
+         * @param[in]   gate               Decides whether the next stage runs. If empty, it always does.
+         * @param[in]   minFrameInterval   Rate limit: the stage runs at most once every this many
+         *                                 calls to Run(). 0 and 1 both mean every call.
+         * @return      true if the stage was added, false otherwise.
+         **/
+        bool AddStage(const char* name, Model& model,
+                      CascadePreProcess preProcess, BasePostProcess& postProcess,
+                      CascadeGate gate = nullptr, uint32_t minFrameInterval = 1);
+
+        /**
+         * @brief       Runs the cascade on one input. Stages run in order until one of
+         *              them is rate limited or its gate doesn't pass.
+         * @param[in]   input       Pointer to the input shared by all stages.
+         * @param[in]   inputSize   Size of the input data.
+         * @return      true if all stages that ran succeeded, false otherwise.
+         **/
+        bool Run(const void* input, size_t inputSize);
+
+        /** @brief  Gets the number of stages in the cascade. */
+        size_t GetNumStages() const;
+
+        /** @brief  Gets the number of stages that ran during the last call to Run(). */
+        size_t GetNumStagesRun() const;
+
+        /**
+         * @brief       Gets how many times a stage has run.
+         * @param[in]   stageIdx   Index of the stage, in the order added.
+         * @return      Run count, or 0 if the index is invalid.
+         **/
+        uint32_t GetRunCount(size_t stageIdx) const;
+
+        /** @brief  Gets the number of calls to Run() so far. */
+        uint32_t GetFrameCount() const;
+
+        /** @brief  Clears the counters and rate limiting state. */
+        void Reset();
+
+        /** @brief  Logs how often each stage has run. */
+        void PrintStats() const;
+
+    private:
+        struct Stage {
+            std::string         name;
+            std::string         preProfileName;
+            std::string         infProfileName;
+            std::string         postProfileName;
+            Model*              model;
+            CascadePreProcess   preProcess;
+            BasePostProcess*    postProcess;
+            CascadeGate         gate;
+            uint32_t            minFrameInterval;
+            uint32_t            lastRunFrame{0};
+            uint32_t            runCount{0};
+        };
+
+        Profiler*           m_profiler;             /* Optional profiler. */
+        std::vector<Stage>  m_stages;               /* Stages in run order. */
+        uint32_t            m_frameCount{0};        /* Calls to Run(). */
+        size_t              m_numStagesRun{0};      /* Stages run on the last call. */
+
+        /**
+         * @brief       Runs a single stage.
+         * @return      true if successful, false otherwise.
+         **/
+        bool RunStage(Stage& stage, const void* input, size_t inputSize);
+    };
+
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* CASCADE_SCHEDULER_HPP */
@@ -78,6 +78,39 @@ namespace app {
      **/
     bool RunInference(arm::app::Model& model, Profiler& profiler);
 
+    /**
+     * @brief           Registers the tensor arena and the model as buffers
+     *                  shared with the NPU, so that inferences only do the
+     *                  cache maintenance their placement needs.
+     * @param[in]       tensorArena     Pointer to the tensor arena.
+     * @param[in]       tensorArenaSize Size of the tensor arena in bytes.
+     * @param[in]       modelAddr       Pointer to the model.
+     * @param[in]       modelSize       Size of the model in bytes.
+     **/
+    void RegisterModelBuffers(uint8_t* tensorArena, uint32_t tensorArenaSize,
+                              const uint8_t* modelAddr, uint32_t modelSize);
+
+    /**
+     * @brief           Boots a model: initialises it and, if asked, runs a
+     *                  warm-up inference. The time taken is profiled and
+     *                  reported as "Time to first inference" with a warm-up,
+     *                  the warm-up being the first inference the device runs,
+     *                  and as "Model initialisation" without.
+     * @param[in]       model           Reference to the model to initialise.
+     * @param[in]       profiler        Reference to the initialised profiler.
+     * @param[in]       tensorArena     Pointer to the tensor arena.
+     * @param[in]       tensorArenaSize Size of the tensor arena in bytes.
+     * @param[in]       modelAddr       Pointer to the model.
+     * @param[in]       modelSize       Size of the model in bytes.
+     * @param[in]       fastBoot        Whether to skip clearing and logging, see Model::SetFastBoot.
+     * @param[in]       warmUp          Whether to run a warm-up inference.
+     * @return          true if successful, false otherwise.
+     **/
+    bool BootModel(arm::app::Model& model, Profiler& profiler,
+                   uint8_t* tensorArena, uint32_t tensorArenaSize,
+                   const uint8_t* modelAddr, uint32_t modelSize,
+                   bool fastBoot, bool warmUp);
+
     /**
      * @brief           Read input and return as an integer.
      * @return          Integer value corresponding to the user input.
@@ -33,6 +33,7 @@ extern "C" {
 #include "hal_lcd.h"            /* LCD functions */
 #include "hal_audio.h"          /* AUDIO functions */
 #include "hal_image.h"          /* IMAGE functions */
+#include "hal_buffer.h"         /* Shared buffer ownership */
 
 #include <inttypes.h>
 #include <stdbool.h>
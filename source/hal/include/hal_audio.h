@@ -42,4 +42,27 @@
 
 #define hal_audio_preprocessing(data, len) audio_preprocessing(data, len)
 
+#define hal_audio_get_gain()            get_audio_gain()
+
+/**
+ * @brief start streaming capture into a queue of buffers.
+ *
+ * @param bufs      int16_t * const * array of buffers, each len samples.
+ * @param n         int number of buffers.
+ * @param len       int number of samples per block.
+ * @param cb        audio_block_callback_t called as each block completes, or NULL.
+ * @param user      void * passed to the callback.
+ */
+#define hal_audio_stream_start(bufs, n, len, cb, user) audio_stream_start(bufs, n, len, cb, user)
+
+#define hal_audio_stream_stop()                 audio_stream_stop()
+
+#define hal_audio_stream_get_block(block)       audio_stream_get_block(block)
+
+#define hal_audio_stream_wait_block(block)      audio_stream_wait_block(block)
+
+#define hal_audio_stream_release_block(block)   audio_stream_release_block(block)
+
+#define hal_audio_stream_get_overflows()        audio_stream_get_overflows()
+
 #endif // HAL_DATA_H
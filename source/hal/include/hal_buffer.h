@@ -0,0 +1,42 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#ifndef HAL_BUFFER_H
+#define HAL_BUFFER_H
+/**
+ * This file is the top level abstraction for buffers shared with bus masters
+ **/
+
+#include "buffer_ownership.h"
+
+/**
+ * @brief register a buffer shared between the CPU and the NPU or DMA.
+ *
+ * @param name      const char * name used in logs.
+ * @param base      void * start of the buffer.
+ * @param size      size_t size in bytes.
+ * @param attr      buffer_attr_t memory attribute, BUFFER_ATTR_AUTO to look it up.
+ * @return id of the buffer, or -1.
+ */
+#define hal_buffer_register(name, base, size, attr) buffer_register(name, base, size, attr)
+
+/**
+ * @brief hand a registered buffer over to an agent, doing the cache
+ *        maintenance required.
+ *
+ * @param id        int buffer id.
+ * @param agent     buffer_agent_t agent taking the buffer.
+ * @param access    buffer_access_t what the agent will do with it.
+ */
+#define hal_buffer_acquire(id, agent, access)       buffer_acquire(id, agent, access)
+
+#define hal_buffer_get_cache_stats(stats)           buffer_get_cache_stats(stats)
+
+#endif // HAL_BUFFER_H
@@ -37,4 +37,55 @@ int wait_for_audio(void);
  * the next asynchronous get into a separate buffer before running on the previous one. */
 void audio_preprocessing(int16_t *data, int len);
 
+/* Returns the gain applied by the most recent preprocessing stage, so that callers
+ * can judge levels relative to the original microphone input. */
+float get_audio_gain(void);
+
+/*
+ * Streaming capture. Instead of one outstanding get_audio_data request, the
+ * source fills a queue of caller-owned buffers with consecutive blocks of
+ * block_len samples and keeps capturing while the caller processes earlier
+ * blocks. A block whose buffer has been taken by get is owned by the caller
+ * until released. If no free buffer is available when a block starts, that
+ * block's samples are discarded and counted as an overflow. The one-shot
+ * calls above must not be used while streaming.
+ */
+
+/* Maximum number of buffers that can be registered for streaming */
+#define AUDIO_STREAM_MAX_BUFFERS 8
+
+typedef struct {
+    int16_t *data;  /* Registered buffer holding the block (same format as get_audio_data) */
+    int len;        /* Number of samples */
+    uint32_t seq;   /* Block sequence number since start; gaps indicate overflows */
+    int error;      /* 0 for success */
+} audio_block_t;
+
+/* Called from interrupt context when a block completes; may be NULL */
+typedef void (*audio_block_callback_t)(const audio_block_t *block, void *user);
+
+/* Starts continuous capture into the given buffers, each block_len samples long */
+int audio_stream_start(int16_t *const *buffers, int num_buffers, int block_len,
+                       audio_block_callback_t cb, void *user);
+
+/* Stops capture after the block in progress; pending blocks stay available */
+void audio_stream_stop(void);
+
+/* Takes the oldest completed block without waiting. Returns false if none is ready */
+bool audio_stream_get_block(audio_block_t *block);
+
+/* Waits for the oldest completed block. Returns error indication - 0 for success */
+int audio_stream_wait_block(audio_block_t *block);
+
+/* Hands a block's buffer back to the capture queue */
+void audio_stream_release_block(const audio_block_t *block);
+
+/* Returns the number of blocks dropped because no buffer was free */
+uint32_t audio_stream_get_overflows(void);
+
+/* Native (audio_stubs) only: replays a 16-bit PCM WAV file as the audio source.
+ * speed is relative to real time; 0 delivers blocks as fast as they are requested.
+ * With no file set, silence is delivered. */
+int audio_stubs_set_wav_source(const char *path, float speed);
+
 #endif // AUDIO_DATA_H
@@ -0,0 +1,139 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include "audio_stream_internal.h"
+
+#include <stdatomic.h>
+
+/* Both queues are single-producer/single-consumer between the capture
+ * interrupt and the foreground, and never hold more than the registered
+ * buffers, so free-running indices modulo the maximum are sufficient. */
+#define QUEUE_MASK (AUDIO_STREAM_MAX_BUFFERS - 1)
+
+#if (AUDIO_STREAM_MAX_BUFFERS & QUEUE_MASK) != 0
+#error "AUDIO_STREAM_MAX_BUFFERS must be a power of two"
+#endif
+
+static int16_t *free_queue[AUDIO_STREAM_MAX_BUFFERS];
+static atomic_uint free_head;   /* Written by release (foreground) */
+static atomic_uint free_tail;   /* Written by begin_block (capture) */
+
+static audio_block_t ready_queue[AUDIO_STREAM_MAX_BUFFERS];
+static atomic_uint ready_head;  /* Written by end_block (capture) */
+static atomic_uint ready_tail;  /* Written by get_block (foreground) */
+
+static audio_block_callback_t block_callback;
+static void *block_callback_user;
+static int stream_block_len;
+static uint32_t next_seq;
+static atomic_uint overflows;
+static atomic_bool stream_active;
+
+int audio_stream_setup(int16_t *const *buffers, int num_buffers, int block_len,
+                       audio_block_callback_t cb, void *user)
+{
+    if (!buffers || num_buffers <= 0 || num_buffers > AUDIO_STREAM_MAX_BUFFERS || block_len <= 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < num_buffers; ++i) {
+        if (!buffers[i]) {
+            return -1;
+        }
+        free_queue[i] = buffers[i];
+    }
+    atomic_store(&free_tail, 0);
+    atomic_store(&free_head, (unsigned) num_buffers);
+    atomic_store(&ready_head, 0);
+    atomic_store(&ready_tail, 0);
+
+    block_callback = cb;
+    block_callback_user = user;
+    stream_block_len = block_len;
+    next_seq = 0;
+    atomic_store(&overflows, 0);
+    atomic_store(&stream_active, true);
+    return 0;
+}
+
+void audio_stream_set_inactive(void)
+{
+    atomic_store(&stream_active, false);
+}
+
+bool audio_stream_is_active(void)
+{
+    return atomic_load(&stream_active);
+}
+
+int audio_stream_block_len(void)
+{
+    return stream_block_len;
+}
+
+int16_t *audio_stream_begin_block(void)
+{
+    unsigned tail = atomic_load_explicit(&free_tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&free_head, memory_order_acquire)) {
+        return NULL;
+    }
+    int16_t *buffer = free_queue[tail & QUEUE_MASK];
+    atomic_store_explicit(&free_tail, tail + 1, memory_order_release);
+    return buffer;
+}
+
+void audio_stream_end_block(int16_t *buffer, int error)
+{
+    audio_block_t block = {
+        .data = buffer,
+        .len = stream_block_len,
+        .seq = next_seq++,
+        .error = error
+    };
+
+    if (!buffer) {
+        atomic_fetch_add(&overflows, 1);
+        return;
+    }
+
+    unsigned head = atomic_load_explicit(&ready_head, memory_order_relaxed);
+    ready_queue[head & QUEUE_MASK] = block;
+    atomic_store_explicit(&ready_head, head + 1, memory_order_release);
+
+    if (block_callback) {
+        block_callback(&block, block_callback_user);
+    }
+}
+
+bool audio_stream_get_block(audio_block_t *block)
+{
+    unsigned tail = atomic_load_explicit(&ready_tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&ready_head, memory_order_acquire)) {
+        return false;
+    }
+    *block = ready_queue[tail & QUEUE_MASK];
+    atomic_store_explicit(&ready_tail, tail + 1, memory_order_release);
+    return true;
+}
+
+void audio_stream_release_block(const audio_block_t *block)
+{
+    if (!block || !block->data) {
+        return;
+    }
+    unsigned head = atomic_load_explicit(&free_head, memory_order_relaxed);
+    free_queue[head & QUEUE_MASK] = block->data;
+    atomic_store_explicit(&free_head, head + 1, memory_order_release);
+}
+
+uint32_t audio_stream_get_overflows(void)
+{
+    return atomic_load(&overflows);
+}
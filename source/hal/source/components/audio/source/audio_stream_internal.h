@@ -0,0 +1,38 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#ifndef AUDIO_STREAM_INTERNAL_H
+#define AUDIO_STREAM_INTERNAL_H
+
+#include "audio_data.h"
+
+/* Buffer queue shared by the audio backends. The backend's capture side
+ * (usually an interrupt) calls begin/end for each block; the foreground
+ * uses the get/release calls from audio_data.h. */
+
+/* Registers the buffers and clears the queues. Returns 0 for success */
+int audio_stream_setup(int16_t *const *buffers, int num_buffers, int block_len,
+                       audio_block_callback_t cb, void *user);
+
+/* Marks streaming as stopped; audio_stream_is_active() then returns false */
+void audio_stream_set_inactive(void);
+
+bool audio_stream_is_active(void);
+
+int audio_stream_block_len(void);
+
+/* Takes a free buffer for the next block, or NULL if the block must be dropped */
+int16_t *audio_stream_begin_block(void);
+
+/* Queues a completed block and notifies the callback. buffer is the value
+ * returned by audio_stream_begin_block; NULL counts an overflow instead */
+void audio_stream_end_block(int16_t *buffer, int error);
+
+#endif // AUDIO_STREAM_INTERNAL_H
@@ -1,25 +1,270 @@
 /* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
  * Use, distribution and modification of this code is permitted under the
- * terms stated in the Alif Semiconductor Software License Agreement 
+ * terms stated in the Alif Semiconductor Software License Agreement
  *
- * You should have received a copy of the Alif Semiconductor Software 
- * License Agreement with this file. If not, please write to: 
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
  * contact@alifsemi.com, or visit: https://alifsemi.com/license
  *
  */
 
 #include "audio_data.h"
+#include "audio_stream_internal.h"
+#include "log_macros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+/* Host backend. Samples are delivered as int16_t straight away, so
+ * audio_preprocessing has nothing to do and the gain is always 1.
+ * Blocks are produced by the waiting caller rather than an interrupt,
+ * paced against the wall clock to mimic a live microphone. */
+
+static FILE *wav_file;
+static int wav_channels;
+static int wav_rate;
+static uint32_t wav_frames_left;
+static float replay_speed;
+
+static int audio_rate = 16000;
+static audio_callback_t user_audio_callback;
+static int audio_received;
+
+static struct timespec stream_start_time;
+static uint32_t stream_blocks_produced;
+static bool stream_running;
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint16_t read_le16(const uint8_t *p)
+{
+    return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+int audio_stubs_set_wav_source(const char *path, float speed)
+{
+    if (wav_file) {
+        fclose(wav_file);
+        wav_file = NULL;
+    }
+    replay_speed = speed > 0 ? speed : 0;
+    if (!path) {
+        return 0;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf_err("Cannot open %s\n", path);
+        return -1;
+    }
+
+    uint8_t hdr[12];
+    if (fread(hdr, 1, sizeof hdr, f) != sizeof hdr ||
+            memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "WAVE", 4) != 0) {
+        printf_err("%s is not a WAV file\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    bool have_fmt = false;
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof chunk, f) == sizeof chunk) {
+        uint32_t size = read_le32(chunk + 4);
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            uint8_t fmt[16];
+            if (fread(fmt, 1, sizeof fmt, f) != sizeof fmt) {
+                break;
+            }
+            uint16_t format = read_le16(fmt);
+            wav_channels = read_le16(fmt + 2);
+            wav_rate = (int) read_le32(fmt + 4);
+            uint16_t bits = read_le16(fmt + 14);
+            if ((format != 1 && format != 0xFFFE) || bits != 16 || wav_channels < 1) {
+                printf_err("%s: only 16-bit PCM is supported\n", path);
+                break;
+            }
+            have_fmt = true;
+            fseek(f, (long) (size - sizeof fmt + (size & 1)), SEEK_CUR);
+        } else if (memcmp(chunk, "data", 4) == 0 && have_fmt) {
+            wav_frames_left = size / (2 * (uint32_t) wav_channels);
+            wav_file = f;
+            if (wav_rate != audio_rate) {
+                warn("%s is sampled at %d Hz, expected %d Hz\n", path, wav_rate, audio_rate);
+            }
+            info("Replaying %s: %" PRIu32 " samples at %.1fx\n", path, wav_frames_left, replay_speed);
+            return 0;
+        } else {
+            fseek(f, (long) (size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+    printf_err("%s: no PCM data found\n", path);
+    fclose(f);
+    return -1;
+}
+
+/* Reads mono samples from the WAV, mixing channels, and pads with silence at the end. */
+static void read_samples(int16_t *out, int len)
+{
+    int i = 0;
+    while (wav_file && wav_frames_left > 0 && i < len) {
+        int16_t frame[8];
+        int channels = wav_channels < 8 ? wav_channels : 8;
+        if (fread(frame, sizeof frame[0], (size_t) channels, wav_file) != (size_t) channels) {
+            wav_frames_left = 0;
+            break;
+        }
+        if (wav_channels > channels) {
+            fseek(wav_file, (long) (2 * (wav_channels - channels)), SEEK_CUR);
+        }
+        int32_t sum = 0;
+        for (int c = 0; c < channels; ++c) {
+            sum += frame[c];
+        }
+        out[i++] = (int16_t) (sum / channels);
+        --wav_frames_left;
+    }
+    memset(out + i, 0, (size_t) (len - i) * sizeof *out);
+}
+
+/* Sleeps until `samples` samples after `start` would have been captured. */
+static void pace_until(const struct timespec *start, double samples)
+{
+    if (replay_speed <= 0) {
+        return;
+    }
+    double offset = samples / (audio_rate * replay_speed);
+    struct timespec due = *start;
+    due.tv_sec += (time_t) offset;
+    due.tv_nsec += (long) ((offset - (time_t) offset) * 1e9);
+    if (due.tv_nsec >= 1000000000L) {
+        due.tv_sec += 1;
+        due.tv_nsec -= 1000000000L;
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL) != 0) {}
+}
+
+static bool block_due(void)
+{
+    if (replay_speed <= 0) {
+        return false;
+    }
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double elapsed = (double) (now.tv_sec - stream_start_time.tv_sec) +
+                     (double) (now.tv_nsec - stream_start_time.tv_nsec) * 1e-9;
+    double captured = elapsed * audio_rate * replay_speed;
+    return captured >= (double) (stream_blocks_produced + 1) * audio_stream_block_len();
+}
+
+/* "Captures" one block, dropping it if no buffer is free as real hardware would. */
+static void produce_block(void)
+{
+    const int len = audio_stream_block_len();
+    int16_t *buf = audio_stream_begin_block();
+    if (buf) {
+        read_samples(buf, len);
+    } else {
+        int16_t scratch[256];
+        for (int done = 0; done < len; done += 256) {
+            read_samples(scratch, len - done < 256 ? len - done : 256);
+        }
+    }
+    ++stream_blocks_produced;
+    audio_stream_end_block(buf, 0);
+}
 
 int audio_init(int sampling_rate, int wlen)
 {
-    (void) sampling_rate;
     (void) wlen;
+    audio_rate = sampling_rate;
+    return 0;
+}
+
+void audio_set_callback(audio_callback_t cb)
+{
+    user_audio_callback = cb;
+}
+
+int get_audio_data(int16_t *data, int len)
+{
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    read_samples(data, len);
+    pace_until(&start, len);
+    audio_received = len;
+    if (user_audio_callback) {
+        user_audio_callback(0);
+    }
+    return 0;
+}
+
+int get_audio_samples_received(void)
+{
+    return audio_received;
+}
+
+int wait_for_audio(void)
+{
     return 0;
 }
 
-int get_audio_data(void *data, int len)
+void audio_preprocessing(int16_t *data, int len)
+{
+    (void) data;
+    (void) len;
+}
+
+float get_audio_gain(void)
+{
+    return 1.0f;
+}
+
+int audio_stream_start(int16_t *const *buffers, int num_buffers, int block_len,
+                       audio_block_callback_t cb, void *user)
 {
-    memset(data, 0, len);
+    if (stream_running) {
+        return -1;
+    }
+    int err = audio_stream_setup(buffers, num_buffers, block_len, cb, user);
+    if (err) {
+        return err;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stream_start_time);
+    stream_blocks_produced = 0;
+    stream_running = true;
     return 0;
 }
+
+void audio_stream_stop(void)
+{
+    audio_stream_set_inactive();
+    stream_running = false;
+}
+
+int audio_stream_wait_block(audio_block_t *block)
+{
+    /* Catch up on blocks that would have been captured meanwhile. */
+    while (stream_running && block_due()) {
+        produce_block();
+    }
+
+    while (!audio_stream_get_block(block)) {
+        if (!stream_running) {
+            return -1;
+        }
+        pace_until(&stream_start_time, (double) (stream_blocks_produced + 1) * audio_stream_block_len());
+        uint32_t overflows = audio_stream_get_overflows();
+        produce_block();
+        if (audio_stream_get_overflows() != overflows) {
+            /* Every buffer is held by the caller, nothing can arrive. */
+            return -1;
+        }
+    }
+    return block->error;
+}
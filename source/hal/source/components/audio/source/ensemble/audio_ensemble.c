@@ -19,6 +19,8 @@
 #include "arm_mve.h"
 
 #include "audio_data.h"
+#include "audio_stream_internal.h"
+#include "log_macros.h"
 #include "mic_listener.h"
 
 // At the time of writing, GCC produces incorrect assembly
@@ -66,6 +68,12 @@ static int user_length;
 static atomic_int audio_received;
 static atomic_int audio_async_error;
 
+// Streaming state, only touched by the record callback once started
+static atomic_bool stream_rx_running;
+static int16_t *stream_buf;
+static int stream_filled;
+static bool stream_block_open;
+
 
 static void audio_start_next_rx(int data_to_go)
 {
@@ -154,10 +162,48 @@ static void copy_audio_rec_to_in(float16_t * __RESTRICT in, const int32_t * __RE
     current_dc = (current_dc / 8) * 7 + mean / 8;
 }
 
+// Distribute one record buffer over the stream's blocks, which need not be
+// a multiple of the record size. Blocks without a free buffer are skipped.
+static void stream_rec_to_blocks(const int32_t *rec, int samples)
+{
+    const int block_len = audio_stream_block_len();
+    while (samples > 0) {
+        if (!stream_block_open) {
+            stream_buf = audio_stream_begin_block();
+            stream_filled = 0;
+            stream_block_open = true;
+        }
+        int n = block_len - stream_filled;
+        if (n > samples) {
+            n = samples;
+        }
+        if (stream_buf) {
+            copy_audio_rec_to_in((float16_t *) stream_buf + stream_filled, rec, n);
+        }
+        rec += 2 * n;
+        samples -= n;
+        stream_filled += n;
+        if (stream_filled == block_len) {
+            audio_stream_end_block(stream_buf, audio_async_error);
+            stream_block_open = false;
+        }
+    }
+}
+
 static void voice_data_cb(uint32_t event)
 {
     (void) event;
     audio_current_rec_buf = !audio_current_rec_buf;
+    if (stream_rx_running) {
+        // Keep the next record buffer going before handling this one
+        if (audio_stream_is_active()) {
+            audio_start_next_rx(AUDIO_REC_SAMPLES);
+        } else {
+            stream_rx_running = false;
+        }
+        stream_rec_to_blocks(audio_rec[!audio_current_rec_buf], AUDIO_REC_SAMPLES);
+        return;
+    }
     int samples = AUDIO_REC_SAMPLES;
     int new_total = audio_received + AUDIO_REC_SAMPLES;
     if (new_total < user_length) {
@@ -222,6 +268,46 @@ int wait_for_audio(void)
     return audio_async_error;
 }
 
+int audio_stream_start(int16_t *const *buffers, int num_buffers, int block_len,
+                       audio_block_callback_t cb, void *user)
+{
+    if (stream_rx_running) {
+        return -1;
+    }
+
+    int err = audio_stream_setup(buffers, num_buffers, block_len, cb, user);
+    if (err) {
+        return err;
+    }
+
+    stream_block_open = false;
+    audio_async_error = 0;
+    audio_current_rec_buf = 0;
+    stream_rx_running = true;
+    audio_start_next_rx(AUDIO_REC_SAMPLES);
+
+    return audio_async_error;
+}
+
+void audio_stream_stop(void)
+{
+    audio_stream_set_inactive();
+}
+
+int audio_stream_wait_block(audio_block_t *block)
+{
+    while (!audio_stream_get_block(block)) {
+        if (audio_async_error) {
+            return audio_async_error;
+        }
+        if (!stream_rx_running) {
+            return -1;
+        }
+        __WFE();
+    }
+    return block->error;
+}
+
 static void convert_to_s16_from_f16_with_gain(void *ptr, int length, float16_t gain)
 {
     while (length > 0) {
@@ -252,7 +338,7 @@ void audio_preprocessing(int16_t *audio, int samples)
     arm_mean_f16(audio_fp, samples, &audio_mean);
     arm_absmax_no_idx_f16(audio_fp, samples, &audio_absmax);
     //if (audio_absmax == INT16_MIN) audio_absmax = INT16_MAX; // CMSIS-DSP issue #66
-    printf("Original sample stats: absmax = %ld, mean = %ld\n", lround(32768*audio_absmax), lround(32768*audio_mean));
+    debug("Original sample stats: absmax = %ld, mean = %ld\n", lround(32768*audio_absmax), lround(32768*audio_mean));
 
     // Rescale to full range  while converting to integer
     float new_gain = fmin(1.0f / audio_absmax, MAX_GAIN);
@@ -265,5 +351,10 @@ void audio_preprocessing(int16_t *audio, int samples)
     arm_mean_q15(audio, samples, &audio_mean_q15);
     arm_absmax_no_idx_q15(audio, samples, &audio_absmax_q15);
     if (audio_absmax_q15 == INT16_MIN) audio_absmax_q15 = INT16_MAX; // CMSIS-DSP issue #66
-    printf("Normalized sample stats: absmax = %d, mean = %d (gain = %.0f dB)\n", audio_absmax_q15, audio_mean_q15, 20 * log10f(current_gain) );
+    debug("Normalized sample stats: absmax = %d, mean = %d (gain = %.0f dB)\n", audio_absmax_q15, audio_mean_q15, 20 * log10f(current_gain) );
+}
+
+float get_audio_gain(void)
+{
+    return current_gain;
 }
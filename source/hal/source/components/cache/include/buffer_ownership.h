@@ -0,0 +1,136 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#ifndef BUFFER_OWNERSHIP_H
+#define BUFFER_OWNERSHIP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Buffer ownership. Buffers shared between the CPU and bus masters (NPU
+ * tensor arena, camera frames) are registered once, then handed from one
+ * agent to the next with buffer_acquire. The layer remembers who has been
+ * writing each region and does only the data cache maintenance the
+ * handover needs:
+ *
+ *   device reads or writes after CPU writes    -> clean
+ *   device overwrites all of it                -> invalidate (line aligned regions)
+ *   CPU takes it back after a device wrote     -> invalidate
+ *
+ * Write-through regions never hold dirty lines, so they are never cleaned,
+ * and non-cacheable or read-only regions need no maintenance at all. Each
+ * operation is done by address or on the whole cache, whichever the cost
+ * model below says is cheaper. A global pure invalidate is never used, as
+ * it would throw away dirty lines of unrelated write-back memory.
+ */
+
+/* Maximum number of regions that can be registered */
+#define BUFFER_MAX_REGIONS 16
+
+/* Data cache line size in bytes */
+#ifndef BUFFER_CACHE_LINE
+#define BUFFER_CACHE_LINE 32
+#endif
+
+/* Cost model, in ns. Measured on the 941,920 byte camera frame: by address
+ * takes 0.5ms (17ns per line), while cleaning and/or invalidating the whole
+ * cache takes 0.023ms. A whole cache invalidate also throws away the
+ * working set of the CPU, which is estimated as twice the operation itself.
+ * That puts the breakeven at ~43KB for cleans and ~128KB for invalidates. */
+#ifndef BUFFER_CACHE_NS_PER_LINE
+#define BUFFER_CACHE_NS_PER_LINE 17
+#endif
+
+#ifndef BUFFER_CACHE_GLOBAL_NS
+#define BUFFER_CACHE_GLOBAL_NS 23000
+#endif
+
+#ifndef BUFFER_CACHE_REFILL_NS
+#define BUFFER_CACHE_REFILL_NS 46000
+#endif
+
+typedef enum {
+    BUFFER_AGENT_CPU,
+    BUFFER_AGENT_NPU,
+    BUFFER_AGENT_DMA
+} buffer_agent_t;
+
+typedef enum {
+    BUFFER_ACCESS_READ,         /* Agent only reads the region */
+    BUFFER_ACCESS_WRITE,        /* Agent may read and write the region */
+    BUFFER_ACCESS_OVERWRITE     /* Agent writes all of the region without reading it */
+} buffer_access_t;
+
+typedef enum {
+    BUFFER_ATTR_AUTO,           /* Ask the cache ops (the MPU on target) */
+    BUFFER_ATTR_NON_CACHEABLE,
+    BUFFER_ATTR_WRITE_THROUGH,
+    BUFFER_ATTR_WRITE_BACK,
+    BUFFER_ATTR_READ_ONLY       /* Contents already in memory and never written again (models) */
+} buffer_attr_t;
+
+/* Cache maintenance primitives. The defaults use the CMSIS SCB functions
+ * when the core has a data cache, and do nothing otherwise. */
+typedef struct {
+    bool (*enabled)(void);
+    buffer_attr_t (*attribute)(const void *addr, size_t size);
+    void (*clean_range)(void *addr, size_t size);
+    void (*invalidate_range)(void *addr, size_t size);
+    void (*clean_invalidate_range)(void *addr, size_t size);
+    void (*clean_all)(void);
+    void (*clean_invalidate_all)(void);
+} buffer_cache_ops_t;
+
+typedef struct {
+    uint32_t ranged_ops;    /* Maintenance operations done by address */
+    uint32_t global_ops;    /* Maintenance operations done on the whole cache */
+    uint32_t skipped;       /* Handovers needing no maintenance */
+    uint64_t cost_ns;       /* Estimated time spent, from the cost model */
+} buffer_cache_stats_t;
+
+/* Registers a region and returns its id, or -1 if the table is full.
+ * Registering the same region again returns the same id. The CPU is
+ * assumed to own the region and to have written it. */
+int buffer_register(const char *name, const void *base, size_t size, buffer_attr_t attr);
+
+/* Removes a region from the table */
+void buffer_unregister(int id);
+
+/* Returns the id of the region containing [p, p + bytes), or -1 */
+int buffer_find(const void *p, size_t bytes);
+
+/* Hands the region over to an agent, doing the cache maintenance required */
+void buffer_acquire(int id, buffer_agent_t agent, buffer_access_t access);
+
+/* Returns the agent currently owning the region */
+buffer_agent_t buffer_owner(int id);
+
+/* Returns the resolved memory attribute of the region */
+buffer_attr_t buffer_attribute(int id);
+
+/* Replaces the cache maintenance primitives; NULL restores the defaults */
+void buffer_set_cache_ops(const buffer_cache_ops_t *ops);
+
+/* Gets the maintenance counters since the last reset */
+void buffer_get_cache_stats(buffer_cache_stats_t *stats);
+
+void buffer_reset_cache_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BUFFER_OWNERSHIP_H
@@ -0,0 +1,313 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include "buffer_ownership.h"
+
+#include "log_macros.h"
+
+#if defined(BUFFER_OWNERSHIP_CMSIS)
+#include "RTE_Components.h"         /* For CPU related definitions */
+#endif
+
+typedef struct {
+    const char *name;
+    uintptr_t base;
+    size_t size;
+    buffer_attr_t attr;
+    buffer_agent_t owner;
+    bool in_use;
+    bool cpu_dirty;         /* The CPU may hold dirty lines of the region */
+    bool device_wrote;      /* Memory changed behind the cache since the CPU last owned it */
+} buffer_region;
+
+typedef enum {
+    OP_CLEAN,
+    OP_INVALIDATE
+} cache_op;
+
+static buffer_region regions[BUFFER_MAX_REGIONS];
+static buffer_cache_stats_t stats;
+
+#if defined(BUFFER_OWNERSHIP_CMSIS) && defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+
+static bool cmsis_enabled(void)
+{
+    return SCB->CCR & SCB_CCR_DC_Msk;
+}
+
+static buffer_attr_t cmsis_attribute(const void *addr, size_t size)
+{
+#if defined(__MPU_PRESENT) && (__MPU_PRESENT == 1U) && defined(MPU_RLAR_AttrIndx_Msk)
+    if (!(MPU->CTRL & MPU_CTRL_ENABLE_Msk)) {
+        return BUFFER_ATTR_WRITE_BACK;
+    }
+
+    const uint32_t start = (uint32_t) (uintptr_t) addr;
+    const uint32_t end = start + size - 1;
+    const uint32_t num_regions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    for (uint32_t r = 0; r < num_regions; ++r) {
+        MPU->RNR = r;
+        const uint32_t rlar = MPU->RLAR;
+        const uint32_t rbase = MPU->RBAR & MPU_RBAR_BASE_Msk;
+        const uint32_t rlimit = (rlar & MPU_RLAR_LIMIT_Msk) | 0x1F;
+        if (!(rlar & MPU_RLAR_EN_Msk) || start < rbase || end > rlimit) {
+            continue;
+        }
+
+        if ((MPU->RBAR & MPU_RBAR_AP_Msk) & (2U << MPU_RBAR_AP_Pos)) {
+            return BUFFER_ATTR_READ_ONLY;
+        }
+
+        const uint32_t index = (rlar & MPU_RLAR_AttrIndx_Msk) >> MPU_RLAR_AttrIndx_Pos;
+        const uint32_t mair = index < 4 ? MPU->MAIR0 : MPU->MAIR1;
+        const uint32_t attr = (mair >> (8 * (index % 4))) & 0xFF;
+        const uint32_t inner = attr & 0xF;
+        if ((attr & 0xF0) == 0 || inner == 0x4) {
+            /* Device memory, or Normal Non-cacheable */
+            return BUFFER_ATTR_NON_CACHEABLE;
+        }
+        return (inner & 0x4) ? BUFFER_ATTR_WRITE_BACK : BUFFER_ATTR_WRITE_THROUGH;
+    }
+#else
+    (void) addr;
+    (void) size;
+#endif
+    return BUFFER_ATTR_WRITE_BACK;
+}
+
+static void cmsis_clean_range(void *addr, size_t size)
+{
+    SCB_CleanDCache_by_Addr(addr, (int32_t) size);
+}
+
+static void cmsis_invalidate_range(void *addr, size_t size)
+{
+    SCB_InvalidateDCache_by_Addr(addr, (int32_t) size);
+}
+
+static void cmsis_clean_invalidate_range(void *addr, size_t size)
+{
+    SCB_CleanInvalidateDCache_by_Addr(addr, (int32_t) size);
+}
+
+static void cmsis_clean_all(void)
+{
+    SCB_CleanDCache();
+}
+
+static void cmsis_clean_invalidate_all(void)
+{
+    SCB_CleanInvalidateDCache();
+}
+
+static const buffer_cache_ops_t default_ops = {
+    .enabled = cmsis_enabled,
+    .attribute = cmsis_attribute,
+    .clean_range = cmsis_clean_range,
+    .invalidate_range = cmsis_invalidate_range,
+    .clean_invalidate_range = cmsis_clean_invalidate_range,
+    .clean_all = cmsis_clean_all,
+    .clean_invalidate_all = cmsis_clean_invalidate_all
+};
+
+#else /* No data cache */
+
+static bool no_cache_enabled(void)
+{
+    return false;
+}
+
+static buffer_attr_t no_cache_attribute(const void *addr, size_t size)
+{
+    (void) addr;
+    (void) size;
+    return BUFFER_ATTR_NON_CACHEABLE;
+}
+
+static const buffer_cache_ops_t default_ops = {
+    .enabled = no_cache_enabled,
+    .attribute = no_cache_attribute
+};
+
+#endif
+
+static const buffer_cache_ops_t *cache_ops = &default_ops;
+
+static buffer_region *get_region(int id)
+{
+    if (id < 0 || id >= BUFFER_MAX_REGIONS || !regions[id].in_use) {
+        return NULL;
+    }
+    return &regions[id];
+}
+
+static bool line_aligned(const buffer_region *r)
+{
+    return (r->base % BUFFER_CACHE_LINE) == 0 && (r->size % BUFFER_CACHE_LINE) == 0;
+}
+
+static void maintain(buffer_region *r, cache_op op)
+{
+    const uint64_t lines = (r->size + (r->base % BUFFER_CACHE_LINE) + BUFFER_CACHE_LINE - 1) / BUFFER_CACHE_LINE;
+    const uint64_t ranged_ns = lines * BUFFER_CACHE_NS_PER_LINE;
+    const uint64_t global_ns = BUFFER_CACHE_GLOBAL_NS + (op == OP_INVALIDATE ? BUFFER_CACHE_REFILL_NS : 0);
+
+    if (ranged_ns <= global_ns) {
+        void *addr = (void *) r->base;
+        if (op == OP_CLEAN) {
+            cache_ops->clean_range(addr, r->size);
+        } else if (r->attr == BUFFER_ATTR_WRITE_THROUGH || line_aligned(r)) {
+            cache_ops->invalidate_range(addr, r->size);
+        } else {
+            /* Partial lines at the ends may hold dirty data of neighbours */
+            cache_ops->clean_invalidate_range(addr, r->size);
+        }
+        ++stats.ranged_ops;
+        stats.cost_ns += ranged_ns;
+        trace("Cache %s of %s by address\n", op == OP_CLEAN ? "clean" : "invalidate", r->name);
+        return;
+    }
+
+    if (op == OP_CLEAN) {
+        cache_ops->clean_all();
+    } else {
+        cache_ops->clean_invalidate_all();
+    }
+    ++stats.global_ops;
+    stats.cost_ns += global_ns;
+    trace("Cache %s for %s\n", op == OP_CLEAN ? "clean" : "clean+invalidate", r->name);
+
+    /* Nothing is dirty any more, which saves later handovers a clean */
+    for (int i = 0; i < BUFFER_MAX_REGIONS; ++i) {
+        regions[i].cpu_dirty = false;
+    }
+}
+
+int buffer_register(const char *name, const void *base, size_t size, buffer_attr_t attr)
+{
+    const uintptr_t start = (uintptr_t) base;
+    int free_id = -1;
+    for (int i = 0; i < BUFFER_MAX_REGIONS; ++i) {
+        if (!regions[i].in_use) {
+            if (free_id < 0) {
+                free_id = i;
+            }
+        } else if (regions[i].base == start && regions[i].size == size) {
+            return i;
+        }
+    }
+
+    if (free_id < 0 || !base || size == 0) {
+        printf_err("Cannot register buffer %s\n", name);
+        return -1;
+    }
+
+    if (attr == BUFFER_ATTR_AUTO) {
+        attr = cache_ops->attribute(base, size);
+    }
+
+    buffer_region *r = &regions[free_id];
+    r->name = name;
+    r->base = start;
+    r->size = size;
+    r->attr = attr;
+    r->owner = BUFFER_AGENT_CPU;
+    r->in_use = true;
+    r->cpu_dirty = attr == BUFFER_ATTR_WRITE_BACK;
+    r->device_wrote = false;
+
+    if ((attr == BUFFER_ATTR_WRITE_BACK || attr == BUFFER_ATTR_WRITE_THROUGH) && !line_aligned(r)) {
+        warn("Buffer %s is not cache line aligned\n", name);
+    }
+    debug("Registered buffer %s: %p, %zu bytes, attribute %d\n", name, base, size, (int) attr);
+    return free_id;
+}
+
+void buffer_unregister(int id)
+{
+    buffer_region *r = get_region(id);
+    if (r) {
+        r->in_use = false;
+    }
+}
+
+int buffer_find(const void *p, size_t bytes)
+{
+    const uintptr_t start = (uintptr_t) p;
+    for (int i = 0; i < BUFFER_MAX_REGIONS; ++i) {
+        const buffer_region *r = &regions[i];
+        if (r->in_use && start >= r->base && start - r->base + bytes <= r->size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void buffer_acquire(int id, buffer_agent_t agent, buffer_access_t access)
+{
+    buffer_region *r = get_region(id);
+    if (!r) {
+        return;
+    }
+
+    const bool writes = access != BUFFER_ACCESS_READ;
+    const bool cached = r->attr != BUFFER_ATTR_NON_CACHEABLE && r->attr != BUFFER_ATTR_READ_ONLY &&
+                        cache_ops->enabled();
+    bool maintained = false;
+
+    if (agent == BUFFER_AGENT_CPU) {
+        if (cached && r->device_wrote) {
+            maintain(r, OP_INVALIDATE);
+            maintained = true;
+        }
+        r->device_wrote = false;
+        r->cpu_dirty = writes && r->attr == BUFFER_ATTR_WRITE_BACK;
+    } else {
+        if (cached && r->cpu_dirty) {
+            /* A device overwriting the whole region lets us drop the CPU's data */
+            maintain(r, access == BUFFER_ACCESS_OVERWRITE && line_aligned(r) ? OP_INVALIDATE : OP_CLEAN);
+            maintained = true;
+        }
+        r->cpu_dirty = false;
+        r->device_wrote = r->device_wrote || writes;
+    }
+
+    if (!maintained) {
+        ++stats.skipped;
+    }
+    r->owner = agent;
+}
+
+buffer_agent_t buffer_owner(int id)
+{
+    const buffer_region *r = get_region(id);
+    return r ? r->owner : BUFFER_AGENT_CPU;
+}
+
+buffer_attr_t buffer_attribute(int id)
+{
+    const buffer_region *r = get_region(id);
+    return r ? r->attr : BUFFER_ATTR_AUTO;
+}
+
+void buffer_set_cache_ops(const buffer_cache_ops_t *ops)
+{
+    cache_ops = ops ? ops : &default_ops;
+}
+
+void buffer_get_cache_stats(buffer_cache_stats_t *out)
+{
+    *out = stats;
+}
+
+void buffer_reset_cache_stats(void)
+{
+    stats = (buffer_cache_stats_t) {0};
+}
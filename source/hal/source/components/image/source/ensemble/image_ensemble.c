@@ -17,16 +17,20 @@
 #include "Driver_GPIO.h"
 #include "base_def.h"
 #include "delay.h"
+#include "buffer_ownership.h"
 
 static uint8_t rgb_image[CIMAGE_X*CIMAGE_Y*RGB_BYTES] __attribute__((section(".bss.camera_frame_bayer_to_rgb_buf")));      // 560x560x3 = 940,800
 static uint8_t raw_image[CIMAGE_X*CIMAGE_Y*RGB_BYTES + 0x460] __attribute__((aligned(32),section(".bss.camera_frame_buf")));   // 560x560x3 = 940,800
 
+static int raw_image_id = -1;
+
 extern ARM_DRIVER_GPIO Driver_GPIO1;
 
 int image_init()
 {
     DEBUG_PRINTF("image_init(IN)\n");
     int err = camera_init(raw_image);
+    raw_image_id = buffer_register("camera_frame", raw_image, sizeof raw_image, BUFFER_ATTR_AUTO);
     DEBUG_PRINTF("image_init(), camera_init: %d\n", err);
 	if (err != 0) {
 		while(1) {
@@ -49,17 +53,16 @@ const uint8_t *get_image_data(int ml_width, int ml_height)
     extern uint32_t tprof1, tprof2, tprof3, tprof4, tprof5;
 
 #if !FAKE_CAMERA
+    // The frame is handed to the camera DMA and back, and buffer_ownership picks the
+    // maintenance: none before the capture if the CPU can't have dirty lines of it
+    // (write-through SRAM), and for the invalidate after, global rather than by address
+    // as it's a huge buffer (941920 bytes) - by address can take 0.5ms, while a global
+    // clean+invalidate is 0.023ms plus the reload cost on stuff we lost.
+    buffer_acquire(raw_image_id, BUFFER_AGENT_DMA, BUFFER_ACCESS_OVERWRITE);
     camera_start(CAMERA_MODE_SNAPSHOT);
-    // It's a huge buffer (941920 bytes) - actually doing it by address can take 0.5ms, while
-    // a global clean+invalidate is 0.023ms. (Although there will be a reload cost
-    // on stuff we lost).
-    // Notably, just invalidate is faster at 0.015ms, but we'd have to be sure
-    // there were no writeback cacheable areas.
-    // From that Breakeven point for ranged invalidate time = global clean+invalidate would be 43Kbyte.
-    // So maybe go to global if >128K, considering cost of refills?
-    //SCB_InvalidateDCache_by_Addr(raw_image, sizeof raw_image);
-    SCB_CleanInvalidateDCache();
     camera_wait(100);
+    // Bayer conversion and cropping write the frame buffer as scratch
+    buffer_acquire(raw_image_id, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
 #else
     static int roll = 0;
     for (int y = 0; y < CIMAGE_Y; y+=2) {
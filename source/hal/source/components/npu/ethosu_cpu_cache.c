@@ -33,6 +33,10 @@
 #include "ethosu_driver.h"          /* Arm Ethos-U driver header */
 #include "log_macros.h"             /* Logging macros */
 
+#if defined(BUFFER_OWNERSHIP_ENABLED)
+#include "buffer_ownership.h"       /* Registered shared buffers */
+#endif
+
 /** Structure to maintain data cache states. */
 typedef struct _cpu_cache_state {
     uint32_t dcache_invalidated : 1;
@@ -98,6 +102,17 @@ void ethosu_clear_cache_states(void)
 void ethosu_flush_dcache(uint32_t *p, size_t bytes)
 {
     cpu_cache_state* const state = ethosu_get_cpu_cache_state();
+#if defined(BUFFER_OWNERSHIP_ENABLED)
+    /* Registered buffers (tensor arena, model) only get the maintenance
+     * their last writer makes necessary - none if they are write-through
+     * or non-cacheable. The NPU may write anything in the arena. */
+    const int id = p ? buffer_find(p, bytes) : -1;
+    if (id >= 0) {
+        buffer_acquire(id, BUFFER_AGENT_NPU, BUFFER_ACCESS_WRITE);
+        __DSB();
+        return;
+    }
+#endif
     if (ethosu_area_needs_flush_dcache(p, bytes)) {
 
         /**
@@ -135,6 +150,15 @@ void ethosu_flush_dcache(uint32_t *p, size_t bytes)
 void ethosu_invalidate_dcache(uint32_t *p, size_t bytes)
 {
     cpu_cache_state* const state = ethosu_get_cpu_cache_state();
+#if defined(BUFFER_OWNERSHIP_ENABLED)
+    /* Back to the CPU, which will write the next inputs into the arena */
+    const int id = p ? buffer_find(p, bytes) : -1;
+    if (id >= 0) {
+        buffer_acquire(id, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
+        __DSB();
+        return;
+    }
+#endif
     if (ethosu_area_needs_invalidate_dcache(p, bytes)) {
         /**
          * See note in ethosu_flush_dcache function for why we clean the whole
@@ -37,6 +37,8 @@
 #include "timer_ensemble.h"     /* Timer functions. */
 #include "uart_tracelib.h"
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -62,6 +64,32 @@ extern bool run_requested(void);
 extern void init_trigger_rx(void);
 extern void init_trigger_tx(void);
 
+/** MHU message id used for ring doorbells between the M55 cores. */
+#define IPC_DOORBELL_MSG_ID     4
+
+/** Number of doorbell channels, one per shared ring. */
+#define IPC_DOORBELL_CHANNELS   8
+
+/**
+ * @brief   Called from the MHU interrupt when the other core rings a doorbell.
+ * @param[in]   channel     Doorbell channel that was rung.
+ */
+typedef void (*ipc_doorbell_callback_t)(uint8_t channel);
+
+/**
+ * @brief   Sets the function called when the other core rings a doorbell.
+ *          Requires init_trigger_rx or init_trigger_tx to have been called.
+ * @param[in]   cb  Callback, or NULL to ignore doorbells.
+ */
+void ipc_set_doorbell_callback(ipc_doorbell_callback_t cb);
+
+/**
+ * @brief   Notifies the other core that data is waiting on a shared ring.
+ * @param[in]   channel     Doorbell channel, less than IPC_DOORBELL_CHANNELS.
+ * @return  0 if the message was sent, error code otherwise.
+ */
+int ipc_ring_doorbell(uint8_t channel);
+
 #ifdef __cplusplus
 }
 #endif
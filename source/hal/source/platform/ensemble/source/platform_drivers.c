@@ -64,7 +64,10 @@ uint32_t tprof1, tprof2, tprof3, tprof4, tprof5;
 /** Platform name */
 static const char* s_platform_name = DESIGN_NAME;
 
+extern uint32_t m55_comms_handle;
+
 static void MHU_msg_received(void* data);
+static bool ipc_handle_doorbell(const m55_data_payload_t* payload);
 extern ARM_DRIVER_GPIO Driver_GPIO1;
 extern ARM_DRIVER_GPIO Driver_GPIO2;
 extern ARM_DRIVER_GPIO Driver_GPIO3;
@@ -73,6 +76,9 @@ extern ARM_DRIVER_GPIO Driver_GPIO3;
 static void ipc_rx_callback(void *data)
 {
     m55_data_payload_t* payload = (m55_data_payload_t*)data;
+    if (ipc_handle_doorbell(payload)) {
+        return;
+    }
     char *st = (char*)payload->msg;
     uint16_t id = payload->id;
     printf("****** Got message from other CPU: %s, id: %d\n", st, id);
@@ -215,6 +221,10 @@ static void MHU_msg_received(void* data)
 
     __DMB();
 
+    if (ipc_handle_doorbell(payload)) {
+        return;
+    }
+
     switch(payload->id)
     {
         case 2:
@@ -234,6 +244,45 @@ static void MHU_msg_received(void* data)
     }
 }
 
+static ipc_doorbell_callback_t s_doorbell_callback = NULL;
+
+/* The receiver reads the payload after the MHU interrupt, so each channel has its own. */
+static m55_data_payload_t s_doorbell_payloads[IPC_DOORBELL_CHANNELS];
+
+static bool ipc_handle_doorbell(const m55_data_payload_t* payload)
+{
+    if (payload->id != IPC_DOORBELL_MSG_ID) {
+        return false;
+    }
+
+    const uint8_t channel = (uint8_t)payload->msg[0];
+    if (s_doorbell_callback && channel < IPC_DOORBELL_CHANNELS) {
+        s_doorbell_callback(channel);
+    }
+    return true;
+}
+
+void ipc_set_doorbell_callback(ipc_doorbell_callback_t cb)
+{
+    s_doorbell_callback = cb;
+}
+
+int ipc_ring_doorbell(uint8_t channel)
+{
+    if (channel >= IPC_DOORBELL_CHANNELS) {
+        printf_err("Invalid doorbell channel %u\n", channel);
+        return -1;
+    }
+
+    m55_data_payload_t* payload = &s_doorbell_payloads[channel];
+    payload->id = IPC_DOORBELL_MSG_ID;
+    payload->msg[0] = (char)channel;
+
+    /* Ring contents and payload must be visible before the interrupt fires. */
+    __DMB();
+    return (int)SERVICES_send_msg(m55_comms_handle, payload);
+}
+
 bool run_requested(void)
 {
 #if TARGET_BOARD >= BOARD_AppKit_Alpha1
@@ -336,6 +385,10 @@ bool ethosu_area_needs_flush_dcache(const void *p, size_t bytes)
     return false;
 }
 
+#if !defined(IPC_SHARED_BASE) || !defined(IPC_SHARED_SIZE)
+  #error IPC_SHARED_BASE and IPC_SHARED_SIZE must be defined
+#endif
+
 void MPU_Load_Regions(void)
 {
     static const ARM_MPU_Region_t mpu_table[] __STARTUP_RO_DATA_ATTRIBUTE = {
@@ -344,7 +397,12 @@ void MPU_Load_Regions(void)
     .RLAR = ARM_MPU_RLAR(MRAM_BASE + MRAM_SIZE - 1, 1UL)
     },
     {
-    .RBAR = ARM_MPU_RBAR(SRAM0_BASE, ARM_MPU_SH_NON, 0UL, 1UL, 0UL),  // RW, NP, XA
+    /* Start of SRAM0 is shared by both cores for IPC; keep it out of their caches */
+    .RBAR = ARM_MPU_RBAR(IPC_SHARED_BASE, ARM_MPU_SH_OUTER, 0UL, 1UL, 1UL),  // RW, NP, XN
+    .RLAR = ARM_MPU_RLAR(IPC_SHARED_BASE + IPC_SHARED_SIZE - 1, 3UL)  // SRAM0 IPC block
+    },
+    {
+    .RBAR = ARM_MPU_RBAR(IPC_SHARED_BASE + IPC_SHARED_SIZE, ARM_MPU_SH_NON, 0UL, 1UL, 0UL),  // RW, NP, XA
     .RLAR = ARM_MPU_RLAR(SRAM0_BASE + SRAM0_SIZE - 1, 2UL)  // SRAM0
     },
     {
@@ -386,6 +444,9 @@ void MPU_Load_Regions(void)
     ARM_MPU_SetMemAttr(2UL, ARM_MPU_ATTR(   /* Attr2, Normal Memory, Transient, Write Through, Read Allocate */
                             ARM_MPU_ATTR_MEMORY_(0,0,1,0),
                             ARM_MPU_ATTR_MEMORY_(0,0,1,0)));
+    ARM_MPU_SetMemAttr(3UL, ARM_MPU_ATTR(   /* Attr3, Normal Memory, Non-cacheable */
+                            ARM_MPU_ATTR_NON_CACHEABLE,
+                            ARM_MPU_ATTR_NON_CACHEABLE));
 
     /* Load the regions from the table */
     ARM_MPU_Load(0U, &mpu_table[0], sizeof(mpu_table)/sizeof(ARM_MPU_Region_t));
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ML_EMBEDDED_CORE_LOG_DEFERRED_H
+#define ML_EMBEDDED_CORE_LOG_DEFERRED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of records the ring holds; must be a power of two. */
+#ifndef LOG_DEFERRED_RECORDS
+#define LOG_DEFERRED_RECORDS 64
+#endif /* LOG_DEFERRED_RECORDS */
+
+/* Arguments kept per record, including '*' widths and precisions. */
+#ifndef LOG_DEFERRED_MAX_ARGS
+#define LOG_DEFERRED_MAX_ARGS 8
+#endif /* LOG_DEFERRED_MAX_ARGS */
+
+/* Bytes per record for copies of %s arguments, which may not outlive the call. */
+#ifndef LOG_DEFERRED_STR_BYTES
+#define LOG_DEFERRED_STR_BYTES 48
+#endif /* LOG_DEFERRED_STR_BYTES */
+
+/**
+ * @brief       Records a log message without formatting it. Only the format
+ *              string pointer and the raw arguments are stored, in a lock-free
+ *              ring that interrupt handlers may also record into; the text is
+ *              produced later by log_deferred_flush. If the ring is full the
+ *              message is dropped and counted.
+ * @param[in]   level   Log level, one of the LOG_LEVEL_* values.
+ * @param[in]   fmt     printf format string. Must stay valid until flushed,
+ *                      which string literals do.
+ **/
+void log_deferred_record(int level, const char* fmt, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif /* defined(__GNUC__) */
+    ;
+
+/**
+ * @brief   Formats and prints all recorded messages, oldest first. Meant to be
+ *          called where the application has time to spare, such as while
+ *          waiting for input or for the next block of data. Must only be
+ *          called from one context.
+ * @return  Number of messages printed.
+ **/
+size_t log_deferred_flush(void);
+
+/** @brief  Gets the number of messages dropped because the ring was full. */
+uint32_t log_deferred_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ML_EMBEDDED_CORE_LOG_DEFERRED_H */
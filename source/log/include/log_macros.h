@@ -38,42 +38,66 @@ extern "C" {
 #define UNUSED(x) ((void)(x))
 #endif /* #if !defined(UNUSED) */
 
+/* With LOG_DEFERRED, messages below error level are recorded unformatted
+ * and only printed by log_flush(); errors flush and print straight away. */
+#if defined(LOG_DEFERRED)
+#include "log_deferred.h"
+
+#define log_flush() log_deferred_flush()
+
+#define LOG_PRINT(level, prefix, ...)               \
+    do {                                            \
+        log_deferred_record(level, __VA_ARGS__);    \
+    } while (0)
+
+#define LOG_PRINT_ERR(...)      \
+    do {                        \
+        log_deferred_flush();   \
+        printf("ERROR - ");     \
+        printf(__VA_ARGS__);    \
+    } while (0)
+#else
+#define log_flush() ((void)0)
+
+#define LOG_PRINT(level, prefix, ...)   \
+    do {                                \
+        printf(prefix);                 \
+        printf(__VA_ARGS__);            \
+    } while (0)
+
+#define LOG_PRINT_ERR(...)      \
+    do {                        \
+        printf("ERROR - ");     \
+        printf(__VA_ARGS__);    \
+    } while (0)
+#endif /* defined(LOG_DEFERRED) */
+
 #if (LOG_LEVEL == LOG_LEVEL_TRACE)
-#define trace(...)      \
-    printf("TRACE - "); \
-    printf(__VA_ARGS__)
+#define trace(...) LOG_PRINT(LOG_LEVEL_TRACE, "TRACE - ", __VA_ARGS__)
 #else
 #define trace(...)
 #endif /* LOG_LEVEL == LOG_LEVEL_TRACE */
 
 #if (LOG_LEVEL <= LOG_LEVEL_DEBUG)
-#define debug(...)      \
-    printf("DEBUG - "); \
-    printf(__VA_ARGS__)
+#define debug(...) LOG_PRINT(LOG_LEVEL_DEBUG, "DEBUG - ", __VA_ARGS__)
 #else
 #define debug(...)
 #endif /* LOG_LEVEL > LOG_LEVEL_TRACE */
 
 #if (LOG_LEVEL <= LOG_LEVEL_INFO)
-#define info(...)      \
-    printf("INFO - "); \
-    printf(__VA_ARGS__)
+#define info(...) LOG_PRINT(LOG_LEVEL_INFO, "INFO - ", __VA_ARGS__)
 #else
 #define info(...)
 #endif /* LOG_LEVEL > LOG_LEVEL_DEBUG */
 
 #if (LOG_LEVEL <= LOG_LEVEL_WARN)
-#define warn(...)      \
-    printf("WARN - "); \
-    printf(__VA_ARGS__)
+#define warn(...) LOG_PRINT(LOG_LEVEL_WARN, "WARN - ", __VA_ARGS__)
 #else
 #define warn(...)
 #endif /* LOG_LEVEL > LOG_LEVEL_INFO */
 
 #if (LOG_LEVEL <= LOG_LEVEL_ERROR)
-#define printf_err(...) \
-    printf("ERROR - "); \
-    printf(__VA_ARGS__)
+#define printf_err(...) LOG_PRINT_ERR(__VA_ARGS__)
 #else
 #define printf_err(...)
 #endif /* LOG_LEVEL > LOG_LEVEL_INFO */
@@ -0,0 +1,425 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "log_deferred.h"
+#include "log_macros.h"
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (LOG_DEFERRED_RECORDS & (LOG_DEFERRED_RECORDS - 1)) != 0
+#error "LOG_DEFERRED_RECORDS must be a power of two"
+#endif
+
+/* How an argument is stored and printed. */
+typedef enum {
+    ARG_NONE,       /* %% and unknown conversions, no argument taken. */
+    ARG_INT,
+    ARG_UINT,
+    ARG_DOUBLE,
+    ARG_CHAR,
+    ARG_PTR,        /* %p, and %n whose pointer is taken but never written. */
+    ARG_STR
+} arg_class_t;
+
+/* A conversion specification of a format string. */
+typedef struct {
+    const char* flags;      /* First character after the '%'. */
+    size_t      flags_len;
+    int         star_width; /* Width given as an argument. */
+    const char* width;
+    size_t      width_len;
+    int         has_prec;
+    int         star_prec;  /* Precision given as an argument. */
+    const char* prec;
+    size_t      prec_len;
+    char        length[3];  /* Length modifier, "" if none. */
+    char        conv;
+    arg_class_t cls;
+} log_spec_t;
+
+typedef union {
+    long long           i;
+    unsigned long long  u;
+    double              d;
+    const void*         p;
+    size_t              str;    /* Offset of the copy in the record's strings. */
+} log_arg_t;
+
+typedef struct {
+    atomic_uint seq;            /* Ring position + 1 once the record is complete. */
+    const char* fmt;
+    uint8_t     level;
+    uint8_t     num_args;
+    log_arg_t   args[LOG_DEFERRED_MAX_ARGS];
+    char        strs[LOG_DEFERRED_STR_BYTES];
+} log_record_t;
+
+static log_record_t s_records[LOG_DEFERRED_RECORDS];
+static atomic_uint s_head;      /* Next position to reserve, shared by the producers. */
+static atomic_uint s_tail;      /* Next position to print, consumer owned. */
+static atomic_uint s_dropped;
+
+/**
+ * @brief       Parses one conversion specification.
+ * @param[in]   p      Character after the '%'.
+ * @param[out]  spec   Parsed specification.
+ * @return      Pointer to the character after the conversion.
+ **/
+static const char* parse_spec(const char* p, log_spec_t* spec)
+{
+    memset(spec, 0, sizeof(*spec));
+
+    spec->flags = p;
+    while (*p && strchr("-+ #0'", *p)) {
+        ++p;
+    }
+    spec->flags_len = (size_t)(p - spec->flags);
+
+    spec->width = p;
+    if (*p == '*') {
+        spec->star_width = 1;
+        ++p;
+    } else {
+        while (*p >= '0' && *p <= '9') {
+            ++p;
+        }
+    }
+    spec->width_len = (size_t)(p - spec->width);
+
+    if (*p == '.') {
+        spec->has_prec = 1;
+        spec->prec = ++p;
+        if (*p == '*') {
+            spec->star_prec = 1;
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                ++p;
+            }
+        }
+        spec->prec_len = (size_t)(p - spec->prec);
+    }
+
+    size_t n = 0;
+    while (*p && strchr("hlLzjtq", *p) && n < 2) {
+        spec->length[n++] = *p++;
+    }
+
+    spec->conv = *p;
+    switch (*p) {
+        case 'd': case 'i':
+            spec->cls = ARG_INT;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            spec->cls = ARG_UINT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec->cls = ARG_DOUBLE;
+            break;
+        case 'c':
+            spec->cls = ARG_CHAR;
+            break;
+        case 'p': case 'n':
+            spec->cls = ARG_PTR;
+            break;
+        case 's':
+            spec->cls = ARG_STR;
+            break;
+        default:
+            spec->cls = ARG_NONE;
+            break;
+    }
+    return *p ? p + 1 : p;
+}
+
+static int has_length(const log_spec_t* spec, const char* length)
+{
+    return strcmp(spec->length, length) == 0;
+}
+
+static long long take_int(const log_spec_t* spec, va_list* ap)
+{
+    if (has_length(spec, "hh")) {
+        return (signed char)va_arg(*ap, int);
+    } else if (has_length(spec, "h")) {
+        return (short)va_arg(*ap, int);
+    } else if (has_length(spec, "l")) {
+        return va_arg(*ap, long);
+    } else if (has_length(spec, "ll") || has_length(spec, "q")) {
+        return va_arg(*ap, long long);
+    } else if (has_length(spec, "z") || has_length(spec, "t")) {
+        return va_arg(*ap, ptrdiff_t);
+    } else if (has_length(spec, "j")) {
+        return va_arg(*ap, intmax_t);
+    }
+    return va_arg(*ap, int);
+}
+
+static unsigned long long take_uint(const log_spec_t* spec, va_list* ap)
+{
+    if (has_length(spec, "hh")) {
+        return (unsigned char)va_arg(*ap, unsigned int);
+    } else if (has_length(spec, "h")) {
+        return (unsigned short)va_arg(*ap, unsigned int);
+    } else if (has_length(spec, "l")) {
+        return va_arg(*ap, unsigned long);
+    } else if (has_length(spec, "ll") || has_length(spec, "q")) {
+        return va_arg(*ap, unsigned long long);
+    } else if (has_length(spec, "z")) {
+        return va_arg(*ap, size_t);
+    } else if (has_length(spec, "t")) {
+        return (unsigned long long)va_arg(*ap, ptrdiff_t);
+    } else if (has_length(spec, "j")) {
+        return va_arg(*ap, uintmax_t);
+    }
+    return va_arg(*ap, unsigned int);
+}
+
+void log_deferred_record(int level, const char* fmt, ...)
+{
+    /* Reserve a position, unless the consumer is a whole ring behind. */
+    unsigned int head = atomic_load_explicit(&s_head, memory_order_relaxed);
+    do {
+        const unsigned int tail = atomic_load_explicit(&s_tail, memory_order_acquire);
+        if (head - tail >= LOG_DEFERRED_RECORDS) {
+            atomic_fetch_add_explicit(&s_dropped, 1, memory_order_relaxed);
+            return;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&s_head, &head, head + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+
+    log_record_t* record = &s_records[head & (LOG_DEFERRED_RECORDS - 1)];
+    record->fmt = fmt;
+    record->level = (uint8_t)level;
+
+    size_t num_args = 0;
+    size_t str_used = 0;
+    va_list ap;
+    va_start(ap, fmt);
+    for (const char* p = fmt; *p && num_args < LOG_DEFERRED_MAX_ARGS; ) {
+        if (*p++ != '%') {
+            continue;
+        }
+
+        log_spec_t spec;
+        p = parse_spec(p, &spec);
+        if (spec.star_width && num_args < LOG_DEFERRED_MAX_ARGS) {
+            record->args[num_args++].i = va_arg(ap, int);
+        }
+        if (spec.star_prec && num_args < LOG_DEFERRED_MAX_ARGS) {
+            record->args[num_args++].i = va_arg(ap, int);
+        }
+        if (num_args == LOG_DEFERRED_MAX_ARGS) {
+            break;
+        }
+
+        log_arg_t* arg = &record->args[num_args];
+        switch (spec.cls) {
+            case ARG_INT:
+                arg->i = take_int(&spec, &ap);
+                break;
+            case ARG_UINT:
+                arg->u = take_uint(&spec, &ap);
+                break;
+            case ARG_DOUBLE:
+                arg->d = has_length(&spec, "L") ? (double)va_arg(ap, long double) : va_arg(ap, double);
+                break;
+            case ARG_CHAR:
+                arg->i = va_arg(ap, int);
+                break;
+            case ARG_PTR:
+                arg->p = va_arg(ap, void*);
+                break;
+            case ARG_STR: {
+                /* Copied, truncated if need be, as the string may not outlive the call. */
+                const char* str = va_arg(ap, const char*);
+                if (!str) {
+                    str = "(null)";
+                }
+                size_t len = strlen(str);
+                const size_t space = LOG_DEFERRED_STR_BYTES - 1 - str_used;
+                len = len < space ? len : space;
+                memcpy(record->strs + str_used, str, len);
+                record->strs[str_used + len] = '\0';
+                arg->str = str_used;
+
+                /* Once full, later strings share the final terminator. */
+                str_used += len;
+                if (str_used < LOG_DEFERRED_STR_BYTES - 1) {
+                    ++str_used;
+                }
+                break;
+            }
+            case ARG_NONE:
+                continue;
+        }
+        ++num_args;
+    }
+    va_end(ap);
+    record->num_args = (uint8_t)num_args;
+
+    atomic_store_explicit(&record->seq, head + 1, memory_order_release);
+}
+
+static const char* level_prefix(int level)
+{
+    switch (level) {
+        case LOG_LEVEL_TRACE:
+            return "TRACE - ";
+        case LOG_LEVEL_DEBUG:
+            return "DEBUG - ";
+        case LOG_LEVEL_INFO:
+            return "INFO - ";
+        case LOG_LEVEL_WARN:
+            return "WARN - ";
+        default:
+            return "ERROR - ";
+    }
+}
+
+/** @brief  Appends to a conversion specification being rebuilt. */
+static size_t append(char* dst, size_t used, size_t size, const char* src, size_t len)
+{
+    if (used + len >= size) {
+        len = size - used - 1;
+    }
+    memcpy(dst + used, src, len);
+    dst[used + len] = '\0';
+    return used + len;
+}
+
+static void print_record(const log_record_t* record)
+{
+    fputs(level_prefix(record->level), stdout);
+
+    size_t arg_idx = 0;
+    const char* p = record->fmt;
+    while (*p) {
+        const char* literal = p;
+        while (*p && *p != '%') {
+            ++p;
+        }
+        fwrite(literal, 1, (size_t)(p - literal), stdout);
+        if (!*p) {
+            break;
+        }
+
+        const char* spec_start = p++;
+        log_spec_t spec;
+        p = parse_spec(p, &spec);
+        if (spec.conv == '%') {
+            putchar('%');
+            continue;
+        }
+
+        const size_t needed = (size_t)(spec.star_width + spec.star_prec + (spec.cls != ARG_NONE));
+        if (spec.cls == ARG_NONE || arg_idx + needed > record->num_args) {
+            /* Unknown conversion, or past the arguments kept: print it as is. */
+            fwrite(spec_start, 1, (size_t)(p - spec_start), stdout);
+            arg_idx = record->num_args;
+            continue;
+        }
+
+        /* Rebuild the specification with '*'s filled in and integers widened to long long. */
+        char conv[48] = "%";
+        char number[16];
+        size_t used = 1;
+        used = append(conv, used, sizeof(conv), spec.flags, spec.flags_len);
+        if (spec.star_width) {
+            snprintf(number, sizeof(number), "%lld", record->args[arg_idx++].i);
+            used = append(conv, used, sizeof(conv), number, strlen(number));
+        } else {
+            used = append(conv, used, sizeof(conv), spec.width, spec.width_len);
+        }
+        if (spec.has_prec) {
+            used = append(conv, used, sizeof(conv), ".", 1);
+            if (spec.star_prec) {
+                snprintf(number, sizeof(number), "%lld", record->args[arg_idx++].i);
+                used = append(conv, used, sizeof(conv), number, strlen(number));
+            } else {
+                used = append(conv, used, sizeof(conv), spec.prec, spec.prec_len);
+            }
+        }
+        if (spec.cls == ARG_INT || spec.cls == ARG_UINT) {
+            used = append(conv, used, sizeof(conv), "ll", 2);
+        }
+        append(conv, used, sizeof(conv), &spec.conv, 1);
+
+        const log_arg_t* arg = &record->args[arg_idx++];
+        switch (spec.cls) {
+            case ARG_INT:
+                printf(conv, arg->i);
+                break;
+            case ARG_UINT:
+                printf(conv, arg->u);
+                break;
+            case ARG_DOUBLE:
+                printf(conv, arg->d);
+                break;
+            case ARG_CHAR:
+                printf(conv, (int)arg->i);
+                break;
+            case ARG_PTR:
+                if (spec.conv == 'p') {
+                    printf(conv, arg->p);
+                }
+                break;
+            case ARG_STR:
+                printf(conv, record->strs + arg->str);
+                break;
+            case ARG_NONE:
+                break;
+        }
+    }
+}
+
+size_t log_deferred_flush(void)
+{
+    size_t printed = 0;
+    unsigned int tail = atomic_load_explicit(&s_tail, memory_order_relaxed);
+    for (;;) {
+        log_record_t* record = &s_records[tail & (LOG_DEFERRED_RECORDS - 1)];
+        if (atomic_load_explicit(&record->seq, memory_order_acquire) != tail + 1) {
+            break;
+        }
+
+        print_record(record);
+        ++printed;
+        ++tail;
+        atomic_store_explicit(&s_tail, tail, memory_order_release);
+    }
+
+    static uint32_t s_reported = 0;
+    const uint32_t dropped = atomic_load_explicit(&s_dropped, memory_order_relaxed);
+    if (dropped != s_reported) {
+        printf("WARN - %" PRIu32 " log messages dropped, flush more often or raise LOG_DEFERRED_RECORDS\n",
+               dropped - s_reported);
+        s_reported = dropped;
+    }
+
+    fflush(stdout);
+    return printed;
+}
+
+uint32_t log_deferred_dropped(void)
+{
+    return atomic_load_explicit(&s_dropped, memory_order_relaxed);
+}
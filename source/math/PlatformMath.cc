@@ -17,6 +17,8 @@
 #include "PlatformMath.hpp"
 #include "log_macros.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace arm {
 namespace app {
@@ -222,6 +224,186 @@ namespace math {
         }
     }
 
+    void MathUtils::FftInitQ31(const uint16_t fftLen,
+                               FftInstanceQ31& fftInstance)
+    {
+        if (fftLen == 0 || (fftLen & (fftLen - 1)) != 0) {
+            printf_err("FFT len %" PRIu16 " is not a power of 2\n", fftLen);
+            return;
+        }
+
+        fftInstance.m_fftLen = fftLen;
+        fftInstance.m_optimisedOptionAvailable = false;
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        if (ARM_MATH_SUCCESS != arm_rfft_init_q31(&fftInstance.m_instanceReal, fftLen, 0, 1)) {
+            printf_err("Failed to initialise q31 FFT for len %d\n", fftLen);
+        } else {
+            fftInstance.m_optimisedOptionAvailable = true;
+        }
+#endif /* __ARM_FEATURE_DSP */
+
+        if (!fftInstance.m_optimisedOptionAvailable) {
+            /* Twiddles e^(-j2pi k/N) for k < N/2, as q31 cosine and sine pairs. */
+            fftInstance.m_twiddles.resize(fftLen);
+            for (size_t k = 0; k < fftLen / 2u; ++k) {
+                const auto angle = static_cast<float>(2 * M_PI * k / fftLen);
+                const float cosine = MathUtils::CosineF32(angle);
+                const float sine = -MathUtils::SineF32(angle);
+                fftInstance.m_twiddles[2 * k] = static_cast<int32_t>(
+                    std::min(std::round(cosine * 2147483648.0), 2147483647.0));
+                fftInstance.m_twiddles[2 * k + 1] = static_cast<int32_t>(
+                    std::min(std::round(sine * 2147483648.0), 2147483647.0));
+            }
+        }
+
+        debug("Optimised q31 FFT will be used: %s.\n", fftInstance.m_optimisedOptionAvailable? "yes": "no");
+
+        fftInstance.m_initialised = true;
+    }
+
+    static void FftRealQ31(std::vector<int32_t>& input,
+                           std::vector<int32_t>& fftOutput,
+                           const std::vector<int32_t>& twiddles,
+                           const uint16_t fftLen)
+    {
+        /* Radix-2 decimation in time on the input as a complex signal. Each
+         * stage halves its output, so the result is the DFT / fftLen. */
+        uint32_t numBits = 0;
+        while ((1u << numBits) < fftLen) {
+            ++numBits;
+        }
+
+        for (uint32_t i = 0; i < fftLen; ++i) {
+            uint32_t reversed = 0;
+            for (uint32_t bit = 0; bit < numBits; ++bit) {
+                reversed |= ((i >> bit) & 1u) << (numBits - 1 - bit);
+            }
+            fftOutput[2 * reversed] = input[i];
+            fftOutput[2 * reversed + 1] = 0;
+        }
+
+        for (uint32_t size = 2; size <= fftLen; size <<= 1) {
+            const uint32_t half = size / 2;
+            const uint32_t step = fftLen / size;
+            for (uint32_t start = 0; start < fftLen; start += size) {
+                for (uint32_t k = 0; k < half; ++k) {
+                    const int64_t cosine = twiddles[2 * k * step];
+                    const int64_t sine = twiddles[2 * k * step + 1];
+                    int32_t* a = &fftOutput[2 * (start + k)];
+                    int32_t* b = &fftOutput[2 * (start + k + half)];
+
+                    const int64_t tr = (cosine * b[0] - sine * b[1]) >> 31;
+                    const int64_t ti = (cosine * b[1] + sine * b[0]) >> 31;
+                    const int64_t ar = a[0];
+                    const int64_t ai = a[1];
+
+                    a[0] = static_cast<int32_t>((ar + tr) >> 1);
+                    a[1] = static_cast<int32_t>((ai + ti) >> 1);
+                    b[0] = static_cast<int32_t>((ar - tr) >> 1);
+                    b[1] = static_cast<int32_t>((ai - ti) >> 1);
+                }
+            }
+        }
+    }
+
+    void MathUtils::FftQ31(std::vector<int32_t>& input,
+                           std::vector<int32_t>& fftOutput,
+                           FftInstanceQ31& fftInstance)
+    {
+        if (!fftInstance.m_initialised) {
+            printf_err("FFT uninitialised\n");
+            return;
+        } else if (input.size() < fftInstance.m_fftLen) {
+            printf_err("FFT len: %" PRIu16 "; input len: %zu\n",
+                fftInstance.m_fftLen, input.size());
+            return;
+        } else if (fftOutput.size() < 2u * fftInstance.m_fftLen) {
+            printf_err("Output vector len insufficient to hold FFTs\n");
+            return;
+        }
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        if (fftInstance.m_optimisedOptionAvailable) {
+            arm_rfft_q31(&fftInstance.m_instanceReal, input.data(), fftOutput.data());
+            return;
+        }
+#endif /* __ARM_FEATURE_DSP */
+        FftRealQ31(input, fftOutput, fftInstance.m_twiddles, fftInstance.m_fftLen);
+    }
+
+    int32_t MathUtils::LogarithmQ16(uint64_t x)
+    {
+        /* log2(1 + i/64) in Q16.16. */
+        static const uint32_t log2Table[65] = {
+            0, 1466, 2909, 4331, 5732, 7112, 8473, 9814, 11136, 12440, 13727, 14996, 16248,
+            17484, 18704, 19909, 21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+            30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346, 38336, 39316, 40286,
+            41246, 42196, 43137, 44068, 44990, 45904, 46809, 47705, 48593, 49472, 50344,
+            51207, 52063, 52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643, 59434,
+            60219, 60997, 61769, 62534, 63294, 64047, 64794, 65536
+        };
+        constexpr int64_t ln2Q16 = 45426;   /* ln(2) * 2^16 */
+
+        if (x == 0) {
+            return INT32_MIN;
+        }
+
+        int32_t msb = 63;
+        while (!(x & (1ull << msb))) {
+            --msb;
+        }
+
+        /* Mantissa as 1.63 fixed point: 6 bits index the table, the next 16 interpolate. */
+        const uint64_t mantissa = x << (63 - msb);
+        const uint32_t index = (mantissa >> 57) & 0x3F;
+        const uint32_t frac = (mantissa >> 41) & 0xFFFF;
+        const uint32_t log2Frac = log2Table[index] +
+            (((log2Table[index + 1] - log2Table[index]) * frac) >> 16);
+
+        const int64_t log2Q16 = (static_cast<int64_t>(msb) << 16) + log2Frac;
+        return static_cast<int32_t>((log2Q16 * ln2Q16) >> 16);
+    }
+
+    uint32_t MathUtils::SqrtU64(uint64_t x)
+    {
+        uint64_t root = 0;
+        uint64_t bit = 1ull << 62;
+        while (bit > x) {
+            bit >>= 2;
+        }
+
+        while (bit) {
+            if (x >= root + bit) {
+                x -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return static_cast<uint32_t>(root);
+    }
+
+    uint32_t MathUtils::ArgMaxQ7(const int8_t* ptrSrc, const uint32_t srcLen, int8_t& maxVal)
+    {
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        uint32_t maxIdx = 0;
+        arm_max_q7(ptrSrc, srcLen, &maxVal, &maxIdx);
+        return maxIdx;
+#else  /* __ARM_FEATURE_DSP */
+        uint32_t maxIdx = 0;
+        maxVal = ptrSrc[0];
+        for (uint32_t i = 1; i < srcLen; ++i) {
+            if (ptrSrc[i] > maxVal) {
+                maxVal = ptrSrc[i];
+                maxIdx = i;
+            }
+        }
+        return maxIdx;
+#endif /* __ARM_FEATURE_DSP */
+    }
+
     void MathUtils::VecLogarithmF32(std::vector <float>& input,
                                     std::vector <float>& output)
     {
@@ -236,7 +418,7 @@ namespace math {
 #endif /* __ARM_FEATURE_DSP */
     }
 
-    float MathUtils::DotProductF32(float* srcPtrA, float* srcPtrB,
+    float MathUtils::DotProductF32(const float* srcPtrA, const float* srcPtrB,
                                    const uint32_t srcLen)
     {
         float output = 0.f;
@@ -252,6 +434,47 @@ namespace math {
         return output;
     }
 
+    bool MathUtils::MatMulF32(const float* srcA, const uint32_t rowsA, const uint32_t colsA,
+                              const float* srcB, const uint32_t colsB, float* dst)
+    {
+        if (rowsA > UINT16_MAX || colsA > UINT16_MAX || colsB > UINT16_MAX) {
+            printf_err("Matrix dimensions too large\n");
+            return false;
+        }
+
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        /* CMSIS-DSP doesn't modify the sources but its instances aren't const. */
+        arm_matrix_instance_f32 matA;
+        arm_matrix_instance_f32 matB;
+        arm_matrix_instance_f32 matDst;
+        arm_mat_init_f32(&matA, rowsA, colsA, const_cast<float*>(srcA));
+        arm_mat_init_f32(&matB, colsA, colsB, const_cast<float*>(srcB));
+        arm_mat_init_f32(&matDst, rowsA, colsB, dst);
+
+        return arm_mat_mult_f32(&matA, &matB, &matDst) == ARM_MATH_SUCCESS;
+#else  /* __ARM_FEATURE_DSP */
+        /* Blocked over the inner dimension so a block of rows of B stays in
+         * cache while it is accumulated into every row of the output. */
+        constexpr uint32_t blockSize = 32;
+        std::fill(dst, dst + rowsA * colsB, 0.f);
+
+        for (uint32_t k0 = 0; k0 < colsA; k0 += blockSize) {
+            const uint32_t k1 = std::min(colsA, k0 + blockSize);
+            for (uint32_t i = 0; i < rowsA; ++i) {
+                float* dstRow = dst + i * colsB;
+                for (uint32_t k = k0; k < k1; ++k) {
+                    const float a = srcA[i * colsA + k];
+                    const float* srcRow = srcB + k * colsB;
+                    for (uint32_t j = 0; j < colsB; ++j) {
+                        dstRow[j] += a * srcRow[j];
+                    }
+                }
+            }
+        }
+        return true;
+#endif /* __ARM_FEATURE_DSP */
+    }
+
     bool MathUtils::ComplexMagnitudeSquaredF32(float* ptrSrc,
                                                const uint32_t srcLen,
                                                float* ptrDst,
@@ -297,6 +520,246 @@ namespace math {
         return 1.f/(1.f + std::exp(-x));
     }
 
+#if !PLATFORM_MATH_F16
+    uint16_t Float16::FromFloat(const float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+        const uint32_t absBits = bits & 0x7FFFFFFF;
+
+        if (absBits >= 0x7F800000) {
+            /* Infinity or NaN, keeping NaNs quiet. */
+            return sign | 0x7C00 | (absBits > 0x7F800000 ? 0x200 : 0);
+        } else if (absBits >= 0x477FF000) {
+            /* 65520 and above round to infinity. */
+            return sign | 0x7C00;
+        } else if (absBits < 0x38800000) {
+            /* Below 2^-14: subnormal, in units of 2^-24. */
+            if (absBits < 0x33000000) {
+                return sign;
+            }
+            const uint32_t mantissa = (absBits & 0x7FFFFF) | 0x800000;
+            const uint32_t shift = 126 - (absBits >> 23);
+            uint32_t half = mantissa >> shift;
+            const uint32_t rem = mantissa & ((1u << shift) - 1);
+            const uint32_t tie = 1u << (shift - 1);
+            if (rem > tie || (rem == tie && (half & 1))) {
+                ++half;
+            }
+            return sign | static_cast<uint16_t>(half);
+        }
+
+        /* Rebias the exponent and round the mantissa, a carry bumps the exponent. */
+        uint32_t half = (absBits - 0x38000000) >> 13;
+        const uint32_t rem = absBits & 0x1FFF;
+        if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) {
+            ++half;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    float Float16::ToFloat(const uint16_t bits)
+    {
+        const uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+        const uint32_t exponent = (bits >> 10) & 0x1F;
+        const uint32_t mantissa = bits & 0x3FF;
+
+        if (exponent == 0) {
+            const float value = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -value : value;
+        }
+
+        const uint32_t floatBits = sign | (exponent == 0x1F ? 0x7F800000 : (exponent + 112) << 23) |
+                                   (mantissa << 13);
+        float value;
+        std::memcpy(&value, &floatBits, sizeof(value));
+        return value;
+    }
+#endif /* !PLATFORM_MATH_F16 */
+
+    void MathUtils::VecConvertF32ToF16(const float* ptrSrc, float16* ptrDst, const uint32_t srcLen)
+    {
+#if PLATFORM_MATH_F16
+        arm_float_to_f16(ptrSrc, ptrDst, srcLen);
+#else  /* PLATFORM_MATH_F16 */
+        std::copy(ptrSrc, ptrSrc + srcLen, ptrDst);
+#endif /* PLATFORM_MATH_F16 */
+    }
+
+    void MathUtils::VecConvertF16ToF32(const float16* ptrSrc, float* ptrDst, const uint32_t srcLen)
+    {
+#if PLATFORM_MATH_F16
+        arm_f16_to_float(ptrSrc, ptrDst, srcLen);
+#else  /* PLATFORM_MATH_F16 */
+        std::copy(ptrSrc, ptrSrc + srcLen, ptrDst);
+#endif /* PLATFORM_MATH_F16 */
+    }
+
+    void MathUtils::FftInitF16(const uint16_t fftLen,
+                               FftInstanceF16& fftInstance,
+                               const FftType type)
+    {
+        fftInstance.m_fftLen = fftLen;
+        fftInstance.m_initialised = false;
+        fftInstance.m_optimisedOptionAvailable = false;
+        fftInstance.m_type = type;
+
+#if PLATFORM_MATH_F16
+        arm_status status = ARM_MATH_ARGUMENT_ERROR;
+        switch (fftInstance.m_type) {
+        case FftType::real:
+            status = arm_rfft_fast_init_f16(&fftInstance.m_instanceReal, fftLen);
+            break;
+
+        case FftType::complex:
+            status = arm_cfft_init_f16(&fftInstance.m_instanceComplex, fftLen);
+            break;
+
+        default:
+            printf_err("Invalid FFT type\n");
+            return;
+        }
+
+        if (ARM_MATH_SUCCESS != status) {
+            printf_err("Failed to initialise f16 FFT for len %d\n", fftLen);
+        } else {
+            fftInstance.m_optimisedOptionAvailable = true;
+        }
+#endif /* PLATFORM_MATH_F16 */
+
+        debug("Optimised f16 FFT will be used: %s.\n", fftInstance.m_optimisedOptionAvailable? "yes": "no");
+
+        fftInstance.m_initialised = true;
+    }
+
+    void MathUtils::FftF16(std::vector<float16>& input,
+                           std::vector<float16>& fftOutput,
+                           FftInstanceF16& fftInstance)
+    {
+        if (!fftInstance.m_initialised) {
+            printf_err("FFT uninitialised\n");
+            return;
+        } else if (input.size() < fftInstance.m_fftLen) {
+            printf_err("FFT len: %" PRIu16 "; input len: %zu\n",
+                fftInstance.m_fftLen, input.size());
+            return;
+        } else if (fftOutput.size() < input.size()) {
+            printf_err("Output vector len insufficient to hold FFTs\n");
+            return;
+        } else if (fftInstance.m_type == FftType::complex && input.size() < fftInstance.m_fftLen * 2u) {
+            printf_err("Complex FFT instance should have input size >= (FFT len x 2)");
+            return;
+        }
+
+#if PLATFORM_MATH_F16
+        if (fftInstance.m_optimisedOptionAvailable) {
+            if (fftInstance.m_type == FftType::real) {
+                arm_rfft_fast_f16(&fftInstance.m_instanceReal, input.data(), fftOutput.data(), 0);
+            } else {
+                fftOutput = input; /* Complex function works in-place */
+                arm_cfft_f16(&fftInstance.m_instanceComplex, fftOutput.data(), 0, 1);
+            }
+            return;
+        }
+#endif /* PLATFORM_MATH_F16 */
+
+        /* Computed in float32, with the input and output rounded to half precision. */
+        std::vector<float> inputF32(input.size());
+        std::vector<float> outputF32(fftOutput.size());
+        VecConvertF16ToF32(input.data(), inputF32.data(), input.size());
+        if (fftInstance.m_type == FftType::real) {
+            FftRealF32(inputF32, outputF32);
+        } else {
+            FftComplexF32(inputF32, outputF32);
+        }
+        VecConvertF32ToF16(outputF32.data(), fftOutput.data(), fftOutput.size());
+    }
+
+    void MathUtils::VecLogarithmF16(std::vector<float16>& input,
+                                    std::vector<float16>& output)
+    {
+#if PLATFORM_MATH_F16
+        arm_vlog_f16(input.data(), output.data(),
+                     output.size());
+#else  /* PLATFORM_MATH_F16 */
+        for (auto in = input.begin(), out = output.begin();
+             in != input.end() && out != output.end(); ++in, ++out) {
+            *out = logf(*in);
+        }
+#endif /* PLATFORM_MATH_F16 */
+    }
+
+    float16 MathUtils::DotProductF16(float16* srcPtrA, float16* srcPtrB,
+                                     const uint32_t srcLen)
+    {
+#if PLATFORM_MATH_F16
+        float16 output = 0;
+        arm_dot_prod_f16(srcPtrA, srcPtrB, srcLen, &output);
+        return output;
+#else  /* PLATFORM_MATH_F16 */
+        float output = 0.f;
+        for (uint32_t i = 0; i < srcLen; ++i) {
+            output += *srcPtrA++ * *srcPtrB++;
+        }
+        return output;
+#endif /* PLATFORM_MATH_F16 */
+    }
+
+    bool MathUtils::ComplexMagnitudeSquaredF16(float16* ptrSrc,
+                                               const uint32_t srcLen,
+                                               float16* ptrDst,
+                                               const uint32_t dstLen)
+    {
+        if (dstLen < srcLen/2) {
+            printf_err("dstLen must be greater than srcLen/2");
+            return false;
+        }
+
+#if PLATFORM_MATH_F16
+        arm_cmplx_mag_squared_f16(ptrSrc, ptrDst, srcLen/2);
+#else  /* PLATFORM_MATH_F16 */
+        for (uint32_t j = 0; j < srcLen/2; ++j) {
+            const float real = *ptrSrc++;
+            const float im = *ptrSrc++;
+            *ptrDst++ = real*real + im*im;
+        }
+#endif /* PLATFORM_MATH_F16 */
+        return true;
+    }
+
+    void MathUtils::SoftmaxF16(std::vector<float16>& vec)
+    {
+        if (vec.empty()) {
+            return;
+        }
+
+        /* Fix for numerical stability and apply exp. */
+        const float maxValue = *std::max_element(vec.begin(), vec.end());
+#if PLATFORM_MATH_F16
+        arm_offset_f16(vec.data(), static_cast<float16>(-maxValue), vec.data(), vec.size());
+        arm_vexp_f16(vec.data(), vec.data(), vec.size());
+#else  /* PLATFORM_MATH_F16 */
+        for (auto& value : vec) {
+            value = std::exp(value - maxValue);
+        }
+#endif /* PLATFORM_MATH_F16 */
+
+        /* The sum is kept in float32, as it can exceed the half precision range. */
+        float sumExp = 0.f;
+        for (const auto value : vec) {
+            sumExp += value;
+        }
+
+#if PLATFORM_MATH_F16
+        arm_scale_f16(vec.data(), static_cast<float16>(1.f / sumExp), vec.data(), vec.size());
+#else  /* PLATFORM_MATH_F16 */
+        for (auto& value : vec) {
+            value = value / sumExp;
+        }
+#endif /* PLATFORM_MATH_F16 */
+    }
+
 } /* namespace math */
 } /* namespace app */
 } /* namespace arm */
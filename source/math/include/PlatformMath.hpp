@@ -20,11 +20,19 @@
 /* See if ARM DSP functions can be used. */
 #if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
 #include "arm_math.h"
+#include "arm_math_f16.h"
 #define M_PI (PI)
 #else /* (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) */
 #include <cmath>
 #endif /* (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) */
 
+/* See if native half precision (e.g. MVE FP16 lanes) can be used. */
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) && defined(ARM_FLOAT16_SUPPORTED)
+#define PLATFORM_MATH_F16   1
+#else /* ARM_FLOAT16_SUPPORTED */
+#define PLATFORM_MATH_F16   0
+#endif /* ARM_FLOAT16_SUPPORTED */
+
 #include <vector>
 #include <cstdint>
 #include <numeric>
@@ -49,6 +57,59 @@ namespace math {
         bool                        m_initialised{false};
     };
 
+    struct FftInstanceQ31 {
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+        arm_rfft_instance_q31       m_instanceReal;
+#endif /* (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) */
+        std::vector<int32_t>        m_twiddles;     /* For the non-optimised FFT only */
+        uint16_t                    m_fftLen{0};
+        bool                        m_optimisedOptionAvailable{false};
+        bool                        m_initialised{false};
+    };
+
+#if PLATFORM_MATH_F16
+    using float16 = float16_t;
+#else /* PLATFORM_MATH_F16 */
+    /**
+     * @brief   Emulated half precision value for platforms without one. It
+     *          is stored as IEEE 754 binary16 and arithmetic is done in
+     *          float32, so every value written back is rounded to half
+     *          precision the way it would be on the target.
+     */
+    class Float16 {
+    public:
+        Float16() = default;
+        Float16(float value): m_bits(FromFloat(value)) {}
+
+        operator float() const { return ToFloat(this->m_bits); }
+
+        Float16& operator+=(float value) { return *this = static_cast<float>(*this) + value; }
+        Float16& operator-=(float value) { return *this = static_cast<float>(*this) - value; }
+        Float16& operator*=(float value) { return *this = static_cast<float>(*this) * value; }
+        Float16& operator/=(float value) { return *this = static_cast<float>(*this) / value; }
+
+    private:
+        uint16_t m_bits{0};
+
+        /** @brief  Rounds to the nearest binary16 value, ties to even. */
+        static uint16_t FromFloat(float value);
+        static float ToFloat(uint16_t bits);
+    };
+
+    using float16 = Float16;
+#endif /* PLATFORM_MATH_F16 */
+
+    struct FftInstanceF16 {
+#if PLATFORM_MATH_F16
+        arm_rfft_fast_instance_f16  m_instanceReal;
+        arm_cfft_instance_f16       m_instanceComplex;
+#endif /* PLATFORM_MATH_F16 */
+        uint16_t                    m_fftLen{0};
+        FftType                     m_type{FftType::real};
+        bool                        m_optimisedOptionAvailable{false};
+        bool                        m_initialised{false};
+    };
+
     /* Class to provide Math functions like FFT, mean, stddev etc.
      * This will allow other classes, functions to be independent of
      * #if definition checks and provide a cleaner API. Also, it will
@@ -119,6 +180,53 @@ namespace math {
                            std::vector<float>& fftOutput,
                            FftInstance& fftInstance);
 
+        /**
+         * @brief       Initialises the internal fixed point real FFT structures.
+         *              This function should be called prior to FftQ31.
+         * @param[in]   fftLen        Requested length of the FFT, a power of 2.
+         * @param[in]   fftInstance   FFT instance struct to use.
+         */
+        static void FftInitQ31(uint16_t fftLen,
+                               FftInstanceQ31& fftInstance);
+
+        /**
+         * @brief       Computes the real FFT of q31 input. As with CMSIS-DSP,
+         *              the output is scaled down by the FFT length.
+         * @param[in]   input       q31 input elements, modified by the call.
+         * @param[out]  fftOutput   Output buffer of at least twice the FFT
+         *                          length. Bin k, for k = 0 to FFT length / 2,
+         *                          is at 2k (real) and 2k + 1 (imaginary).
+         * @param[in]   fftInstance FFT instance struct to use.
+         */
+        static void FftQ31(std::vector<int32_t>& input,
+                           std::vector<int32_t>& fftOutput,
+                           FftInstanceQ31& fftInstance);
+
+        /**
+         * @brief       Computes the natural logarithm of an integer in Q16.16
+         *              fixed point, from a table of log2 with linear
+         *              interpolation (error under 1e-4).
+         * @param[in]   x   Input value, must not be 0.
+         * @return      ln(x) * 2^16, or INT32_MIN for 0.
+         */
+        static int32_t LogarithmQ16(uint64_t x);
+
+        /**
+         * @brief       Computes the integer square root of an integer.
+         * @param[in]   x   Input value.
+         * @return      floor(sqrt(x)).
+         */
+        static uint32_t SqrtU64(uint64_t x);
+
+        /**
+         * @brief       Finds the largest element of an int8 vector.
+         * @param[in]   ptrSrc   Pointer to the first element.
+         * @param[in]   srcLen   Number of elements, must not be 0.
+         * @param[out]  maxVal   Largest value.
+         * @return      Index of the first occurrence of the largest value.
+         */
+        static uint32_t ArgMaxQ7(const int8_t* ptrSrc, uint32_t srcLen, int8_t& maxVal);
+
         /**
          * @brief       Computes the natural logarithms of input floating point
          *              vector
@@ -140,9 +248,25 @@ namespace math {
          * @param[in]   srcLen    Number of elements in the array/vector.
          * @return      Dot product.
          */
-        static float DotProductF32(float* srcPtrA, float* srcPtrB,
+        static float DotProductF32(const float* srcPtrA, const float* srcPtrB,
                                    uint32_t srcLen);
 
+        /**
+         * @brief       Multiplies two row-major floating point matrices.
+         *              dst = srcA * srcB
+         * @param[in]   srcA    Pointer to the first matrix, rowsA x colsA.
+         * @param[in]   rowsA   Number of rows of the first matrix.
+         * @param[in]   colsA   Number of columns of the first matrix, and
+         *                      number of rows of the second one.
+         * @param[in]   srcB    Pointer to the second matrix, colsA x colsB.
+         * @param[in]   colsB   Number of columns of the second matrix.
+         * @param[out]  dst     Output buffer of rowsA x colsB elements, must not
+         *                      overlap the inputs.
+         * @return      true if successful, false otherwise.
+         */
+        static bool MatMulF32(const float* srcA, uint32_t rowsA, uint32_t colsA,
+                              const float* srcB, uint32_t colsB, float* dst);
+
         /**
          * @brief       Computes the squared magnitude of floating point
          *              complex number array.
@@ -171,6 +295,87 @@ namespace math {
         * @return      Sigmoid value of the input.
         */
         static float SigmoidF32(float x);
+
+        /**
+         * @brief       Converts floating point values to half precision.
+         * @param[in]   ptrSrc   Pointer to the first input element.
+         * @param[out]  ptrDst   Pointer to the first output element.
+         * @param[in]   srcLen   Number of elements to convert.
+         */
+        static void VecConvertF32ToF16(const float* ptrSrc, float16* ptrDst, uint32_t srcLen);
+
+        /**
+         * @brief       Converts half precision values to floating point.
+         * @param[in]   ptrSrc   Pointer to the first input element.
+         * @param[out]  ptrDst   Pointer to the first output element.
+         * @param[in]   srcLen   Number of elements to convert.
+         */
+        static void VecConvertF16ToF32(const float16* ptrSrc, float* ptrDst, uint32_t srcLen);
+
+        /**
+         * @brief       Initialises the internal half precision FFT structures.
+         *              This function should be called prior to FftF16.
+         * @param[in]   fftLen        Requested length of the FFT.
+         * @param[in]   fftInstance   FFT instance struct to use.
+         * @param[in]   type          FFT type (real or complex)
+         */
+        static void FftInitF16(uint16_t fftLen,
+                               FftInstanceF16& fftInstance,
+                               FftType type = FftType::real);
+
+        /**
+         * @brief       Computes the FFT for the half precision input vector,
+         *              with the same output layout as FftF32. The output isn't
+         *              scaled, so input should be small enough for the
+         *              largest bin to stay under 65504.
+         * @param[in]   input       Half precision vector of input elements.
+         * @param[out]  fftOutput   Output buffer to be populated by computed FFTs.
+         * @param[in]   fftInstance FFT instance struct to use.
+         */
+        static void FftF16(std::vector<float16>& input,
+                           std::vector<float16>& fftOutput,
+                           FftInstanceF16& fftInstance);
+
+        /**
+         * @brief       Computes the natural logarithms of input half precision
+         *              vector.
+         * @param[in]   input    Half precision input vector.
+         * @param[out]  output   Pre-allocated buffer to be populated with
+         *                       natural log values of each input element.
+         */
+        static void VecLogarithmF16(std::vector<float16>& input,
+                                    std::vector<float16>& output);
+
+        /**
+         * @brief       Computes the dot product of two 1D half precision
+         *              vectors.
+         * @param[in]   srcPtrA   Pointer to the first element of first array.
+         * @param[in]   srcPtrB   Pointer to the first element of second array.
+         * @param[in]   srcLen    Number of elements in the array/vector.
+         * @return      Dot product.
+         */
+        static float16 DotProductF16(float16* srcPtrA, float16* srcPtrB,
+                                     uint32_t srcLen);
+
+        /**
+         * @brief       Computes the squared magnitude of half precision
+         *              complex number array.
+         * @param[in]   ptrSrc   Pointer to the first element of input array.
+         * @param[in]   srcLen   Number of elements in the array/vector.
+         * @param[out]  ptrDst   Output buffer to be populated.
+         * @param[in]   dstLen   Output buffer len (for sanity check only).
+         * @return      true if successful, false otherwise.
+         */
+        static bool ComplexMagnitudeSquaredF16(float16* ptrSrc,
+                                               uint32_t srcLen,
+                                               float16* ptrDst,
+                                               uint32_t dstLen);
+
+        /**
+        * @brief       Scales half precision scores so that they sum to 1.
+        * @param[in]   vector Vector of half precision values modified in-place
+        */
+        static void SoftmaxF16(std::vector<float16>& vec);
     };
 
     inline float MathUtils::SqrtF32(float input)
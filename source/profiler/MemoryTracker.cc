@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MemoryTracker.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#if MEMORY_PROFILING && defined(__arm__)
+#define STACK_PAINTING 1
+
+/* Main stack boundaries, from the linker script or scatter file. */
+#if defined(__ARMCC_VERSION)
+extern "C" uint32_t Image$$ARM_LIB_STACK$$ZI$$Base[];
+extern "C" uint32_t Image$$ARM_LIB_STACK$$ZI$$Limit[];
+#define STACK_LIMIT Image$$ARM_LIB_STACK$$ZI$$Base
+#define STACK_TOP   Image$$ARM_LIB_STACK$$ZI$$Limit
+#else
+extern "C" uint32_t __StackLimit[];
+extern "C" uint32_t __StackTop[];
+#define STACK_LIMIT __StackLimit
+#define STACK_TOP   __StackTop
+#endif
+
+#else
+#define STACK_PAINTING 0
+#endif /* MEMORY_PROFILING && defined(__arm__) */
+
+namespace {
+
+    arm::app::memory::HeapCounters s_heap;
+
+#if STACK_PAINTING
+    constexpr uint32_t stackPattern = 0xA5A5A5A5;
+
+    /* Words left untouched below the painting frame, for interrupts taken while painting. */
+    constexpr size_t stackGuardWords = 32;
+#endif /* STACK_PAINTING */
+
+#if MEMORY_PROFILING
+    /* Allocations carry their size in a header, so frees can be accounted for. */
+    constexpr size_t headerSize = alignof(std::max_align_t);
+
+    void* TrackedAlloc(std::size_t size)
+    {
+        auto* block = static_cast<unsigned char*>(std::malloc(size + headerSize));
+        if (!block) {
+            return nullptr;
+        }
+        *reinterpret_cast<std::size_t*>(block) = size;
+
+        s_heap.allocatedBytes += size;
+        ++s_heap.allocations;
+        s_heap.inUseBytes += size;
+        s_heap.peakBytes = std::max(s_heap.peakBytes, s_heap.inUseBytes);
+        return block + headerSize;
+    }
+
+    void TrackedFree(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+        auto* block = static_cast<unsigned char*>(ptr) - headerSize;
+
+        s_heap.inUseBytes -= *reinterpret_cast<std::size_t*>(block);
+        ++s_heap.frees;
+        std::free(block);
+    }
+
+    void* TrackedNew(std::size_t size)
+    {
+        void* ptr;
+        while (nullptr == (ptr = TrackedAlloc(size))) {
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+#if defined(__cpp_exceptions)
+                throw std::bad_alloc();
+#else
+                std::abort();
+#endif /* defined(__cpp_exceptions) */
+            }
+            handler();
+        }
+        return ptr;
+    }
+#endif /* MEMORY_PROFILING */
+
+} /* namespace */
+
+#if MEMORY_PROFILING
+/* Replacements for the global allocation functions. */
+void* operator new(std::size_t size)
+{
+    return TrackedNew(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return TrackedNew(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    TrackedFree(ptr);
+}
+#endif /* MEMORY_PROFILING */
+
+namespace arm {
+namespace app {
+namespace memory {
+
+    HeapCounters GetHeapCounters()
+    {
+        return s_heap;
+    }
+
+    std::size_t ResetHeapPeak()
+    {
+        const std::size_t peak = s_heap.peakBytes;
+        s_heap.peakBytes = s_heap.inUseBytes;
+        return peak;
+    }
+
+    void RestoreHeapPeak(const std::size_t peak)
+    {
+        s_heap.peakBytes = std::max(s_heap.peakBytes, peak);
+    }
+
+    __attribute__((noinline)) bool PaintStack()
+    {
+#if STACK_PAINTING
+        volatile uint32_t marker = 0;
+        auto* current = const_cast<uint32_t*>(&marker);
+        if (current <= STACK_LIMIT + stackGuardWords || current > STACK_TOP) {
+            return false;
+        }
+
+        for (volatile uint32_t* word = STACK_LIMIT; word < current - stackGuardWords; ++word) {
+            *word = stackPattern;
+        }
+        return true;
+#else
+        return false;
+#endif /* STACK_PAINTING */
+    }
+
+    std::size_t GetStackHighWater()
+    {
+#if STACK_PAINTING
+        const volatile uint32_t* word = STACK_LIMIT;
+        while (word < STACK_TOP && *word == stackPattern) {
+            ++word;
+        }
+        return (STACK_TOP - word) * sizeof(uint32_t);
+#else
+        return 0;
+#endif /* STACK_PAINTING */
+    }
+
+} /* namespace memory */
+} /* namespace app */
+} /* namespace arm */
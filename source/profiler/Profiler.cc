@@ -17,6 +17,7 @@
 #include "Profiler.hpp"
 #include "log_macros.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace arm {
@@ -36,6 +37,10 @@ namespace app {
         }
 
         if (!this->m_started) {
+#if MEMORY_PROFILING
+            /* Before the counters start, so painting is not timed. */
+            memory::PaintStack();
+#endif /* MEMORY_PROFILING */
             hal_pmu_reset();
             this->m_tstampSt.initialised = false;
             hal_pmu_get_counters(&this->m_tstampSt);
@@ -47,6 +52,11 @@ namespace app {
                                     );
                 }
                 this->m_started = true;
+#if MEMORY_PROFILING
+                /* Taken last, so the profiler's own allocations are left out. */
+                this->m_savedHeapPeak = memory::ResetHeapPeak();
+                this->m_heapSt = memory::GetHeapCounters();
+#endif /* MEMORY_PROFILING */
                 return true;
             }
         }
@@ -59,12 +69,20 @@ namespace app {
         if (this->m_started) {
             this->m_tstampEnd.initialised = false;
             hal_pmu_get_counters(&this->m_tstampEnd);
+#if MEMORY_PROFILING
+            const memory::HeapCounters heapEnd = memory::GetHeapCounters();
+            const std::size_t stackHighWater = memory::GetStackHighWater();
+            memory::RestoreHeapPeak(this->m_savedHeapPeak);
+#endif /* MEMORY_PROFILING */
             this->m_started = false;
             if (this->m_tstampEnd.initialised) {
                 this->UpdateRunningStats(
                     this->m_tstampSt,
                     this->m_tstampEnd,
                     this->m_name);
+#if MEMORY_PROFILING
+                this->UpdateMemoryStats(heapEnd, stackHighWater);
+#endif /* MEMORY_PROFILING */
                 return true;
             }
         }
@@ -151,6 +169,38 @@ namespace app {
         this->m_name = std::string(str);
     }
 
+    void Profiler::RecordValue(const char* name, const char* metric, const char* unit,
+                               const uint64_t value)
+    {
+        auto& series = this->m_profStats[name];
+        auto stat = std::find_if(series.begin(), series.end(),
+                                 [metric](const Statistics& s) { return s.name == metric; });
+        if (stat == series.end()) {
+            Statistics newStat{metric, unit, 0, 0.0, value, value, 0};
+            stat = series.insert(series.end(), newStat);
+        }
+
+        ++stat->samplesNum;
+        calcProfilingStat(value, *stat);
+    }
+
+    void Profiler::UpdateMemoryStats(const memory::HeapCounters& heapEnd,
+                                     const std::size_t stackHighWater)
+    {
+        /* Peak is relative to the bytes in use when the region started. */
+        const std::size_t heapPeak = heapEnd.peakBytes - this->m_heapSt.inUseBytes;
+
+        const char* name = this->m_name.c_str();
+        this->RecordValue(name, "Heap allocations", "count",
+                          heapEnd.allocations - this->m_heapSt.allocations);
+        this->RecordValue(name, "Heap allocated", "bytes",
+                          heapEnd.allocatedBytes - this->m_heapSt.allocatedBytes);
+        this->RecordValue(name, "Heap peak", "bytes", heapPeak);
+        if (stackHighWater) {
+            this->RecordValue(name, "Stack high-water", "bytes", stackHighWater);
+        }
+    }
+
     void Profiler::UpdateRunningStats(pmu_counters start, pmu_counters end,
                                       const std::string& name)
     {
@@ -173,7 +223,8 @@ namespace app {
             }
         }
 
-        for (size_t i = 0; i < this->m_profStats[name].size(); ++i) {
+        /* Application defined metrics may follow the counters in the series. */
+        for (size_t i = 0; i < unit.counters.num_counters; ++i) {
             this->m_profStats[name][i].name = unit.counters.counters[i].name;
             this->m_profStats[name][i].unit = unit.counters.counters[i].unit;
             ++this->m_profStats[name][i].samplesNum;
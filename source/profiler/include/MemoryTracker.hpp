@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef APP_MEMORY_TRACKER_HPP
+#define APP_MEMORY_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace memory {
+
+    /** Heap usage counters, maintained by the global operator new and delete. */
+    struct HeapCounters {
+        std::uint64_t allocatedBytes = 0;   /* Total bytes requested. */
+        std::uint32_t allocations = 0;      /* Number of allocations. */
+        std::uint32_t frees = 0;            /* Number of non-null frees. */
+        std::size_t inUseBytes = 0;         /* Bytes currently allocated. */
+        std::size_t peakBytes = 0;          /* Highest inUseBytes since the last peak reset. */
+    };
+
+    /**
+     * @brief   Gets the heap counters. Only C++ allocations are counted and
+     *          all counters stay at zero unless built with MEMORY_PROFILING.
+     *          The counters are not synchronised, so allocations made from
+     *          several threads at once may be miscounted.
+     * @return  Copy of the current counters.
+     **/
+    HeapCounters GetHeapCounters();
+
+    /**
+     * @brief   Starts a new peak measurement from the bytes currently in use.
+     * @return  Peak before the reset, to be given back to RestoreHeapPeak.
+     **/
+    std::size_t ResetHeapPeak();
+
+    /**
+     * @brief       Ends a peak measurement started by ResetHeapPeak, keeping
+     *              the higher of the two peaks.
+     * @param[in]   peak   Value returned by ResetHeapPeak.
+     **/
+    void RestoreHeapPeak(std::size_t peak);
+
+    /**
+     * @brief   Fills the unused part of the main stack, below the caller's
+     *          frame, with a known pattern. Only available on Arm targets
+     *          built with MEMORY_PROFILING; does nothing otherwise, or when
+     *          called from a stack other than the main one (e.g. an RTOS task).
+     * @return  true if the stack was painted.
+     **/
+    bool PaintStack();
+
+    /**
+     * @brief   Finds the deepest point of the main stack overwritten since
+     *          the last PaintStack.
+     * @return  Stack high-water mark in bytes, measured from the top of the
+     *          stack, or 0 if stack painting is not available.
+     **/
+    std::size_t GetStackHighWater();
+
+} /* namespace memory */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* APP_MEMORY_TRACKER_HPP */
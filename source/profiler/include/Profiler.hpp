@@ -18,6 +18,7 @@
 #define APP_PROFILER_HPP
 
 #include "hal.h"
+#include "MemoryTracker.hpp"
 
 #include <string>
 #include <map>
@@ -96,12 +97,25 @@ namespace app {
         /** @brief Set the profiler name. */
         void SetName(const char* str);
 
+        /**
+         * @brief       Adds a sample of an application defined metric, such
+         *              as a hit rate, reported along with the counters. The
+         *              series name must not also be used for StartProfiling.
+         * @param[in]   name     Name of the profiling series.
+         * @param[in]   metric   Name of the metric.
+         * @param[in]   unit     Unit of the metric.
+         * @param[in]   value    Sample value.
+         **/
+        void RecordValue(const char* name, const char* metric, const char* unit, std::uint64_t value);
+
     private:
         ProfilingStats     m_profStats;             /* Profiling stats map. */
         pmu_counters       m_tstampSt{};            /* Container for a current starting timestamp. */
         pmu_counters       m_tstampEnd{};           /* Container for a current ending timestamp. */
         bool               m_started = false;       /* Indicates profiler has been started. */
         std::string        m_name;                  /* Name given to this profiler. */
+        memory::HeapCounters m_heapSt{};            /* Heap counters at the start of the region. */
+        std::size_t        m_savedHeapPeak = 0;     /* Heap peak from before the region started. */
 
 
         /**
@@ -115,6 +129,15 @@ namespace app {
          **/
         void UpdateRunningStats(pmu_counters start, pmu_counters end,
                                 const std::string& name);
+
+        /**
+         * @brief       Adds the heap and stack usage of the region that just
+         *              stopped to the current profiling series. Only used
+         *              when built with MEMORY_PROFILING.
+         * @param[in]   heapEnd          Heap counters at the end of the region.
+         * @param[in]   stackHighWater   Stack high-water mark in bytes, 0 if unknown.
+         **/
+        void UpdateMemoryStats(const memory::HeapCounters& heapEnd, std::size_t stackHighWater);
     };
 
 } /* namespace app */
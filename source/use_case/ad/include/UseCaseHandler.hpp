@@ -28,6 +28,19 @@ namespace app {
      * @return      True or false based on execution success
      **/
     bool ClassifyVibrationHandler(ApplicationContext& ctx, uint32_t dataIndex, bool runAll);
+
+#if AD_LIVE_AUDIO
+    /**
+     * @brief       Monitors live audio, giving a verdict per inference window. The
+     *              score is smoothed and compared against the threshold with
+     *              hysteresis, and monitoring stops early once the verdict is
+     *              confident.
+     * @param[in]   ctx          pointer to the application context
+     * @param[in]   maxWindows   maximum number of windows to run, 0 for no limit
+     * @return      True or false based on execution success
+     **/
+    bool MonitorVibrationHandler(ApplicationContext& ctx, uint32_t maxWindows);
+#endif /* AD_LIVE_AUDIO */
 } /* namespace app */
 } /* namespace arm */
 #endif /* AD_EVT_HANDLER_H */
\ No newline at end of file
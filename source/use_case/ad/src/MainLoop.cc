@@ -37,11 +37,15 @@ enum opcodes
     MENU_OPT_RUN_INF_CHOSEN,         /* Run on a user provided vector index */
     MENU_OPT_RUN_INF_ALL,            /* Run inference on all */
     MENU_OPT_SHOW_MODEL_INFO,        /* Show model info */
-    MENU_OPT_LIST_AUDIO_CLIPS        /* List the current baked audio signals */
+    MENU_OPT_LIST_AUDIO_CLIPS,       /* List the current baked audio signals */
+#if AD_LIVE_AUDIO
+    MENU_OPT_MONITOR_LIVE_AUDIO      /* Monitor audio from the microphone */
+#endif /* AD_LIVE_AUDIO */
 };
 
 static void DisplayMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -49,7 +53,11 @@ static void DisplayMenu()
     printf("  %u. Classify audio signal at chosen index\n", MENU_OPT_RUN_INF_CHOSEN);
     printf("  %u. Run classification on all audio signals\n", MENU_OPT_RUN_INF_ALL);
     printf("  %u. Show NN model info\n", MENU_OPT_SHOW_MODEL_INFO);
-    printf("  %u. List audio signals\n\n", MENU_OPT_LIST_AUDIO_CLIPS);
+    printf("  %u. List audio signals\n", MENU_OPT_LIST_AUDIO_CLIPS);
+#if AD_LIVE_AUDIO
+    printf("  %u. Monitor live audio\n", MENU_OPT_MONITOR_LIVE_AUDIO);
+#endif /* AD_LIVE_AUDIO */
+    printf("\n");
     printf("  Choice: ");
     fflush(stdout);
 }
@@ -78,6 +86,12 @@ void main_loop()
     caseContext.Set<uint32_t>("frameStride", arm::app::ad::g_FrameStride);
     caseContext.Set<float>("scoreThreshold", arm::app::ad::g_ScoreThreshold);
     caseContext.Set<float>("trainingMean", arm::app::ad::g_TrainingMean);
+    caseContext.Set<uint32_t>("audioRate", arm::app::ad::g_AudioRate);
+    caseContext.Set<uint32_t>("machineId", arm::app::ad::g_MachineId);
+    caseContext.Set<float>("scoreHysteresis", arm::app::ad::g_ScoreHysteresis);
+    caseContext.Set<float>("scoreEmaAlpha", arm::app::ad::g_ScoreEmaAlpha);
+    caseContext.Set<uint32_t>("minWindows", arm::app::ad::g_MinWindows);
+    caseContext.Set<float>("confidenceMargin", arm::app::ad::g_ConfidenceMargin);
 
     /* Main program loop. */
     bool executionSuccessful = true;
@@ -121,6 +135,11 @@ void main_loop()
             case MENU_OPT_LIST_AUDIO_CLIPS:
                 executionSuccessful = ListFilesHandler(caseContext);
                 break;
+#if AD_LIVE_AUDIO
+            case MENU_OPT_MONITOR_LIVE_AUDIO:
+                executionSuccessful = MonitorVibrationHandler(caseContext, 0);
+                break;
+#endif /* AD_LIVE_AUDIO */
             default:
                 printf("Incorrect choice, try again.");
                 break;
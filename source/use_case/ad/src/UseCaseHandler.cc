@@ -19,6 +19,7 @@
 #include "AdMelSpectrogram.hpp"
 #include "AdModel.hpp"
 #include "AdProcessing.hpp"
+#include "AdScoreTracker.hpp"
 #include "AudioUtils.hpp"
 #include "Classifier.hpp"
 #include "ImageUtils.hpp"
@@ -27,6 +28,8 @@
 #include "hal.h"
 #include "log_macros.h"
 
+#include <algorithm>
+
 namespace arm {
 namespace app {
 
@@ -47,6 +50,20 @@ namespace app {
      **/
     static int8_t OutputIndexFromFileName(std::string wavFileName);
 
+    /** @brief      Given a machine ID return AD model output index.
+     *  @param[in]  machineIdx  Machine ID, 0, 2, 4 or 6.
+     *  @return     AD model output index as 8 bit integer, -1 if the ID is invalid.
+     **/
+    static int8_t OutputIndexFromMachineId(int machineIdx);
+
+#if AD_LIVE_AUDIO
+    /**
+     * @brief           Presents a change of verdict while monitoring.
+     * @param[in]       tracker     score tracker holding the new verdict
+     **/
+    static void PresentVerdict(const AdScoreTracker& tracker);
+#endif /* AD_LIVE_AUDIO */
+
     /* Anomaly Detection inference handler */
     bool ClassifyVibrationHandler(ApplicationContext& ctx, uint32_t clipIndex, bool runAll)
     {
@@ -96,6 +113,10 @@ namespace app {
                 return false;
             }
 
+            if (!postProcess.SetMonitoredIndex(machineOutputIndex)) {
+                return false;
+            }
+
             /* Creating a sliding window through the whole audio clip. */
             auto audioDataSlider =
                 audio::SlidingWindow<const int16_t>(GetAudioArray(currentIndex),
@@ -104,7 +125,7 @@ namespace app {
                                                     preProcess.GetAudioDataStride());
 
             /* Result is an averaged sum over inferences. */
-            float result = 0;
+            AdScoreTracker tracker{AdScoreTrackerConfig{scoreThreshold}};
 
             /* Display message on the LCD - inference running. */
             std::string str_inf{"Running inference... "};
@@ -132,7 +153,7 @@ namespace app {
                 }
 
                 postProcess.DoPostProcess();
-                result += 0 - postProcess.GetOutputValue(machineOutputIndex);
+                tracker.Update(0 - postProcess.GetOutputValue(machineOutputIndex));
 
 #if VERIFY_TEST_OUTPUT
                 DumpTensor(outputTensor);
@@ -140,7 +161,7 @@ namespace app {
             } /* while (audioDataSlider.HasNext()) */
 
             /* Use average over whole clip as final score. */
-            result /= (audioDataSlider.TotalStrides() + 1);
+            const float result = tracker.GetMeanScore();
 
             /* Erase. */
             str_inf = std::string(str_inf.size(), ' ');
@@ -161,6 +182,174 @@ namespace app {
         return true;
     }
 
+#if AD_LIVE_AUDIO
+    /* Number of capture buffers, each one audio window stride long. */
+    constexpr int AD_AUDIO_BLOCKS = 2;
+
+    bool MonitorVibrationHandler(ApplicationContext& ctx, uint32_t maxWindows)
+    {
+        auto& model = ctx.Get<Model&>("model");
+        if (!model.IsInited()) {
+            printf_err("Model is not initialised! Terminating processing.\n");
+            return false;
+        }
+
+        auto& profiler                = ctx.Get<Profiler&>("profiler");
+        const auto melSpecFrameLength = ctx.Get<uint32_t>("frameLength");
+        const auto melSpecFrameStride = ctx.Get<uint32_t>("frameStride");
+        const auto trainingMean       = ctx.Get<float>("trainingMean");
+        const auto audioRate          = ctx.Get<uint32_t>("audioRate");
+
+        AdScoreTrackerConfig trackerConfig;
+        trackerConfig.threshold        = ctx.Get<float>("scoreThreshold");
+        trackerConfig.hysteresis       = ctx.Get<float>("scoreHysteresis");
+        trackerConfig.emaAlpha         = ctx.Get<float>("scoreEmaAlpha");
+        trackerConfig.minWindows       = ctx.Get<uint32_t>("minWindows");
+        trackerConfig.confidenceMargin = ctx.Get<float>("confidenceMargin");
+
+        const int8_t machineOutputIndex = OutputIndexFromMachineId(ctx.Get<uint32_t>("machineId"));
+        if (machineOutputIndex == -1) {
+            return false;
+        }
+
+        TfLiteTensor* outputTensor = model.GetOutputTensor(0);
+        TfLiteTensor* inputTensor  = model.GetInputTensor(0);
+
+        if (!inputTensor->dims) {
+            printf_err("Invalid input tensor dims\n");
+            return false;
+        }
+
+        AdPreProcess preProcess{inputTensor, melSpecFrameLength, melSpecFrameStride, trainingMean};
+        AdPostProcess postProcess{outputTensor};
+        if (!postProcess.SetMonitoredIndex(machineOutputIndex)) {
+            return false;
+        }
+        AdScoreTracker tracker{trackerConfig};
+
+        const uint32_t windowSize = preProcess.GetAudioWindowSize();
+        const uint32_t stride     = preProcess.GetAudioDataStride();
+        std::vector<int16_t> audioWindow(windowSize);
+        std::vector<int16_t> blockStorage(AD_AUDIO_BLOCKS * stride);
+        int16_t* audioBlocks[AD_AUDIO_BLOCKS];
+        for (int i = 0; i < AD_AUDIO_BLOCKS; ++i) {
+            audioBlocks[i] = &blockStorage[i * stride];
+        }
+
+        static bool audioInited;
+        if (!audioInited) {
+            int err = hal_audio_init(audioRate, 32);
+            if (err) {
+                printf_err("hal_audio_init failed with error: %d\n", err);
+                return false;
+            }
+            audioInited = true;
+        }
+
+        /* Capture runs continuously, one stride per block, from here on. */
+        int err = hal_audio_stream_start(audioBlocks, AD_AUDIO_BLOCKS, stride, nullptr, nullptr);
+        if (err) {
+            printf_err("hal_audio_stream_start failed with error: %d\n", err);
+            return false;
+        }
+        struct AudioStreamGuard {
+            ~AudioStreamGuard() { hal_audio_stream_stop(); }
+        } audioStreamGuard;
+
+        info("Monitoring machine output %d, threshold %f\n", machineOutputIndex, trackerConfig.threshold);
+
+        uint32_t filled = 0;        /* Valid samples in the window. */
+        uint32_t windowIndex = 0;   /* Windows since the feature cache was last valid. */
+        uint32_t nextSeq = 0;
+        uint32_t overflows = 0;
+
+        while (maxWindows == 0 || tracker.GetWindowCount() < maxWindows) {
+            audio_block_t block;
+            err = hal_audio_stream_wait_block(&block);
+            if (err) {
+                printf_err("hal_audio_stream_wait_block failed with error: %d\n", err);
+                return false;
+            }
+
+            /* Dropped strides leave a gap: start filling a fresh window. */
+            if (block.seq != nextSeq) {
+                const uint32_t newOverflows = hal_audio_stream_get_overflows();
+                warn("%" PRIu32 " audio strides dropped, processing is falling behind\n",
+                     newOverflows - overflows);
+                overflows = newOverflows;
+                filled = 0;
+                windowIndex = 0;
+            }
+            nextSeq = block.seq + 1;
+
+            /* Move the window down by one stride and append the new stride. */
+            int16_t* newStride = audioWindow.data() + windowSize - stride;
+            std::copy(audioWindow.begin() + stride, audioWindow.end(), audioWindow.begin());
+            std::copy(block.data, block.data + stride, newStride);
+            hal_audio_stream_release_block(&block);
+            hal_audio_preprocessing(newStride, stride);
+
+            filled = std::min(filled + stride, windowSize);
+            if (filled < windowSize) {
+                continue;
+            }
+
+            preProcess.SetAudioWindowIndex(windowIndex++);
+            if (!preProcess.DoPreProcess(audioWindow.data(), windowSize)) {
+                printf_err("Pre-processing failed.\n");
+                return false;
+            }
+
+            if (!RunInference(model, profiler)) {
+                return false;
+            }
+
+            if (!postProcess.DoPostProcess()) {
+                printf_err("Post-processing failed.\n");
+                return false;
+            }
+
+            const float score = 0 - postProcess.GetOutputValue(machineOutputIndex);
+            const AdVerdict verdict = tracker.Update(score);
+            info("Window %" PRIu32 ": score %f, smoothed %f => %s\n",
+                 tracker.GetWindowCount(), score, tracker.GetScore(), AdVerdictName(verdict));
+
+            if (tracker.VerdictChanged()) {
+                PresentVerdict(tracker);
+            }
+
+            if (tracker.IsConfident()) {
+                info("Confident %s verdict after %" PRIu32 " windows, stopping\n",
+                     AdVerdictName(verdict), tracker.GetWindowCount());
+                break;
+            }
+        }
+
+        profiler.PrintProfilingResult();
+        return true;
+    }
+
+    static void PresentVerdict(const AdScoreTracker& tracker)
+    {
+        constexpr uint32_t dataPsnTxtStartX1 = 20;
+        constexpr uint32_t dataPsnTxtStartY1 = 30;
+        constexpr uint32_t dataPsnTxtYIncr   = 16; /* Row index increment */
+
+        const bool anomaly = tracker.GetVerdict() == AdVerdict::Anomaly;
+        std::string verdictStr = anomaly ? "Anomaly detected!" :
+                                           "Everything fine, no anomaly detected!";
+        /* Pad to overwrite a longer previous verdict. */
+        verdictStr.resize(40, ' ');
+
+        hal_lcd_set_text_color(anomaly ? COLOR_YELLOW : COLOR_GREEN);
+        hal_lcd_display_text(verdictStr.c_str(), verdictStr.size(),
+                             dataPsnTxtStartX1, dataPsnTxtStartY1 + 2 * dataPsnTxtYIncr, false);
+        hal_lcd_set_text_color(COLOR_GREEN);
+
+        info("Verdict changed to %s (score %f)\n", AdVerdictName(tracker.GetVerdict()), tracker.GetScore());
+    }
+#endif /* AD_LIVE_AUDIO */
+
     static bool PresentInferenceResult(float result, float threshold)
     {
         constexpr uint32_t dataPsnTxtStartX1 = 20;
@@ -224,6 +413,11 @@ namespace app {
 
         const int8_t machineIdx = is_number(subString) ? std::stoi(subString) : -1;
 
+        return OutputIndexFromMachineId(machineIdx);
+    }
+
+    static int8_t OutputIndexFromMachineId(int machineIdx)
+    {
         /* Return corresponding index in the output vector. */
         if (machineIdx == 0) {
             return 0;
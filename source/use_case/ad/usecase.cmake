@@ -49,6 +49,34 @@ USER_OPTION(${use_case}_MODEL_SCORE_THRESHOLD "Specify the score threshold for a
     -0.8
     STRING)
 
+USER_OPTION(${use_case}_MACHINE_ID "Specify the machine ID (0, 2, 4 or 6) monitored on live audio."
+    0
+    STRING)
+
+USER_OPTION(${use_case}_SCORE_HYSTERESIS "Specify how far the smoothed live score must cross the threshold to change the verdict."
+    0.05
+    STRING)
+
+USER_OPTION(${use_case}_SCORE_EMA_ALPHA "Specify the weight of each new window in the live score average. 0 averages over all windows."
+    0.2
+    STRING)
+
+USER_OPTION(${use_case}_MIN_WINDOWS "Specify the number of live audio windows needed before a verdict."
+    3
+    STRING)
+
+USER_OPTION(${use_case}_CONFIDENCE_MARGIN "Specify the distance from the threshold at which live monitoring stops early. A negative value disables early exit."
+    0.15
+    STRING)
+
+# Live monitoring needs an audio stream, which only the Ensemble microphone
+# and the native WAV replay stubs provide:
+if (TARGET_PLATFORM STREQUAL ensemble OR TARGET_PLATFORM STREQUAL native)
+    list(APPEND ${use_case}_COMPILE_DEFS AD_LIVE_AUDIO=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS AD_LIVE_AUDIO=0)
+endif()
+
 generate_audio_code(${${use_case}_FILE_PATH} ${SRC_GEN_DIR} ${INC_GEN_DIR}
         ${${use_case}_AUDIO_RATE}
         ${${use_case}_AUDIO_MONO}
@@ -73,6 +101,12 @@ set(EXTRA_MODEL_CODE
     "extern const int       g_FrameStride = 512"
     "extern const float     g_ScoreThreshold = ${${use_case}_MODEL_SCORE_THRESHOLD}"
     "extern const float     g_TrainingMean = -30"
+    "extern const int       g_AudioRate = ${${use_case}_AUDIO_RATE}"
+    "extern const int       g_MachineId = ${${use_case}_MACHINE_ID}"
+    "extern const float     g_ScoreHysteresis = ${${use_case}_SCORE_HYSTERESIS}"
+    "extern const float     g_ScoreEmaAlpha = ${${use_case}_SCORE_EMA_ALPHA}"
+    "extern const int       g_MinWindows = ${${use_case}_MIN_WINDOWS}"
+    "extern const float     g_ConfidenceMargin = ${${use_case}_CONFIDENCE_MARGIN}"
     )
 
 USER_OPTION(${use_case}_MODEL_TFLITE_PATH "NN models file to be used in the evaluation application. Model files must be in tflite format."
@@ -33,6 +33,8 @@
 #include "UseCaseHandler.hpp"       /* Handlers for different user options. */
 #include "UseCaseCommonUtils.hpp"   /* Utils functions. */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
+#include "ChangeDetector.hpp"       /* Skipping inference on unchanged frames. */
+#include "log_macros.h"             /* Logging functions */
 
 namespace arm {
 namespace app {
@@ -58,6 +60,10 @@ void main_loop()
 
 #if !SKIP_MODEL
     /* Load the model. */
+    arm::app::RegisterModelBuffers(arm::app::tensorArena,
+                                   sizeof(arm::app::tensorArena),
+                                   arm::app::img_class::GetModelPointer(),
+                                   arm::app::img_class::GetModelLen());
     if (!model.Init(arm::app::tensorArena,
                     sizeof(arm::app::tensorArena),
                     arm::app::img_class::GetModelPointer(),
@@ -77,12 +83,24 @@ void main_loop()
     ImgClassClassifier classifier;  /* Classifier wrapper object. */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector<std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
+
+#if CHANGE_DETECTION_ENABLED && !SKIP_MODEL
+    /* Reuse the last result while the camera scene does not change. */
+    TfLiteIntArray* inputShape = model.GetInputShape(0);
+    arm::app::image::ChangeDetectorParams changeParams;
+    changeParams.blockThreshold = CHANGE_DETECTION_THRESHOLD;
+    changeParams.refreshInterval = CHANGE_DETECTION_REFRESH_INTERVAL;
+    arm::app::image::ChangeDetector changeDetector(
+        inputShape->data[arm::app::MobileNetModel::ms_inputColsIdx],
+        inputShape->data[arm::app::MobileNetModel::ms_inputRowsIdx],
+        3, changeParams);
+    caseContext.Set<arm::app::image::ChangeDetector&>("changeDetector", changeDetector);
+#endif /* CHANGE_DETECTION_ENABLED && !SKIP_MODEL */
 
     /* Loop. */
     do {
         alif::app::ClassifyImageHandler(caseContext);
+        log_flush();
     } while (1);
 }
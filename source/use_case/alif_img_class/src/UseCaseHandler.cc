@@ -28,6 +28,7 @@
  */
 #include "UseCaseHandler.hpp"
 
+#include "ChangeDetector.hpp"
 #include "Classifier.hpp"
 #include "InputFiles.hpp"
 #include "MobileNetModel.hpp"
@@ -40,6 +41,7 @@
 
 
 #include <cinttypes>
+#include <cstring>
 
 #include "lvgl.h"
 #include "lv_port.h"
@@ -78,10 +80,10 @@ namespace app {
 
     using namespace arm::app;
 
-    static std::string first_bit(const std::string &s)
+    static std::string first_bit(const LabelView &s)
     {
-        std::string::size_type comma = s.find_first_of(',');
-        return s.substr(0, comma);
+        const char* comma = static_cast<const char*>(std::memchr(s.data(), ',', s.size()));
+        return std::string(s.data(), comma ? static_cast<size_t>(comma - s.data()) : s.size());
     }
 
     bool ClassifyImageInit()
@@ -133,7 +135,7 @@ namespace app {
 
         std::vector<ClassificationResult> results;
         ImgClassPostProcess postProcess = ImgClassPostProcess(outputTensor,
-                ctx.Get<ImgClassClassifier&>("classifier"), ctx.Get<std::vector<std::string>&>("labels"),
+                ctx.Get<ImgClassClassifier&>("classifier"), ctx.Get<LabelTable>("labels"),
                 results);
 #endif
 
@@ -174,6 +176,20 @@ namespace app {
         lv_led_on(ScreenLayoutLEDObject());
 
 #if !SKIP_MODEL
+        if (ctx.Has("changeDetector")) {
+            auto& changeDetector = ctx.Get<image::ChangeDetector&>("changeDetector");
+            profiler.StartProfiling("Change detection");
+            const bool changed = changeDetector.HasChanged(image_data) || !ctx.Has("results");
+            profiler.StopProfiling();
+
+            /* Average of this series is the share of frames inference ran on. */
+            profiler.RecordValue("Change detector", "Inferences", "%", changed ? 100 : 0);
+            if (!changed) {
+                /* Scene unchanged, the labels on screen still hold. */
+                return true;
+            }
+        }
+
         const size_t imgSz = inputTensor->bytes;
 
         /* Run the pre-processing, inference and post-processing. */
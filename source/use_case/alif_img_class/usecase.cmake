@@ -29,6 +29,27 @@ list(APPEND ${use_case}_API_LIST "img_class" "alif_ui")
 
 set(${use_case}_COMPILE_DEFS SHOW_PROFILING=0 SKIP_MODEL=0)
 
+USER_OPTION(${use_case}_CHANGE_DETECTION_ENABLED "Skip inference and reuse the last result while the input image does not change."
+    ON
+    BOOL)
+
+USER_OPTION(${use_case}_CHANGE_DETECTION_THRESHOLD "Mean absolute pixel difference at which a block of the sub-sampled frame counts as changed."
+    12
+    STRING)
+
+USER_OPTION(${use_case}_CHANGE_DETECTION_REFRESH_INTERVAL "Run inference at least every N frames even if nothing changed, 0 for never."
+    30
+    STRING)
+
+if (${use_case}_CHANGE_DETECTION_ENABLED)
+    list(APPEND ${use_case}_COMPILE_DEFS CHANGE_DETECTION_ENABLED=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS CHANGE_DETECTION_ENABLED=0)
+endif()
+list(APPEND ${use_case}_COMPILE_DEFS
+    CHANGE_DETECTION_THRESHOLD=${${use_case}_CHANGE_DETECTION_THRESHOLD}
+    CHANGE_DETECTION_REFRESH_INTERVAL=${${use_case}_CHANGE_DETECTION_REFRESH_INTERVAL})
+
 USER_OPTION(${use_case}_LABELS_TXT_FILE "Labels' txt file for the chosen model"
     ${CMAKE_CURRENT_SOURCE_DIR}/resources/img_class/labels/labels_mobilenet_v2_1.0_224.txt
     FILEPATH)
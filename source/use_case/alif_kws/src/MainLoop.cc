@@ -35,6 +35,7 @@
 #include "UseCaseCommonUtils.hpp"   /* Utils functions. */
 #include "log_macros.h"             /* Logging functions */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
+#include "VoiceActivityDetector.hpp" /* Voice activity gate. */
 
 namespace arm {
 namespace app {
@@ -43,6 +44,8 @@ namespace app {
         extern uint8_t* GetModelPointer();
         extern size_t GetModelLen();
         extern const int g_AudioRate;
+        extern const float g_VadThresholdDb;
+        extern const int g_VadHangover;
     } /* namespace kws */
 } /* namespace app */
 } /* namespace arm */
@@ -52,12 +55,15 @@ void main_loop()
     init_trigger_tx();
 
     arm::app::MicroNetKwsModel model;  /* Model wrapper object. */
+    arm::app::Profiler profiler{"kws"};
 
     /* Load the model. */
-    if (!model.Init(arm::app::tensorArena,
-                    sizeof(arm::app::tensorArena),
-                    arm::app::kws::GetModelPointer(),
-                    arm::app::kws::GetModelLen())) {
+    if (!arm::app::BootModel(model, profiler,
+                             arm::app::tensorArena,
+                             sizeof(arm::app::tensorArena),
+                             arm::app::kws::GetModelPointer(),
+                             arm::app::kws::GetModelLen(),
+                             FAST_BOOT_ENABLED, WARM_UP_ENABLED)) {
         printf_err("Failed to initialise model\n");
         return;
     }
@@ -65,7 +71,6 @@ void main_loop()
     /* Instantiate application context. */
     arm::app::ApplicationContext caseContext;
 
-    arm::app::Profiler profiler{"kws"};
     caseContext.Set<arm::app::Profiler&>("profiler", profiler);
     caseContext.Set<arm::app::Model&>("model", model);
     caseContext.Set<int>("frameLength", arm::app::kws::g_FrameLength);
@@ -76,10 +81,14 @@ void main_loop()
     arm::app::KwsClassifier classifier;  /* classifier wrapper object. */
     caseContext.Set<arm::app::KwsClassifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+#if VAD_ENABLED
+    /* Voice activity detector gating feature extraction and inference. */
+    arm::app::audio::EnergyVad vad{arm::app::kws::g_VadThresholdDb, -70.f,
+                                   static_cast<uint32_t>(arm::app::kws::g_VadHangover)};
+    caseContext.Set<arm::app::audio::VoiceActivityDetector&>("vad", vad);
+#endif /* VAD_ENABLED */
 
     bool executionSuccessful = true;
 
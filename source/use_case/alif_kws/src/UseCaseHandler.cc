@@ -37,6 +37,7 @@
 #include "KwsResult.hpp"
 #include "log_macros.h"
 #include "KwsProcessing.hpp"
+#include "VoiceActivityDetector.hpp"
 #include "services_lib_api.h"
 #include "services_main.h"
 
@@ -52,13 +53,17 @@ using arm::app::ApplicationContext;
 using arm::app::Model;
 using arm::app::KwsPreProcess;
 using arm::app::KwsPostProcess;
+using arm::app::LabelTable;
 using arm::app::MicroNetKwsModel;
+using arm::app::audio::VoiceActivityDetector;
 
 #define AUDIO_SAMPLES 16000 // 16k samples/sec, 1sec sample
 #define AUDIO_STRIDE 8000 // 0.5 seconds
+#define AUDIO_BLOCKS 2 // capture one stride while processing the previous one
 #define RESULTS_MEMORY 8
 
-static int16_t audio_inf[AUDIO_SAMPLES + AUDIO_STRIDE];
+static int16_t audio_inf[AUDIO_SAMPLES];
+static int16_t audio_blocks[AUDIO_BLOCKS][AUDIO_STRIDE];
 
 namespace alif {
 namespace app {
@@ -78,13 +83,13 @@ using namespace arm::app::kws;
  **/
 static bool PresentInferenceResult(const std::vector<arm::app::kws::KwsResult>& results);
 
-static std::string last_label;
+static arm::app::LabelView last_label;
 
 static void send_msg_if_needed(arm::app::kws::KwsResult &result)
 {
     mhu_data.id = 2; // id for M55_HE
     if (result.m_resultVec.empty()) {
-        last_label.clear();
+        last_label = {};
         return;
     }
 
@@ -144,12 +149,19 @@ static void send_msg_if_needed(arm::app::kws::KwsResult &result)
         /* Set up pre and post-processing. */
         KwsPreProcess preProcess = KwsPreProcess(inputTensor, numMfccFeatures, numMfccFrames,
                                                  mfccFrameLength, mfccFrameStride);
+        if (FIXED_POINT_FEATURES && !preProcess.UseFixedPointFeatures(true)) {
+            return false;
+        }
 
         std::vector<ClassificationResult> singleInfResult;
         KwsPostProcess postProcess = KwsPostProcess(outputTensor, ctx.Get<KwsClassifier &>("classifier"),
-                                                    ctx.Get<std::vector<std::string>&>("labels"),
+                                                    ctx.Get<LabelTable>("labels"),
                                                     singleInfResult);
 
+        /* Optional voice activity gate; when absent every stride is processed. */
+        VoiceActivityDetector* vad = ctx.Has("vad") ? &ctx.Get<VoiceActivityDetector&>("vad") : nullptr;
+        uint32_t skippedStrides = 0;
+
         int index = 0;
         std::vector<kws::KwsResult> infResults;
         static bool audio_inited;
@@ -162,25 +174,61 @@ static void send_msg_if_needed(arm::app::kws::KwsResult &result)
             audio_inited = true;
         }
 
-        // Start first fill of final stride section of buffer
-        hal_get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+        // Capture runs continuously into the stride buffers from here on
+        int16_t* const audioBlocks[AUDIO_BLOCKS] = {audio_blocks[0], audio_blocks[1]};
+        int err = hal_audio_stream_start(audioBlocks, AUDIO_BLOCKS, AUDIO_STRIDE, nullptr, nullptr);
+        if (err) {
+            printf_err("hal_audio_stream_start failed with error: %d\n", err);
+            return false;
+        }
+        struct AudioStreamGuard {
+            ~AudioStreamGuard() { hal_audio_stream_stop(); }
+        } audioStreamGuard;
+
+        uint32_t overflows = 0;
+        uint32_t nextSeq = 0;
 
         do {
-            // Wait until stride buffer is full - initiated above or by previous interation of loop
-            int err = hal_wait_for_audio();
+            // Print any deferred log messages while the next stride is still arriving
+            log_flush();
+
+            // Wait for the next stride; the following one is already being captured
+            audio_block_t block;
+            err = hal_audio_stream_wait_block(&block);
             if (err) {
-                printf_err("hal_get_audio_data failed with error: %d\n", err);
+                printf_err("hal_audio_stream_wait_block failed with error: %d\n", err);
                 return false;
             }
 
-            // move buffer down by one stride, clearing space at the end for the next stride
-            std::copy(audio_inf + AUDIO_STRIDE, audio_inf + AUDIO_STRIDE + AUDIO_SAMPLES, audio_inf);
+            /* Strides dropped while we were busy leave a gap the cached features don't cover. */
+            if (block.seq != nextSeq) {
+                const uint32_t newOverflows = hal_audio_stream_get_overflows();
+                warn("%" PRIu32 " audio strides dropped, processing is falling behind\n",
+                     newOverflows - overflows);
+                overflows = newOverflows;
+                preProcess.InvalidateFeatureCache();
+            }
+            nextSeq = block.seq + 1;
+            index = block.seq;
 
-            // start receiving the next stride immediately before we start heavy processing, so as not to lose anything
-            hal_get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+            // move buffer down by one stride and append the new stride
+            std::copy(audio_inf + AUDIO_STRIDE, audio_inf + AUDIO_SAMPLES, audio_inf);
+            std::copy(block.data, block.data + AUDIO_STRIDE, audio_inf + AUDIO_SAMPLES - AUDIO_STRIDE);
+            hal_audio_stream_release_block(&block);
 
             hal_audio_preprocessing(audio_inf + AUDIO_SAMPLES - AUDIO_STRIDE, AUDIO_STRIDE);
 
+            /* Skip feature extraction and inference if the new stride is silent. The cached
+             * features won't line up with the next processed window, so drop them. */
+            if (vad && !vad->IsVoiceActive(audio_inf + AUDIO_SAMPLES - AUDIO_STRIDE, AUDIO_STRIDE,
+                                           hal_audio_get_gain())) {
+                preProcess.InvalidateFeatureCache();
+                last_label = {};
+                ++skippedStrides;
+                debug("No voice activity, stride skipped (%" PRIu32 "/%d)\n", skippedStrides, index);
+                continue;
+            }
+
             const int16_t* inferenceWindow = audio_inf;
 
             uint32_t start = ARM_PMU_Get_CCNTR();
@@ -189,21 +237,21 @@ static void send_msg_if_needed(arm::app::kws::KwsResult &result)
                 printf_err("Pre-processing failed.");
                 return false;
             }
-            printf("Preprocessing time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
+            info("Preprocessing time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
 
             start = ARM_PMU_Get_CCNTR();
             if (!RunInference(model, profiler)) {
                 printf_err("Inference failed.");
                 return false;
             }
-            printf("Inference time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
+            info("Inference time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
 
             start = ARM_PMU_Get_CCNTR();
             if (!postProcess.DoPostProcess()) {
                 printf_err("Post-processing failed.");
                 return false;
             }
-            printf("Postprocessing time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
+            info("Postprocessing time = %.3f ms\n", (double) (ARM_PMU_Get_CCNTR() - start) / SystemCoreClock * 1000);
 
             /* Add results from this window to our final results vector. */
             if (infResults.size() == RESULTS_MEMORY) {
@@ -227,8 +275,6 @@ static void send_msg_if_needed(arm::app::kws::KwsResult &result)
 
             profiler.PrintProfilingResult();
 
-            ++index;
-
         } while (true);
     }
 
@@ -250,7 +296,7 @@ static void send_msg_if_needed(arm::app::kws::KwsResult &result)
             std::string topKeyword{"<none>"};
             float score = 0.f;
             if (!result.m_resultVec.empty()) {
-                topKeyword = result.m_resultVec[0].m_label;
+                topKeyword = result.m_resultVec[0].m_label.ToString();
                 score = result.m_resultVec[0].m_normalisedVal;
             }
 
@@ -39,6 +39,54 @@ USER_OPTION(${use_case}_MODEL_SCORE_THRESHOLD "Specify the score threshold [0.0,
     0.5
     STRING)
 
+USER_OPTION(${use_case}_VAD_ENABLED "Skip feature extraction and inference on audio strides without voice activity."
+    OFF
+    BOOL)
+
+USER_OPTION(${use_case}_VAD_THRESHOLD_DB "Level above the tracked noise floor (in dB) at which the voice activity detector triggers."
+    9.0
+    STRING)
+
+USER_OPTION(${use_case}_VAD_HANGOVER "Number of audio strides to keep processing after voice activity stops."
+    2
+    STRING)
+
+USER_OPTION(${use_case}_FAST_BOOT_ENABLED "Skip clearing the model tensors and logging the model details at boot."
+    OFF
+    BOOL)
+
+USER_OPTION(${use_case}_WARM_UP_ENABLED "Run a warm-up inference at boot, and report the time to first inference."
+    OFF
+    BOOL)
+
+USER_OPTION(${use_case}_FIXED_POINT_FEATURES "Extract the MFCC features with integer only arithmetic."
+    OFF
+    BOOL)
+
+if (${use_case}_VAD_ENABLED)
+    set(${use_case}_COMPILE_DEFS VAD_ENABLED=1)
+else()
+    set(${use_case}_COMPILE_DEFS VAD_ENABLED=0)
+endif()
+
+if (${use_case}_FAST_BOOT_ENABLED)
+    list(APPEND ${use_case}_COMPILE_DEFS FAST_BOOT_ENABLED=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS FAST_BOOT_ENABLED=0)
+endif()
+
+if (${use_case}_WARM_UP_ENABLED)
+    list(APPEND ${use_case}_COMPILE_DEFS WARM_UP_ENABLED=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS WARM_UP_ENABLED=0)
+endif()
+
+if (${use_case}_FIXED_POINT_FEATURES)
+    list(APPEND ${use_case}_COMPILE_DEFS FIXED_POINT_FEATURES=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS FIXED_POINT_FEATURES=0)
+endif()
+
 # Generate labels file
 set(${use_case}_LABELS_CPP_FILE Labels)
 generate_labels_code(
@@ -65,6 +113,8 @@ set(EXTRA_MODEL_CODE
     "extern const int   g_FrameStride    = 320"
     "extern const int   g_AudioRate      = ${${use_case}_AUDIO_RATE}"
     "extern const float g_ScoreThreshold = ${${use_case}_MODEL_SCORE_THRESHOLD}"
+    "extern const float g_VadThresholdDb = ${${use_case}_VAD_THRESHOLD_DB}"
+    "extern const int   g_VadHangover    = ${${use_case}_VAD_HANGOVER}"
     )
 
 USER_OPTION(${use_case}_MODEL_TFLITE_PATH "NN models file to be used in the evaluation application. Model files must be in tflite format."
@@ -29,6 +29,7 @@
 #include "hal.h"                      /* Brings in platform definitions. */
 #include "InputFiles.hpp"             /* For input images. */
 #include "YoloFastestModel.hpp"       /* Model class for running inference. */
+#include "DetectionTracker.hpp"       /* Tracker between detector keyframes. */
 #include "UseCaseHandler.hpp"         /* Handlers for different user options. */
 #include "UseCaseCommonUtils.hpp"     /* Utils functions. */
 #include "log_macros.h"             /* Logging functions */
@@ -55,6 +56,10 @@ void main_loop()
     }
 
     /* Load the model. */
+    arm::app::RegisterModelBuffers(arm::app::tensorArena,
+                                   sizeof(arm::app::tensorArena),
+                                   arm::app::object_detection::GetModelPointer(),
+                                   arm::app::object_detection::GetModelLen());
     if (!model.Init(arm::app::tensorArena,
                     sizeof(arm::app::tensorArena),
                     arm::app::object_detection::GetModelPointer(),
@@ -70,8 +75,17 @@ void main_loop()
     caseContext.Set<arm::app::Profiler&>("profiler", profiler);
     caseContext.Set<arm::app::Model&>("model", model);
 
+#if TRACKER_KEYFRAME_INTERVAL > 1
+    /* Track detections so the detector only runs on keyframes. */
+    arm::app::object_detection::TrackerParams trackerParams;
+    trackerParams.keyframeInterval = TRACKER_KEYFRAME_INTERVAL;
+    arm::app::object_detection::DetectionTracker tracker(trackerParams);
+    caseContext.Set<arm::app::object_detection::DetectionTracker&>("tracker", tracker);
+#endif /* TRACKER_KEYFRAME_INTERVAL > 1 */
+
     /* Loop. */
     do {
         alif::app::ObjectDetectionHandler(caseContext);
+        log_flush();
     } while (1);
 }
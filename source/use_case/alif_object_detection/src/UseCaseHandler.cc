@@ -29,6 +29,7 @@
 #include "UseCaseHandler.hpp"
 #include "YoloFastestModel.hpp"
 #include "UseCaseCommonUtils.hpp"
+#include "DetectionTracker.hpp"
 #include "DetectorPostProcessing.hpp"
 #include "DetectorPreProcessing.hpp"
 #include "ScreenLayout.hpp"
@@ -148,6 +149,10 @@ using namespace arm::app::object_detection;
         DetectorPostProcess postProcess = DetectorPostProcess(outputTensor0, outputTensor1,
                 results, postProcessParams);
 
+        /* Optional tracker, kept across camera frames; when present the detector only runs on keyframes. */
+        object_detection::DetectionTracker* tracker = ctx.Has("tracker") ?
+            &ctx.Get<object_detection::DetectionTracker&>("tracker") : nullptr;
+
         /* Ensure there are no results leftover from previous inference when running all. */
         results.clear();
 
@@ -172,29 +177,57 @@ using namespace arm::app::object_detection;
 
             if (!run_requested()) {
                lv_led_off(ScreenLayoutLEDObject());
+
+               /* Tracks go stale while paused; start again from a keyframe. */
+               if (tracker) {
+                   tracker->Reset();
+               }
                return false;
             }
 
             lv_led_on(ScreenLayoutLEDObject());
 
-            const size_t copySz = inputTensor->bytes;
+            /* Decided before pre-processing, which is skipped along with the detector. */
+            const bool keyframe = !tracker || tracker->NeedsDetection();
+            if (keyframe) {
+                const size_t copySz = inputTensor->bytes;
 
-            /* Run the pre-processing, inference and post-processing. */
-            if (!preProcess.DoPreProcess(currImage, copySz)) {
-                printf_err("Pre-processing failed.");
-                return false;
-            }
+                /* Run the pre-processing, inference and post-processing. */
+                if (!preProcess.DoPreProcess(currImage, copySz)) {
+                    printf_err("Pre-processing failed.");
+                    return false;
+                }
+
+                /* Run inference over this image. */
 
-            /* Run inference over this image. */
+                if (!RunInference(model, profiler)) {
+                    printf_err("Inference failed.");
+                    return false;
+                }
 
-            if (!RunInference(model, profiler)) {
-                printf_err("Inference failed.");
-                return false;
+                if (!postProcess.DoPostProcess()) {
+                    printf_err("Post-processing failed.");
+                    return false;
+                }
             }
 
-            if (!postProcess.DoPostProcess()) {
-                printf_err("Post-processing failed.");
-                return false;
+            if (tracker) {
+                profiler.StartProfiling("Tracking");
+                if (keyframe) {
+                    tracker->Update(results);
+                } else {
+                    tracker->Predict(results);
+                }
+                profiler.StopProfiling();
+
+                /* Printing the profiling results resets them, so the counts since the
+                 * tracker was reset are recorded rather than one sample per frame. The
+                 * effective frame rate is relative to running the detector on every frame. */
+                const uint64_t frames = tracker->GetFrameCount();
+                const uint64_t keyframes = tracker->GetKeyframeCount();
+                profiler.RecordValue("Tracker", "Keyframes", "%", 100 * keyframes / frames);
+                profiler.RecordValue("Tracker", "Effective frame rate", "% of detector",
+                                     100 * frames / keyframes);
             }
 
             lv_label_set_text_fmt(ScreenLayoutLabelObject(2), "%i", results.size());
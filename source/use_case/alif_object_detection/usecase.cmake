@@ -39,6 +39,12 @@ USER_OPTION(${use_case}_ANCHOR_2 "Second anchor array estimated during training.
     "{14, 26, 19, 37, 28, 55 }"
     STRING)
 
+USER_OPTION(${use_case}_TRACKER_KEYFRAME_INTERVAL "Run the detector at least every N camera frames and track detections in between. 1 runs it on every frame."
+    1
+    STRING)
+
+list(APPEND ${use_case}_COMPILE_DEFS TRACKER_KEYFRAME_INTERVAL=${${use_case}_TRACKER_KEYFRAME_INTERVAL})
+
 USER_OPTION(${use_case}_ACTIVATION_BUF_SZ "Activation buffer size for the chosen model"
     0x00082000
     STRING)
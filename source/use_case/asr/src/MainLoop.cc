@@ -18,7 +18,6 @@
 #include "UseCaseHandler.hpp"        /* Handlers for different user options. */
 #include "Wav2LetterModel.hpp"       /* Model class for running inference. */
 #include "UseCaseCommonUtils.hpp"    /* Utils functions. */
-#include "AsrClassifier.hpp"         /* Classifier. */
 #include "InputFiles.hpp"            /* Generated audio clip header. */
 #include "log_macros.h"             /* Logging functions */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
@@ -44,6 +43,7 @@ enum opcodes
 
 static void DisplayMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -77,9 +77,6 @@ void main_loop()
 
     /* Instantiate application context. */
     arm::app::ApplicationContext caseContext;
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-    arm::app::AsrClassifier classifier;  /* Classifier wrapper object. */
 
     arm::app::Profiler profiler{"asr"};
     caseContext.Set<arm::app::Profiler&>("profiler", profiler);
@@ -89,8 +86,7 @@ void main_loop()
     caseContext.Set<uint32_t>("frameStride", arm::app::asr::g_FrameStride);
     caseContext.Set<float>("scoreThreshold", arm::app::asr::g_ScoreThreshold);  /* Score threshold. */
     caseContext.Set<uint32_t>("ctxLen", arm::app::asr::g_ctxLen);  /* Left and right context length (MFCC feat vectors). */
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
-    caseContext.Set<arm::app::AsrClassifier&>("classifier", classifier);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
     bool executionSuccessful = true;
     constexpr bool bUseMenu = NUMBER_OF_FILES > 1 ? true : false;
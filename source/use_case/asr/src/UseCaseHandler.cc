@@ -16,12 +16,11 @@
  */
 #include "UseCaseHandler.hpp"
 
-#include "AsrClassifier.hpp"
 #include "AsrResult.hpp"
 #include "AudioUtils.hpp"
+#include "CtcGreedyDecoder.hpp"
 #include "ImageUtils.hpp"
 #include "InputFiles.hpp"
-#include "OutputDecode.hpp"
 #include "UseCaseCommonUtils.hpp"
 #include "Wav2LetterModel.hpp"
 #include "Wav2LetterPostprocess.hpp"
@@ -34,10 +33,10 @@ namespace app {
 
     /**
      * @brief       Presents ASR inference results.
-     * @param[in]   results   Vector of ASR classification results to be displayed.
+     * @param[in]   results   Vector of decoded text of each inference to be displayed.
      * @return      true if successful, false otherwise.
      **/
-    static bool PresentInferenceResult(const std::vector<asr::AsrResult>& results);
+    static bool PresentInferenceResult(const std::vector<asr::AsrTextResult>& results);
 
     /* ASR inference handler. */
     bool ClassifyAudioHandler(ApplicationContext& ctx, uint32_t clipIndex, bool runAll)
@@ -87,16 +86,26 @@ namespace app {
                                                  mfccFrameLen,
                                                  mfccFrameStride);
 
-        std::vector<ClassificationResult> singleInfResult;
         const uint32_t outputCtxLen = AsrPostProcess::GetOutputContextLen(model, inputCtxLen);
         AsrPostProcess postProcess  = AsrPostProcess(outputTensor,
-                                                    ctx.Get<AsrClassifier&>("classifier"),
-                                                    ctx.Get<std::vector<std::string>&>("labels"),
-                                                    singleInfResult,
                                                     outputCtxLen,
                                                     Wav2LetterModel::ms_blankTokenIdx,
                                                     Wav2LetterModel::ms_outputRowsIdx);
 
+        /* Decoder for the post-processed output, skipping rows scoring below the
+         * threshold. Tokens are turned into text to present them. */
+        const uint32_t outputRows = outputTensor->dims->data[Wav2LetterModel::ms_outputRowsIdx];
+        asr::CtcGreedyDecoder decoder(outputTensor->dims->data[Wav2LetterModel::ms_outputColsIdx],
+                                      Wav2LetterModel::ms_blankTokenIdx);
+        decoder.SetScoreThreshold(scoreThreshold, GetTensorQuantParams(outputTensor));
+        const auto labels = ctx.Get<LabelTable>("labels");
+        size_t maxLabelLen = 0;
+        for (const auto& label : labels) {
+            maxLabelLen = std::max(maxLabelLen, label.size());
+        }
+        std::vector<asr::CtcToken> tokens(outputRows);
+        std::vector<char> text(outputRows * maxLabelLen + 1);
+
         /* Loop to process audio clips. */
         do {
             hal_lcd_clear(COLOR_BLACK);
@@ -121,11 +130,14 @@ namespace app {
             }
 
             /* Creating a sliding window through the whole audio clip. */
-            auto audioDataSlider = audio::FractionalSlidingWindow<const int16_t>(
-                audioArr, audioArrSize, audioDataWindowLen, audioDataWindowStride);
+            auto audioDataSlider = audio::WindowView<const int16_t>(
+                audioArr, audioArrSize, audioDataWindowLen, audioDataWindowStride, true);
 
             /* Declare a container for final results. */
-            std::vector<asr::AsrResult> finalResults;
+            std::vector<asr::AsrTextResult> finalResults;
+
+            /* Each clip is decoded as one stream. */
+            decoder.Reset();
 
             /* Display message on the LCD - inference running. */
             std::string str_inf{"Running inference... "};
@@ -136,25 +148,18 @@ namespace app {
                  currentIndex,
                  GetFilename(currentIndex));
 
-            size_t inferenceWindowLen = audioDataWindowLen;
-
             /* Start sliding through audio clip. */
             while (audioDataSlider.HasNext()) {
 
-                /* If not enough audio, see how much can be sent for processing. */
-                size_t nextStartIndex = audioDataSlider.NextWindowStartIndex();
-                if (nextStartIndex + audioDataWindowLen > audioArrSize) {
-                    inferenceWindowLen = audioArrSize - nextStartIndex;
-                }
-
-                const int16_t* inferenceWindow = audioDataSlider.Next();
+                /* The last window is cut short if there is not enough audio. */
+                const auto inferenceWindow = audioDataSlider.Next();
 
                 info("Inference %zu/%zu\n",
                      audioDataSlider.Index() + 1,
-                     static_cast<size_t>(ceilf(audioDataSlider.FractionalTotalStrides() + 1)));
+                     audioDataSlider.NumWindows());
 
                 /* Run the pre-processing, inference and post-processing. */
-                if (!preProcess.DoPreProcess(inferenceWindow, inferenceWindowLen)) {
+                if (!preProcess.DoPreProcess(inferenceWindow.data(), inferenceWindow.size())) {
                     printf_err("Pre-processing failed.");
                     return false;
                 }
@@ -171,12 +176,18 @@ namespace app {
                     return false;
                 }
 
+                size_t numTokens = 0;
+                if (!decoder.Decode(outputTensor, tokens.data(), tokens.size(), numTokens)) {
+                    printf_err("Decoding failed.");
+                    return false;
+                }
+                asr::CtcGreedyDecoder::TokensToText(tokens.data(), numTokens, labels, text.data(), text.size());
+
                 /* Add results from this window to our final results vector. */
-                finalResults.emplace_back(asr::AsrResult(
-                    singleInfResult,
-                    (audioDataSlider.Index() * secondsPerSample * audioDataWindowStride),
-                    audioDataSlider.Index(),
-                    scoreThreshold));
+                finalResults.push_back(asr::AsrTextResult{
+                    text.data(),
+                    static_cast<float>(audioDataSlider.Index() * secondsPerSample * audioDataWindowStride),
+                    static_cast<uint32_t>(audioDataSlider.Index())});
 
 #if VERIFY_TEST_OUTPUT
                 armDumpTensor(outputTensor,
@@ -189,7 +200,7 @@ namespace app {
             hal_lcd_display_text(
                 str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, 0);
 
-            ctx.Set<std::vector<asr::AsrResult>>("results", finalResults);
+            ctx.Set<std::vector<asr::AsrTextResult>>("results", finalResults);
 
             if (!PresentInferenceResult(finalResults)) {
                 return false;
@@ -204,7 +215,7 @@ namespace app {
         return true;
     }
 
-    static bool PresentInferenceResult(const std::vector<asr::AsrResult>& results)
+    static bool PresentInferenceResult(const std::vector<asr::AsrTextResult>& results)
     {
         constexpr uint32_t dataPsnTxtStartX1 = 20;
         constexpr uint32_t dataPsnTxtStartY1 = 60;
@@ -214,26 +225,17 @@ namespace app {
 
         info("Final results:\n");
         info("Total number of inferences: %zu\n", results.size());
-        /* Results from multiple inferences should be combined before processing. */
-        std::vector<ClassificationResult> combinedResults;
-        for (const auto& result : results) {
-            combinedResults.insert(
-                combinedResults.end(), result.m_resultVec.begin(), result.m_resultVec.end());
-        }
 
-        /* Get each inference result string using the decoder. */
+        /* The inferences were decoded as one stream, so their text joins up. */
+        std::string finalResultStr;
         for (const auto& result : results) {
-            std::string infResultStr = audio::asr::DecodeOutput(result.m_resultVec);
-
             info("For timestamp: %f (inference #: %" PRIu32 "); label: %s\n",
                  result.m_timeStamp,
                  result.m_inferenceNumber,
-                 infResultStr.c_str());
+                 result.m_text.c_str());
+            finalResultStr += result.m_text;
         }
 
-        /* Get the decoded result for the combined result. */
-        std::string finalResultStr = audio::asr::DecodeOutput(combinedResults);
-
         hal_lcd_display_text(finalResultStr.c_str(),
                              finalResultStr.size(),
                              dataPsnTxtStartX1,
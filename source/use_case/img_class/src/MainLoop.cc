@@ -59,9 +59,7 @@ void main_loop()
     ImgClassClassifier classifier;  /* Classifier wrapper object. */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector<std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
     /* Loop. */
     bool executionSuccessful = true;
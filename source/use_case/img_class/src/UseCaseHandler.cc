@@ -80,7 +80,7 @@ namespace app {
         ImgClassPostProcess postProcess =
             ImgClassPostProcess(outputTensor,
                                 ctx.Get<ImgClassClassifier&>("classifier"),
-                                ctx.Get<std::vector<std::string>&>("labels"),
+                                ctx.Get<LabelTable>("labels"),
                                 results);
 
         do {
@@ -46,6 +46,7 @@ enum opcodes
 
 static void DisplayMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -85,10 +86,7 @@ void main_loop()
     arm::app::KwsClassifier classifier;  /* classifier wrapper object. */
     caseContext.Set<arm::app::KwsClassifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
     bool executionSuccessful = true;
     constexpr bool bUseMenu = NUMBER_OF_FILES > 1 ? true : false;
@@ -96,7 +96,7 @@ namespace app {
         std::vector<ClassificationResult> singleInfResult;
         KwsPostProcess postProcess = KwsPostProcess(outputTensor,
                                                     ctx.Get<KwsClassifier&>("classifier"),
-                                                    ctx.Get<std::vector<std::string>&>("labels"),
+                                                    ctx.Get<LabelTable>("labels"),
                                                     singleInfResult);
 
         /* Loop to process audio clips. */
@@ -197,7 +197,7 @@ namespace app {
             std::string topKeyword{"<none>"};
             float score = 0.f;
             if (!result.m_resultVec.empty()) {
-                topKeyword = result.m_resultVec[0].m_label;
+                topKeyword = result.m_resultVec[0].m_label.ToString();
                 score      = result.m_resultVec[0].m_normalisedVal;
             }
 
@@ -18,7 +18,6 @@
 #include "Labels_micronetkws.hpp"   /* For MicroNetKws label strings. */
 #include "Labels_wav2letter.hpp"    /* For Wav2Letter label strings. */
 #include "KwsClassifier.hpp"        /* KWS classifier. */
-#include "AsrClassifier.hpp"        /* ASR classifier. */
 #include "MicroNetKwsModel.hpp"     /* KWS model class for running inference. */
 #include "Wav2LetterModel.hpp"      /* ASR model class for running inference. */
 #include "UseCaseCommonUtils.hpp"   /* Utils functions. */
@@ -53,6 +52,7 @@ enum opcodes
 
 static void DisplayMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -117,20 +117,16 @@ void main_loop()
     caseContext.Set<float>("asrScoreThreshold", arm::app::asr::g_ScoreThreshold);  /* Normalised score threshold. */
 
     arm::app::KwsClassifier kwsClassifier;  /* Classifier wrapper object. */
-    arm::app::AsrClassifier asrClassifier;  /* Classifier wrapper object. */
     caseContext.Set<arm::app::KwsClassifier&>("kwsClassifier", kwsClassifier);
-    caseContext.Set<arm::app::AsrClassifier&>("asrClassifier", asrClassifier);
 
-    std::vector<std::string> asrLabels;
-    arm::app::asr::GetLabelsVector(asrLabels);
-    std::vector<std::string> kwsLabels;
-    arm::app::kws::GetLabelsVector(kwsLabels);
-    caseContext.Set<const std::vector <std::string>&>("asrLabels", asrLabels);
-    caseContext.Set<const std::vector <std::string>&>("kwsLabels", kwsLabels);
+    const arm::app::LabelTable asrLabels = arm::app::asr::GetLabels();
+    const arm::app::LabelTable kwsLabels = arm::app::kws::GetLabels();
+    caseContext.Set<arm::app::LabelTable>("asrLabels", asrLabels);
+    caseContext.Set<arm::app::LabelTable>("kwsLabels", kwsLabels);
 
     /* KWS keyword that triggers ASR and associated checks */
     std::string triggerKeyword = std::string("no");
-    if (std::find(kwsLabels.begin(), kwsLabels.end(), triggerKeyword) != kwsLabels.end()) {
+    if (std::find(kwsLabels.begin(), kwsLabels.end(), triggerKeyword.c_str()) != kwsLabels.end()) {
         caseContext.Set<const std::string &>("triggerKeyword", triggerKeyword);
     }
     else {
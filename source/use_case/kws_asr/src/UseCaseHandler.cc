@@ -16,17 +16,17 @@
  */
 #include "UseCaseHandler.hpp"
 
-#include "AsrClassifier.hpp"
 #include "AsrResult.hpp"
 #include "AudioUtils.hpp"
+#include "CascadeScheduler.hpp"
 #include "Classifier.hpp"
+#include "CtcGreedyDecoder.hpp"
 #include "ImageUtils.hpp"
 #include "InputFiles.hpp"
 #include "KwsProcessing.hpp"
 #include "KwsResult.hpp"
 #include "MicroNetKwsMfcc.hpp"
 #include "MicroNetKwsModel.hpp"
-#include "OutputDecode.hpp"
 #include "UseCaseCommonUtils.hpp"
 #include "Wav2LetterMfcc.hpp"
 #include "Wav2LetterModel.hpp"
@@ -40,12 +40,6 @@ using KwsClassifier = arm::app::Classifier;
 namespace arm {
 namespace app {
 
-    struct KWSOutput {
-        bool executionSuccess        = false;
-        const int16_t* asrAudioStart = nullptr;
-        int32_t asrAudioSamples      = 0;
-    };
-
     /**
      * @brief       Presents KWS inference results.
      * @param[in]   results   Vector of KWS classification results to be displayed.
@@ -55,24 +49,32 @@ namespace app {
 
     /**
      * @brief       Presents ASR inference results.
-     * @param[in]   results   Vector of ASR classification results to be displayed.
+     * @param[in]   results   Vector of decoded text of each ASR inference to be displayed.
      * @return      true if successful, false otherwise.
      **/
-    static bool PresentInferenceResult(std::vector<asr::AsrResult>& results);
+    static bool PresentInferenceResult(std::vector<asr::AsrTextResult>& results);
 
     /**
-     * @brief           Performs the KWS pipeline.
+     * @brief           Runs KWS over the current clip and, once the trigger keyword is
+     *                  spotted, ASR over the rest of the clip. KWS and ASR are the two
+     *                  stages of a cascade: KWS runs on every window and its result
+     *                  gates ASR, which starts on the audio right after the keyword.
      * @param[in,out]   ctx   pointer to the application context object
-     * @return          struct containing pointer to audio data where ASR should begin
-     *                  and how much data to process.
+     * @return          true if the pipeline executed without failure.
      **/
-    static KWSOutput doKws(ApplicationContext& ctx)
+    static bool doKwsAsr(ApplicationContext& ctx)
     {
         auto& profiler                = ctx.Get<Profiler&>("profiler");
         auto& kwsModel                = ctx.Get<Model&>("kwsModel");
+        auto& asrModel                = ctx.Get<Model&>("asrModel");
         const auto kwsMfccFrameLength = ctx.Get<int>("kwsFrameLength");
         const auto kwsMfccFrameStride = ctx.Get<int>("kwsFrameStride");
         const auto kwsScoreThreshold  = ctx.Get<float>("kwsScoreThreshold");
+        const auto& triggerKeyword    = ctx.Get<const std::string&>("triggerKeyword");
+        auto asrMfccFrameLen          = ctx.Get<uint32_t>("asrFrameLength");
+        auto asrMfccFrameStride       = ctx.Get<uint32_t>("asrFrameStride");
+        auto asrScoreThreshold        = ctx.Get<float>("asrScoreThreshold");
+        auto asrInputCtxLen           = ctx.Get<uint32_t>("ctxLen");
 
         auto currentIndex = ctx.Get<uint32_t>("clipIndex");
 
@@ -84,12 +86,14 @@ namespace app {
                                  ? MicroNetKwsModel::ms_inputRowsIdx
                                  : MicroNetKwsModel::ms_inputColsIdx);
 
-        /* Output struct from doing KWS. */
-        KWSOutput output{};
-
         if (!kwsModel.IsInited()) {
             printf_err("KWS model has not been initialised\n");
-            return output;
+            return false;
+        }
+
+        if (!asrModel.IsInited()) {
+            printf_err("ASR model has not been initialised\n");
+            return false;
         }
 
         /* Get Input and Output tensors for pre/post processing. */
@@ -97,22 +101,42 @@ namespace app {
         TfLiteTensor* kwsOutputTensor = kwsModel.GetOutputTensor(0);
         if (!kwsInputTensor->dims) {
             printf_err("Invalid input tensor dims\n");
-            return output;
+            return false;
         } else if (kwsInputTensor->dims->size < minTensorDims) {
             printf_err("Input tensor dimension should be >= %d\n", minTensorDims);
-            return output;
+            return false;
         }
 
+        TfLiteTensor* asrInputTensor  = asrModel.GetInputTensor(0);
+        TfLiteTensor* asrOutputTensor = asrModel.GetOutputTensor(0);
+
         /* Get input shape for feature extraction. */
         TfLiteIntArray* inputShape     = kwsModel.GetInputShape(0);
         const uint32_t numMfccFeatures = inputShape->data[MicroNetKwsModel::ms_inputColsIdx];
         const uint32_t numMfccFrames   = inputShape->data[MicroNetKwsModel::ms_inputRowsIdx];
 
+        const uint32_t asrInputRows = asrInputTensor->dims->data[Wav2LetterModel::ms_inputRowsIdx];
+        const uint32_t asrInputInnerLen = asrInputRows - (2 * asrInputCtxLen);
+
+        /* Make sure the input tensor supports the above context and inner lengths. */
+        if (asrInputRows <= 2 * asrInputCtxLen || asrInputRows <= asrInputInnerLen) {
+            printf_err("ASR input rows not compatible with ctx length %" PRIu32 "\n",
+                       asrInputCtxLen);
+            return false;
+        }
+
         /* We expect to be sampling 1 second worth of data at a time
          * NOTE: This is only used for time stamp calculation. */
         const float kwsAudioParamsSecondsPerSample =
             1.0 / audio::MicroNetKwsMFCC::ms_defaultSamplingFreq;
 
+        /* Audio data stride corresponds to inputInnerLen feature vectors. */
+        const uint32_t asrAudioDataWindowLen =
+            (asrInputRows - 1) * asrMfccFrameStride + (asrMfccFrameLen);
+        const uint32_t asrAudioDataWindowStride = asrInputInnerLen * asrMfccFrameStride;
+        const float asrAudioParamsSecondsPerSample =
+            1.0 / audio::Wav2LetterMFCC::ms_defaultSamplingFreq;
+
         /* Set up pre and post-processing. */
         KwsPreProcess preProcess = KwsPreProcess(
             kwsInputTensor, numMfccFeatures, numMfccFrames, kwsMfccFrameLength, kwsMfccFrameStride);
@@ -120,17 +144,134 @@ namespace app {
         std::vector<ClassificationResult> singleInfResult;
         KwsPostProcess postProcess = KwsPostProcess(kwsOutputTensor,
                                                     ctx.Get<KwsClassifier&>("kwsClassifier"),
-                                                    ctx.Get<std::vector<std::string>&>("kwsLabels"),
+                                                    ctx.Get<LabelTable>("kwsLabels"),
                                                     singleInfResult);
 
+        AsrPreProcess asrPreProcess =
+            AsrPreProcess(asrInputTensor,
+                          arm::app::Wav2LetterModel::ms_numMfccFeatures,
+                          asrModel.GetInputShape(0)->data[Wav2LetterModel::ms_inputRowsIdx],
+                          asrMfccFrameLen,
+                          asrMfccFrameStride);
+
+        const uint32_t outputCtxLen = AsrPostProcess::GetOutputContextLen(asrModel, asrInputCtxLen);
+        AsrPostProcess asrPostProcess =
+            AsrPostProcess(asrOutputTensor,
+                           outputCtxLen,
+                           Wav2LetterModel::ms_blankTokenIdx,
+                           Wav2LetterModel::ms_outputRowsIdx);
+
+        /* Decoder for the post-processed output, decoding the audio after the keyword
+         * as one stream and skipping rows scoring below the threshold. Tokens are
+         * turned into text to present them. */
+        const uint32_t asrOutputRows = asrOutputTensor->dims->data[Wav2LetterModel::ms_outputRowsIdx];
+        asr::CtcGreedyDecoder asrDecoder(asrOutputTensor->dims->data[Wav2LetterModel::ms_outputColsIdx],
+                                         Wav2LetterModel::ms_blankTokenIdx);
+        asrDecoder.SetScoreThreshold(asrScoreThreshold, GetTensorQuantParams(asrOutputTensor));
+        const auto asrLabels = ctx.Get<LabelTable>("asrLabels");
+        size_t maxLabelLen = 0;
+        for (const auto& label : asrLabels) {
+            maxLabelLen = std::max(maxLabelLen, label.size());
+        }
+        std::vector<asr::CtcToken> asrTokens(asrOutputRows);
+        std::vector<char> asrText(asrOutputRows * maxLabelLen + 1);
+
         /* Creating a sliding window through the whole audio clip. */
-        auto audioDataSlider = audio::SlidingWindow<const int16_t>(GetAudioArray(currentIndex),
-                                                                   GetAudioArraySize(currentIndex),
-                                                                   preProcess.m_audioDataWindowSize,
-                                                                   preProcess.m_audioDataStride);
+        const int16_t* clip     = GetAudioArray(currentIndex);
+        const uint32_t clipSize = GetAudioArraySize(currentIndex);
+        auto audioDataSlider    = audio::SlidingWindow<const int16_t>(clip,
+                                                                      clipSize,
+                                                                      preProcess.m_audioDataWindowSize,
+                                                                      preProcess.m_audioDataStride);
+
+        /* Samples from the current KWS window to the end of the clip. */
+        size_t remainingSamples = 0;
+
+        /* Slides over the audio after the keyword; set up by the ASR stage. */
+        audio::FractionalSlidingWindow<const int16_t> asrDataSlider;
+        size_t asrAudioSamples = 0;
+
+        /* Runs the ASR pre-processing on the next window after the keyword. Post
+         * processing needs to know if this is the last audio window. */
+        auto asrPreProcessNext = [&]() {
+            size_t windowLen = asrAudioDataWindowLen;
+            const size_t nextStartIndex = asrDataSlider.NextWindowStartIndex();
+            if (nextStartIndex + asrAudioDataWindowLen > asrAudioSamples) {
+                windowLen = asrAudioSamples - nextStartIndex;
+            }
 
-        /* Declare a container to hold kws results from across the whole audio clip. */
+            const int16_t* asrInferenceWindow = asrDataSlider.Next();
+
+            info("ASR inference %zu/%zu\n",
+                 asrDataSlider.Index() + 1,
+                 static_cast<size_t>(ceilf(asrDataSlider.FractionalTotalStrides() + 1)));
+
+            asrPostProcess.m_lastIteration = !asrDataSlider.HasNext();
+            return asrPreProcess.DoPreProcess(asrInferenceWindow, windowLen);
+        };
+
+        /* The KWS stage reads one window; the cascade input runs on to the end of the
+         * clip so the ASR stage can start on the audio after that window. KwsPreProcess
+         * takes the window index as its second argument, so it is adapted. */
+        CascadeScheduler cascade{&profiler};
+        cascade.AddStage("KWS", kwsModel,
+                         [&](const void* input, size_t) {
+                             return preProcess.DoPreProcess(input, audioDataSlider.Index());
+                         },
+                         postProcess,
+                         [&]() {
+                             /* ASR needs some audio after the keyword. */
+                             return singleInfResult[0].m_label == triggerKeyword.c_str() &&
+                                    singleInfResult[0].m_normalisedVal > kwsScoreThreshold &&
+                                    remainingSamples > preProcess.m_audioDataWindowSize;
+                         });
+        cascade.AddStage("ASR", asrModel,
+                         [&](const void* input, size_t inputSize) {
+                             const uint32_t kwsWindowLen = preProcess.m_audioDataWindowSize;
+                             asrAudioSamples = inputSize - kwsWindowLen;
+
+                             /* Audio clip must have enough samples to produce 1 MFCC feature. */
+                             if (asrAudioSamples < asrMfccFrameLen) {
+                                 printf_err("Not enough audio samples, minimum needed is %" PRIu32 "\n",
+                                            asrMfccFrameLen);
+                                 return false;
+                             }
+
+                             asrDataSlider = audio::FractionalSlidingWindow<const int16_t>(
+                                 static_cast<const int16_t*>(input) + kwsWindowLen,
+                                 asrAudioSamples,
+                                 asrAudioDataWindowLen,
+                                 asrAudioDataWindowStride);
+                             return asrPreProcessNext();
+                         },
+                         asrPostProcess);
+
+        /* Declare containers to hold the results from across the whole audio clip. */
         std::vector<kws::KwsResult> finalResults;
+        std::vector<asr::AsrTextResult> asrResults;
+
+        /* Decodes the ASR output of the last window into text. */
+        auto decodeAsr = [&]() {
+            size_t numTokens = 0;
+            if (!asrDecoder.Decode(asrOutputTensor, asrTokens.data(), asrTokens.size(), numTokens)) {
+                printf_err("ASR decoding failed.");
+                return false;
+            }
+            asr::CtcGreedyDecoder::TokensToText(asrTokens.data(), numTokens, asrLabels,
+                                                asrText.data(), asrText.size());
+
+            asrResults.push_back(asr::AsrTextResult{
+                asrText.data(),
+                static_cast<float>(asrDataSlider.Index() * asrAudioParamsSecondsPerSample *
+                                   asrAudioDataWindowStride),
+                static_cast<uint32_t>(asrDataSlider.Index())});
+
+#if VERIFY_TEST_OUTPUT
+            armDumpTensor(asrOutputTensor,
+                          asrOutputTensor->dims->data[Wav2LetterModel::ms_outputColsIdx]);
+#endif /* VERIFY_TEST_OUTPUT */
+            return true;
+        };
 
         /* Display message on the LCD - inference running. */
         std::string str_inf{"Running KWS inference... "};
@@ -144,21 +285,11 @@ namespace app {
         /* Start sliding through audio clip. */
         while (audioDataSlider.HasNext()) {
             const int16_t* inferenceWindow = audioDataSlider.Next();
+            remainingSamples = clip + clipSize - inferenceWindow;
 
-            /* Run the pre-processing, inference and post-processing. */
-            if (!preProcess.DoPreProcess(inferenceWindow, audioDataSlider.Index())) {
-                printf_err("KWS Pre-processing failed.");
-                return output;
-            }
-
-            if (!RunInference(kwsModel, profiler)) {
-                printf_err("KWS Inference failed.");
-                return output;
-            }
-
-            if (!postProcess.DoPostProcess()) {
-                printf_err("KWS Post-processing failed.");
-                return output;
+            /* Run KWS and, if it spots the trigger keyword, the first ASR window. */
+            if (!cascade.Run(inferenceWindow, remainingSamples)) {
+                return false;
             }
 
             info("Inference %zu/%zu\n",
@@ -173,199 +304,63 @@ namespace app {
                                audioDataSlider.Index(),
                                kwsScoreThreshold));
 
-            /* Break out when trigger keyword is detected. */
-            if (singleInfResult[0].m_label == ctx.Get<const std::string&>("triggerKeyword") &&
-                singleInfResult[0].m_normalisedVal > kwsScoreThreshold) {
-                output.asrAudioStart = inferenceWindow + preProcess.m_audioDataWindowSize;
-                output.asrAudioSamples =
-                    GetAudioArraySize(currentIndex) -
-                    (audioDataSlider.NextWindowStartIndex() - preProcess.m_audioDataStride +
-                     preProcess.m_audioDataWindowSize);
-                break;
-            }
-
 #if VERIFY_TEST_OUTPUT
             DumpTensor(kwsOutputTensor);
 #endif /* VERIFY_TEST_OUTPUT */
 
-        } /* while (audioDataSlider.HasNext()) */
-
-        /* Erase. */
-        str_inf = std::string(str_inf.size(), ' ');
-        hal_lcd_display_text(
-            str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, false);
-
-        if (!PresentInferenceResult(finalResults)) {
-            return output;
-        }
-
-        profiler.PrintProfilingResult();
-
-        output.executionSuccess = true;
-        return output;
-    }
-
-    /**
-     * @brief           Performs the ASR pipeline.
-     * @param[in,out]   ctx         Pointer to the application context object.
-     * @param[in]       kwsOutput   Struct containing pointer to audio data where ASR should begin
-     *                              and how much data to process.
-     * @return          true if pipeline executed without failure.
-     **/
-    static bool doAsr(ApplicationContext& ctx, const KWSOutput& kwsOutput)
-    {
-        auto& asrModel          = ctx.Get<Model&>("asrModel");
-        auto& profiler          = ctx.Get<Profiler&>("profiler");
-        auto asrMfccFrameLen    = ctx.Get<uint32_t>("asrFrameLength");
-        auto asrMfccFrameStride = ctx.Get<uint32_t>("asrFrameStride");
-        auto asrScoreThreshold  = ctx.Get<float>("asrScoreThreshold");
-        auto asrInputCtxLen     = ctx.Get<uint32_t>("ctxLen");
-
-        constexpr uint32_t dataPsnTxtInfStartX = 20;
-        constexpr uint32_t dataPsnTxtInfStartY = 40;
-
-        if (!asrModel.IsInited()) {
-            printf_err("ASR model has not been initialised\n");
-            return false;
-        }
-
-        hal_lcd_clear(COLOR_BLACK);
-
-        /* Get Input and Output tensors for pre/post processing. */
-        TfLiteTensor* asrInputTensor  = asrModel.GetInputTensor(0);
-        TfLiteTensor* asrOutputTensor = asrModel.GetOutputTensor(0);
-
-        /* Get input shape. Dimensions of the tensor should have been verified by
-         * the callee. */
-        TfLiteIntArray* inputShape = asrModel.GetInputShape(0);
-
-        const uint32_t asrInputRows = asrInputTensor->dims->data[Wav2LetterModel::ms_inputRowsIdx];
-        const uint32_t asrInputInnerLen = asrInputRows - (2 * asrInputCtxLen);
-
-        /* Make sure the input tensor supports the above context and inner lengths. */
-        if (asrInputRows <= 2 * asrInputCtxLen || asrInputRows <= asrInputInnerLen) {
-            printf_err("ASR input rows not compatible with ctx length %" PRIu32 "\n",
-                       asrInputCtxLen);
-            return false;
-        }
-
-        /* Audio data stride corresponds to inputInnerLen feature vectors. */
-        const uint32_t asrAudioDataWindowLen =
-            (asrInputRows - 1) * asrMfccFrameStride + (asrMfccFrameLen);
-        const uint32_t asrAudioDataWindowStride = asrInputInnerLen * asrMfccFrameStride;
-        const float asrAudioParamsSecondsPerSample =
-            1.0 / audio::Wav2LetterMFCC::ms_defaultSamplingFreq;
-
-        /* Get the remaining audio buffer and respective size from KWS results. */
-        const int16_t* audioArr     = kwsOutput.asrAudioStart;
-        const uint32_t audioArrSize = kwsOutput.asrAudioSamples;
-
-        /* Audio clip must have enough samples to produce 1 MFCC feature. */
-        std::vector<int16_t> audioBuffer = std::vector<int16_t>(audioArr, audioArr + audioArrSize);
-        if (audioArrSize < asrMfccFrameLen) {
-            printf_err("Not enough audio samples, minimum needed is %" PRIu32 "\n",
-                       asrMfccFrameLen);
-            return false;
-        }
-
-        /* Initialise an audio slider. */
-        auto audioDataSlider =
-            audio::FractionalSlidingWindow<const int16_t>(audioBuffer.data(),
-                                                          audioBuffer.size(),
-                                                          asrAudioDataWindowLen,
-                                                          asrAudioDataWindowStride);
-
-        /* Declare a container for results. */
-        std::vector<asr::AsrResult> asrResults;
-
-        /* Display message on the LCD - inference running. */
-        std::string str_inf{"Running ASR inference... "};
-        hal_lcd_display_text(
-            str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, false);
-
-        size_t asrInferenceWindowLen = asrAudioDataWindowLen;
-
-        /* Set up pre and post-processing objects. */
-        AsrPreProcess asrPreProcess =
-            AsrPreProcess(asrInputTensor,
-                          arm::app::Wav2LetterModel::ms_numMfccFeatures,
-                          inputShape->data[Wav2LetterModel::ms_inputRowsIdx],
-                          asrMfccFrameLen,
-                          asrMfccFrameStride);
-
-        std::vector<ClassificationResult> singleInfResult;
-        const uint32_t outputCtxLen = AsrPostProcess::GetOutputContextLen(asrModel, asrInputCtxLen);
-        AsrPostProcess asrPostProcess =
-            AsrPostProcess(asrOutputTensor,
-                           ctx.Get<AsrClassifier&>("asrClassifier"),
-                           ctx.Get<std::vector<std::string>&>("asrLabels"),
-                           singleInfResult,
-                           outputCtxLen,
-                           Wav2LetterModel::ms_blankTokenIdx,
-                           Wav2LetterModel::ms_outputRowsIdx);
-        /* Start sliding through audio clip. */
-        while (audioDataSlider.HasNext()) {
-
-            /* If not enough audio see how much can be sent for processing. */
-            size_t nextStartIndex = audioDataSlider.NextWindowStartIndex();
-            if (nextStartIndex + asrAudioDataWindowLen > audioBuffer.size()) {
-                asrInferenceWindowLen = audioBuffer.size() - nextStartIndex;
+            /* The gate stopped the cascade after KWS. */
+            if (cascade.GetNumStagesRun() < cascade.GetNumStages()) {
+                continue;
             }
 
-            const int16_t* asrInferenceWindow = audioDataSlider.Next();
+            info("Trigger keyword spotted\n");
 
-            info("Inference %zu/%zu\n",
-                 audioDataSlider.Index() + 1,
-                 static_cast<size_t>(ceilf(audioDataSlider.FractionalTotalStrides() + 1)));
-
-            /* Run the pre-processing, inference and post-processing. */
-            if (!asrPreProcess.DoPreProcess(asrInferenceWindow, asrInferenceWindowLen)) {
-                printf_err("ASR pre-processing failed.");
+            /* ASR carries on over the rest of the clip, with the same pre and
+             * post-processing as the stage that started it. Inference is profiled
+             * under the stage's name so all ASR windows report together. */
+            if (!decodeAsr()) {
                 return false;
             }
+            while (asrDataSlider.HasNext()) {
+                if (!asrPreProcessNext()) {
+                    printf_err("ASR pre-processing failed.");
+                    return false;
+                }
 
-            /* Run inference over this audio clip sliding window. */
-            if (!RunInference(asrModel, profiler)) {
-                printf_err("ASR inference failed\n");
-                return false;
-            }
+                profiler.StartProfiling("ASR inference");
+                const bool asrInfOk = asrModel.RunInference();
+                profiler.StopProfiling();
+                if (!asrInfOk) {
+                    printf_err("ASR inference failed\n");
+                    return false;
+                }
 
-            /* Post processing needs to know if we are on the last audio window. */
-            asrPostProcess.m_lastIteration = !audioDataSlider.HasNext();
-            if (!asrPostProcess.DoPostProcess()) {
-                printf_err("ASR post-processing failed.");
-                return false;
-            }
+                if (!asrPostProcess.DoPostProcess()) {
+                    printf_err("ASR post-processing failed.");
+                    return false;
+                }
 
-            /* Get results. */
-            std::vector<ClassificationResult> asrClassificationResult;
-            auto& asrClassifier = ctx.Get<AsrClassifier&>("asrClassifier");
-            asrClassifier.GetClassificationResults(asrOutputTensor,
-                                                   asrClassificationResult,
-                                                   ctx.Get<std::vector<std::string>&>("asrLabels"),
-                                                   1);
-
-            asrResults.emplace_back(
-                asr::AsrResult(asrClassificationResult,
-                               (audioDataSlider.Index() * asrAudioParamsSecondsPerSample *
-                                asrAudioDataWindowStride),
-                               audioDataSlider.Index(),
-                               asrScoreThreshold));
+                if (!decodeAsr()) {
+                    return false;
+                }
+            }
+            break;
+        } /* while (audioDataSlider.HasNext()) */
 
-#if VERIFY_TEST_OUTPUT
-            armDumpTensor(asrOutputTensor,
-                          asrOutputTensor->dims->data[Wav2LetterModel::ms_outputColsIdx]);
-#endif /* VERIFY_TEST_OUTPUT */
+        /* Erase. */
+        str_inf = std::string(str_inf.size(), ' ');
+        hal_lcd_display_text(
+            str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, false);
 
-            /* Erase */
-            str_inf = std::string(str_inf.size(), ' ');
-            hal_lcd_display_text(
-                str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, false);
+        if (!PresentInferenceResult(finalResults)) {
+            return false;
         }
-        if (!PresentInferenceResult(asrResults)) {
+
+        if (!asrResults.empty() && !PresentInferenceResult(asrResults)) {
             return false;
         }
 
+        cascade.PrintStats();
         profiler.PrintProfilingResult();
 
         return true;
@@ -386,20 +381,11 @@ namespace app {
         auto startClipIdx = ctx.Get<uint32_t>("clipIndex");
 
         do {
-            KWSOutput kwsOutput = doKws(ctx);
-            if (!kwsOutput.executionSuccess) {
-                printf_err("KWS failed\n");
+            if (!doKwsAsr(ctx)) {
+                printf_err("KWS/ASR failed\n");
                 return false;
             }
 
-            if (kwsOutput.asrAudioStart != nullptr && kwsOutput.asrAudioSamples > 0) {
-                info("Trigger keyword spotted\n");
-                if (!doAsr(ctx, kwsOutput)) {
-                    printf_err("ASR failed\n");
-                    return false;
-                }
-            }
-
             IncrementAppCtxIfmIdx(ctx, "kws_asr");
 
         } while (runAll && ctx.Get<uint32_t>("clipIndex") != startClipIdx);
@@ -423,7 +409,7 @@ namespace app {
             float score = 0.f;
 
             if (!result.m_resultVec.empty()) {
-                topKeyword = result.m_resultVec[0].m_label;
+                topKeyword = result.m_resultVec[0].m_label.ToString();
                 score      = result.m_resultVec[0].m_normalisedVal;
             }
 
@@ -451,7 +437,7 @@ namespace app {
         return true;
     }
 
-    static bool PresentInferenceResult(std::vector<arm::app::asr::AsrResult>& results)
+    static bool PresentInferenceResult(std::vector<arm::app::asr::AsrTextResult>& results)
     {
         constexpr uint32_t dataPsnTxtStartX1 = 20;
         constexpr uint32_t dataPsnTxtStartY1 = 80;
@@ -459,23 +445,14 @@ namespace app {
 
         hal_lcd_set_text_color(COLOR_GREEN);
 
-        /* Results from multiple inferences should be combined before processing. */
-        std::vector<arm::app::ClassificationResult> combinedResults;
+        /* The inferences were decoded as one stream, so their text joins up. */
+        std::string finalResultStr;
         for (auto& result : results) {
-            combinedResults.insert(
-                combinedResults.end(), result.m_resultVec.begin(), result.m_resultVec.end());
-        }
-
-        for (auto& result : results) {
-            /* Get the final result string using the decoder. */
-            std::string infResultStr = audio::asr::DecodeOutput(result.m_resultVec);
-
             info(
-                "Result for inf %" PRIu32 ": %s\n", result.m_inferenceNumber, infResultStr.c_str());
+                "Result for inf %" PRIu32 ": %s\n", result.m_inferenceNumber, result.m_text.c_str());
+            finalResultStr += result.m_text;
         }
 
-        std::string finalResultStr = audio::asr::DecodeOutput(combinedResults);
-
         hal_lcd_display_text(finalResultStr.c_str(),
                              finalResultStr.size(),
                              dataPsnTxtStartX1,
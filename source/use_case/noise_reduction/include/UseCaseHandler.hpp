@@ -31,6 +31,17 @@ namespace app {
      **/
     bool NoiseReductionHandler(ApplicationContext& ctx, bool runAll);
 
+    /**
+     * @brief       Handles the inference event for noise reduction of several
+     *              audio channels at once, all through the one model. The
+     *              channels take consecutive audio clips from the current one,
+     *              and the real-time factor of the whole run is reported.
+     * @param[in]   ctx           pointer to the application context
+     * @param[in]   numChannels   number of channels to denoise at once
+     * @return      True or false based on execution success
+     **/
+    bool NoiseReductionMultiChannelHandler(ApplicationContext& ctx, uint32_t numChannels);
+
     /**
      * @brief           Dumps the output tensors to a memory address.
      * This functionality is required for RNNoise use case as we want to
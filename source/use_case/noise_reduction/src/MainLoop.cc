@@ -20,6 +20,13 @@
 #include "InputFiles.hpp"           /* For input audio clips. */
 #include "log_macros.h"             /* Logging functions */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
+#include "AudioSink.hpp"            /* Streaming of the denoised audio. */
+
+#if defined(NR_WAV_FILE_SINK) && defined(NR_WAV_OUTPUT_DIR)
+#include "WavFileAudioSink.hpp"
+#endif /* defined(NR_WAV_FILE_SINK) && defined(NR_WAV_OUTPUT_DIR) */
+
+#include <new>
 
 namespace arm {
 namespace app {
@@ -36,24 +43,37 @@ enum opcodes
     MENU_OPT_RUN_INF_NEXT = 1,       /* Run on next vector. */
     MENU_OPT_RUN_INF_CHOSEN,         /* Run on a user provided vector index. */
     MENU_OPT_RUN_INF_ALL,            /* Run inference on all. */
+    MENU_OPT_RUN_INF_MULTI_CHANNEL,  /* Run inference on several vectors at once. */
     MENU_OPT_SHOW_MODEL_INFO,        /* Show model info. */
     MENU_OPT_LIST_AUDIO_CLIPS        /* List the current baked audio clip features. */
 };
 
 static void DisplayMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
     printf("  %u. Run noise reduction on the next WAV\n", MENU_OPT_RUN_INF_NEXT);
     printf("  %u. Run noise reduction on a WAV at chosen index\n", MENU_OPT_RUN_INF_CHOSEN);
     printf("  %u. Run noise reduction on all WAVs\n", MENU_OPT_RUN_INF_ALL);
+    printf("  %u. Run noise reduction on %u WAVs at once\n", MENU_OPT_RUN_INF_MULTI_CHANNEL, NR_NUM_CHANNELS);
     printf("  %u. Show NN model info\n", MENU_OPT_SHOW_MODEL_INFO);
     printf("  %u. List audio clips\n\n", MENU_OPT_LIST_AUDIO_CLIPS);
     printf("  Choice: ");
     fflush(stdout);
 }
 
+/** @brief  Largest power of two number of chunks whose ring fits in the dump region. */
+static constexpr uint32_t DumpRingChunks(size_t regionBytes, size_t chunkBytes)
+{
+    uint32_t chunks = 1;
+    while ((2 * chunks + 1) * (chunkBytes + 2 * sizeof(uint32_t)) + 128 <= regionBytes) {
+        chunks *= 2;
+    }
+    return chunks;
+}
+
 static bool SetAppCtxClipIdx(arm::app::ApplicationContext& ctx, uint32_t idx)
 {
     if (idx >= NUMBER_OF_FILES) {
@@ -92,7 +112,22 @@ void main_loop()
     caseContext.Set<arm::app::RNNoiseModel&>("model", model);
     SetAppCtxClipIdx(caseContext, 0);
 
-#if defined(MEM_DUMP_BASE_ADDR) && defined(MPS3_PLATFORM)
+#if defined(NR_WAV_FILE_SINK) && defined(NR_WAV_OUTPUT_DIR)
+    /* On the host, the denoised audio goes straight to WAV files. */
+    arm::app::WavFileAudioSink wavSink(NR_WAV_OUTPUT_DIR, NR_AUDIO_RATE);
+    caseContext.Set<arm::app::AudioSink*>("audioSink", &wavSink);
+#endif /* defined(NR_WAV_FILE_SINK) && defined(NR_WAV_OUTPUT_DIR) */
+
+#if defined(MEM_DUMP_BASE_ADDR) && defined(MPS3_PLATFORM) && defined(NR_MEM_DUMP_RING)
+    /* Stream the dump through a ring of chunks in the dump region instead,
+     * for a consumer to drain while the audio is being denoised. */
+    constexpr size_t ringChunkBytes = 4096;
+    using DumpRingSink = arm::app::RingAudioSink<ringChunkBytes, DumpRingChunks(MEM_DUMP_LEN, ringChunkBytes)>;
+    static_assert(sizeof(DumpRingSink::Ring) <= MEM_DUMP_LEN, "Dump ring does not fit");
+    auto* dumpRing = new (reinterpret_cast<void*>(MEM_DUMP_BASE_ADDR)) DumpRingSink::Ring();
+    DumpRingSink ringSink(*dumpRing);
+    caseContext.Set<arm::app::AudioSink*>("audioSink", &ringSink);
+#elif defined(MEM_DUMP_BASE_ADDR) && defined(MPS3_PLATFORM)
     /* For this use case, for valid targets, we dump contents
      * of the output tensor to a certain location in memory to
      * allow offline tools to pick this data up. */
@@ -102,7 +137,7 @@ void main_loop()
     caseContext.Set<size_t>("MEM_DUMP_LEN", memDumpMaxLen);
     caseContext.Set<uint8_t*>("MEM_DUMP_BASE_ADDR", memDumpBaseAddr);
     caseContext.Set<size_t*>("MEM_DUMP_BYTE_WRITTEN", &memDumpBytesWritten);
-#endif /* defined(MEM_DUMP_BASE_ADDR) && defined(MPS3_PLATFORM) */
+#endif /* defined(MEM_DUMP_BASE_ADDR) && defined(MPS3_PLATFORM) && defined(NR_MEM_DUMP_RING) */
     /* Loop. */
     do {
         int menuOption = MENU_OPT_RUN_INF_NEXT;
@@ -127,6 +162,9 @@ void main_loop()
             case MENU_OPT_RUN_INF_ALL:
                 executionSuccessful = NoiseReductionHandler(caseContext, true);
                 break;
+            case MENU_OPT_RUN_INF_MULTI_CHANNEL:
+                executionSuccessful = NoiseReductionMultiChannelHandler(caseContext, NR_NUM_CHANNELS);
+                break;
             case MENU_OPT_SHOW_MODEL_INFO:
                 executionSuccessful = model.ShowModelInfoHandler();
                 break;
@@ -15,11 +15,13 @@
  * limitations under the License.
  */
 #include "UseCaseHandler.hpp"
+#include "AudioSink.hpp"
 #include "AudioUtils.hpp"
 #include "ImageUtils.hpp"
 #include "InputFiles.hpp"
 #include "RNNoiseFeatureProcessor.hpp"
 #include "RNNoiseModel.hpp"
+#include "RNNoiseMultiChannel.hpp"
 #include "RNNoiseProcessing.hpp"
 #include "UseCaseCommonUtils.hpp"
 #include "hal.h"
@@ -54,6 +56,12 @@ namespace app {
         std::reference_wrapper<size_t> memDumpBytesWritten = std::ref(*pMemDumpBytesWritten);
         auto& profiler                                     = ctx.Get<Profiler&>("profiler");
 
+        /* Optional sink streaming the denoised audio out as it is produced. */
+        AudioSink* audioSink = nullptr;
+        if (ctx.Has("audioSink")) {
+            audioSink = ctx.Get<AudioSink*>("audioSink");
+        }
+
         /* Get model reference. */
         auto& model = ctx.Get<RNNoiseModel&>("model");
         if (!model.IsInited()) {
@@ -117,6 +125,11 @@ namespace app {
                                         memDumpBaseAddr + memDumpBytesWritten,
                                         memDumpMaxLen - memDumpBytesWritten);
 
+            if (audioSink && !audioSink->Begin(audioFileAccessorFunc(currentIndex),
+                                               (audioDataSlider.TotalStrides() + 1) * audioFrameLen)) {
+                return false;
+            }
+
             /* Set up pre and post-processing. */
             std::shared_ptr<rnn::RNNoiseFeatureProcessor> featureProcessor =
                 std::make_shared<rnn::RNNoiseFeatureProcessor>();
@@ -132,6 +145,11 @@ namespace app {
 
             bool resetGRU = true;
 
+            /* Strings for presentation, set up once rather than every frame. */
+            static constexpr char strInf[] = "Running inference... ";
+            static constexpr char strInfErase[] = "                     ";
+            static_assert(sizeof(strInf) == sizeof(strInfErase), "Erase string must cover the message");
+
             while (audioDataSlider.HasNext()) {
                 const int16_t* inferenceWindow = audioDataSlider.Next();
 
@@ -150,12 +168,9 @@ namespace app {
                     model.CopyGruStates();
                 }
 
-                /* Strings for presentation/logging. */
-                std::string str_inf{"Running inference... "};
-
                 /* Display message on the LCD - inference running. */
-                hal_lcd_display_text(str_inf.c_str(),
-                                     str_inf.size(),
+                hal_lcd_display_text(strInf,
+                                     sizeof(strInf) - 1,
                                      dataPsnTxtInfStartX,
                                      dataPsnTxtInfStartY,
                                      false);
@@ -178,9 +193,8 @@ namespace app {
                 }
 
                 /* Erase. */
-                str_inf = std::string(str_inf.size(), ' ');
-                hal_lcd_display_text(str_inf.c_str(),
-                                     str_inf.size(),
+                hal_lcd_display_text(strInfErase,
+                                     sizeof(strInfErase) - 1,
                                      dataPsnTxtInfStartX,
                                      dataPsnTxtInfStartY,
                                      false);
@@ -192,6 +206,15 @@ namespace app {
                                                      memDumpBaseAddr + memDumpBytesWritten,
                                                      memDumpMaxLen - memDumpBytesWritten);
                 }
+
+                if (audioSink && !audioSink->Write(denoisedAudioFrame.data(), denoisedAudioFrame.size())) {
+                    printf_err("Writing denoised audio failed.");
+                    return false;
+                }
+            }
+
+            if (audioSink && !audioSink->End()) {
+                return false;
             }
 
             if (memDumpMaxLen > 0) {
@@ -231,6 +254,133 @@ namespace app {
         return true;
     }
 
+    /**
+     * @brief           Reports how the profiled processing time of a stretch of
+     *                  audio compares with its duration.
+     * @param[in]       results        Profiling results of the processing rounds.
+     * @param[in]       audioSeconds   Duration of all the audio processed, summed over channels.
+     **/
+    static void ReportRealTimeFactor(const std::vector<ProfileResult>& results,
+                                     double audioSeconds);
+
+    /* Noise reduction inference handler for several channels sharing one model. */
+    bool NoiseReductionMultiChannelHandler(ApplicationContext& ctx, const uint32_t numChannels)
+    {
+        auto& model = ctx.Get<RNNoiseModel&>("model");
+        if (!model.IsInited()) {
+            printf_err("Model is not initialised! Terminating processing.\n");
+            return false;
+        }
+
+        if (numChannels == 0) {
+            printf_err("At least one channel is needed.\n");
+            return false;
+        }
+
+        auto audioFrameLen    = ctx.Get<uint32_t>("frameLength");
+        auto audioFrameStride = ctx.Get<uint32_t>("frameStride");
+
+        std::function<const int16_t*(const uint32_t)> audioAccessorFunc = GetAudioArray;
+        if (ctx.Has("features")) {
+            audioAccessorFunc = ctx.Get<std::function<const int16_t*(const uint32_t)>>("features");
+        }
+        std::function<uint32_t(const uint32_t)> audioSizeAccessorFunc = GetAudioArraySize;
+        if (ctx.Has("featureSizes")) {
+            audioSizeAccessorFunc =
+                ctx.Get<std::function<uint32_t(const uint32_t)>>("featureSizes");
+        }
+        std::function<const char*(const uint32_t)> audioFileAccessorFunc = GetFilename;
+        if (ctx.Has("featureFileNames")) {
+            audioFileAccessorFunc =
+                ctx.Get<std::function<const char*(const uint32_t)>>("featureFileNames");
+        }
+
+        if (ctx.Has("MEM_DUMP_LEN")) {
+            info("Denoised audio is not dumped to memory when running several channels.\n");
+        }
+
+        /* Each channel takes the next clip along, wrapping around the clips available. */
+        std::vector<audio::SlidingWindow<const int16_t>> audioDataSliders;
+        for (uint32_t channel = 0; channel < numChannels; ++channel) {
+            const uint32_t clipIndex = ctx.Get<uint32_t>("clipIndex");
+            info("Channel %" PRIu32 " => %s\n", channel, audioFileAccessorFunc(clipIndex));
+            audioDataSliders.emplace_back(audioAccessorFunc(clipIndex),
+                                          audioSizeAccessorFunc(clipIndex),
+                                          audioFrameLen,
+                                          audioFrameStride);
+            IncrementAppCtxClipIdx(ctx);
+        }
+
+        RNNoiseMultiChannel multiChannel(model, numChannels, audioFrameLen);
+        Profiler profiler{"noise_reduction_multi_channel"};
+        size_t framesProcessed = 0;
+        bool framesLeft = true;
+
+        /* Each round gives every channel with audio left one frame through the model. */
+        while (framesLeft) {
+            framesLeft = false;
+            profiler.StartProfiling("Round");
+            for (uint32_t channel = 0; channel < numChannels; ++channel) {
+                auto& audioDataSlider = audioDataSliders[channel];
+                if (!audioDataSlider.HasNext()) {
+                    continue;
+                }
+
+                if (!multiChannel.DenoiseFrame(channel, audioDataSlider.Next())) {
+                    return false;
+                }
+                ++framesProcessed;
+                framesLeft = framesLeft || audioDataSlider.HasNext();
+            }
+            profiler.StopProfiling();
+        }
+
+        info("All inferences for %" PRIu32 " channels complete, %zu frames.\n",
+             numChannels, framesProcessed);
+
+        std::vector<ProfileResult> results;
+        profiler.GetAllResultsAndReset(results);
+        ReportRealTimeFactor(results,
+                             static_cast<double>(framesProcessed) * audioFrameStride / NR_AUDIO_RATE);
+        return true;
+    }
+
+    static void ReportRealTimeFactor(const std::vector<ProfileResult>& results,
+                                     const double audioSeconds)
+    {
+        if (audioSeconds <= 0) {
+            return;
+        }
+
+        constexpr double cpuClockHz = NR_CPU_CLOCK_HZ;
+        for (const auto& result : results) {
+            for (const auto& stat : result.data) {
+                double seconds = 0;
+                if (stat.unit == "microseconds") {
+                    seconds = static_cast<double>(stat.total) / 1e6;
+                } else if (stat.name == "CPU TOTAL") {
+                    if (cpuClockHz <= 0) {
+                        info("%s: %.0f cycles per second of audio\n", stat.name.c_str(),
+                             static_cast<double>(stat.total) / audioSeconds);
+                        continue;
+                    }
+                    seconds = static_cast<double>(stat.total) / cpuClockHz;
+                } else {
+                    continue;
+                }
+
+                const double realTimeFactor = seconds / audioSeconds;
+                info("%s: real-time factor %.4f for %.2f s of audio\n",
+                     stat.name.c_str(), realTimeFactor, audioSeconds);
+                if (realTimeFactor > 0) {
+                    /* The factor is per second of any one channel's audio. */
+                    info("About %.1f channels could be denoised in real time\n",
+                         1.0 / realTimeFactor);
+                }
+            }
+        }
+    }
+
     size_t DumpDenoisedAudioHeader(const char* filename,
                                    size_t dumpSize,
                                    uint8_t* memAddress,
@@ -57,6 +57,14 @@ USER_OPTION(${use_case}_AUDIO_MIN_SAMPLES "Specify the minimum number of samples
     512
     STRING)
 
+USER_OPTION(${use_case}_NUM_CHANNELS "Number of audio channels denoised at once through the one model."
+    4
+    STRING)
+
+USER_OPTION(${use_case}_CPU_CLOCK_HZ "CPU clock frequency used to turn profiled cycles into a real-time factor. 0 reports cycles per second of audio instead."
+    0
+    STRING)
+
 # Generate input files from audio wav files
 generate_audio_code(${${use_case}_FILE_PATH} ${SRC_GEN_DIR} ${INC_GEN_DIR}
     ${${use_case}_AUDIO_RATE}
@@ -82,6 +90,22 @@ generate_tflite_code(
     NAMESPACE   "arm" "app" "rnn")
 
 
+set(${use_case}_COMPILE_DEFS
+    "NR_NUM_CHANNELS=${${use_case}_NUM_CHANNELS}"
+    "NR_AUDIO_RATE=${${use_case}_AUDIO_RATE}"
+    "NR_CPU_CLOCK_HZ=${${use_case}_CPU_CLOCK_HZ}")
+
+# On the host, denoised audio can be streamed straight to WAV files:
+if (TARGET_PLATFORM STREQUAL native)
+    USER_OPTION(${use_case}_WAV_OUTPUT_DIR "Directory the denoised WAV files are written to. Empty to not write them."
+        ""
+        PATH)
+
+    if (NOT "${${use_case}_WAV_OUTPUT_DIR}" STREQUAL "")
+        list(APPEND ${use_case}_COMPILE_DEFS "NR_WAV_OUTPUT_DIR=\"${${use_case}_WAV_OUTPUT_DIR}\"")
+    endif()
+endif()
+
 # For MPS3, allow dumping of output data to memory, based on these parameters:
 if (TARGET_PLATFORM STREQUAL mps3)
     USER_OPTION(${use_case}_MEM_DUMP_BASE_ADDR
@@ -94,11 +118,20 @@ if (TARGET_PLATFORM STREQUAL mps3)
         0x00100000 # 1 MiB
         STRING)
 
+    USER_OPTION(${use_case}_MEM_DUMP_RING
+        "Stream the dump through a ring of chunks in the dump buffer, to be drained while running, rather than filling it once"
+        OFF
+        BOOL)
+
     # Add special compile definitions for this use case files:
-    set(${use_case}_COMPILE_DEFS
+    list(APPEND ${use_case}_COMPILE_DEFS
         "MEM_DUMP_BASE_ADDR=${${use_case}_MEM_DUMP_BASE_ADDR}"
         "MEM_DUMP_LEN=${${use_case}_MEM_DUMP_LEN}")
 
+    if (${use_case}_MEM_DUMP_RING)
+        list(APPEND ${use_case}_COMPILE_DEFS "NR_MEM_DUMP_RING=1")
+    endif()
+
     file(GLOB_RECURSE SRC_FILES
         "${SRC_USE_CASE}/${use_case}/src/*.cpp"
         "${SRC_USE_CASE}/${use_case}/src/*.cc")
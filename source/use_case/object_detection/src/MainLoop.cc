@@ -34,6 +34,7 @@ namespace app {
 
 static void DisplayDetectionMenu()
 {
+    log_flush();    /* Any deferred messages go before the menu. */
     printf("\n\n");
     printf("User input required\n");
     printf("Enter option number from:\n\n");
@@ -23,6 +23,7 @@
 #include "UseCaseCommonUtils.hpp"   /* Utils functions. */
 #include "log_macros.h"             /* Logging functions */
 #include "BufAttributes.hpp"        /* Buffer attributes to be applied */
+#include "ChangeDetector.hpp"       /* Skipping inference on unchanged frames. */
 
 namespace arm {
 namespace app {
@@ -60,9 +61,20 @@ void main_loop()
     ViusalWakeWordClassifier classifier;  /* Classifier wrapper object. */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
+
+#if CHANGE_DETECTION_ENABLED
+    /* Reuse the last result while the input image does not change. */
+    TfLiteIntArray* inputShape = model.GetInputShape(0);
+    arm::app::image::ChangeDetectorParams changeParams;
+    changeParams.blockThreshold = CHANGE_DETECTION_THRESHOLD;
+    changeParams.refreshInterval = CHANGE_DETECTION_REFRESH_INTERVAL;
+    arm::app::image::ChangeDetector changeDetector(
+        inputShape->data[arm::app::VisualWakeWordModel::ms_inputColsIdx],
+        inputShape->data[arm::app::VisualWakeWordModel::ms_inputRowsIdx],
+        3, changeParams);
+    caseContext.Set<arm::app::image::ChangeDetector&>("changeDetector", changeDetector);
+#endif /* CHANGE_DETECTION_ENABLED */
 
     /* Loop. */
     bool executionSuccessful = true;
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include "UseCaseHandler.hpp"
+#include "ChangeDetector.hpp"
 #include "Classifier.hpp"
 #include "ImageUtils.hpp"
 #include "InputFiles.hpp"
@@ -82,9 +83,13 @@ namespace app {
         VisualWakeWordPostProcess postProcess =
             VisualWakeWordPostProcess(outputTensor,
                                       ctx.Get<Classifier&>("classifier"),
-                                      ctx.Get<std::vector<std::string>&>("labels"),
+                                      ctx.Get<LabelTable>("labels"),
                                       results);
 
+        /* Optional change detector; when present unchanged frames reuse the last result. */
+        image::ChangeDetector* changeDetector = ctx.Has("changeDetector") ?
+            &ctx.Get<image::ChangeDetector&>("changeDetector") : nullptr;
+
         do {
             hal_lcd_clear(COLOR_BLACK);
 
@@ -112,28 +117,45 @@ namespace app {
             hal_lcd_display_text(
                 str_inf.c_str(), str_inf.size(), dataPsnTxtInfStartX, dataPsnTxtInfStartY, 0);
 
-            /* Run inference over this image. */
-            info("Running inference on image %" PRIu32 " => %s\n",
-                 ctx.Get<uint32_t>("imgIndex"),
-                 GetFilename(ctx.Get<uint32_t>("imgIndex")));
-
-            const size_t imgSz =
-                inputTensor->bytes < IMAGE_DATA_SIZE ? inputTensor->bytes : IMAGE_DATA_SIZE;
+            bool changed = true;
+            if (changeDetector) {
+                profiler.StartProfiling("Change detection");
+                changed = changeDetector->HasChanged(imgSrc) || !ctx.Has("results");
+                profiler.StopProfiling();
 
-            /* Run the pre-processing, inference and post-processing. */
-            if (!preProcess.DoPreProcess(imgSrc, imgSz)) {
-                printf_err("Pre-processing failed.");
-                return false;
+                /* Average of this series is the share of frames inference ran on. */
+                profiler.RecordValue("Change detector", "Inferences", "%", changed ? 100 : 0);
             }
 
-            if (!RunInference(model, profiler)) {
-                printf_err("Inference failed.");
-                return false;
-            }
-
-            if (!postProcess.DoPostProcess()) {
-                printf_err("Post-processing failed.");
-                return false;
+            if (changed) {
+                /* Run inference over this image. */
+                info("Running inference on image %" PRIu32 " => %s\n",
+                     ctx.Get<uint32_t>("imgIndex"),
+                     GetFilename(ctx.Get<uint32_t>("imgIndex")));
+
+                const size_t imgSz =
+                    inputTensor->bytes < IMAGE_DATA_SIZE ? inputTensor->bytes : IMAGE_DATA_SIZE;
+
+                /* Run the pre-processing, inference and post-processing. */
+                if (!preProcess.DoPreProcess(imgSrc, imgSz)) {
+                    printf_err("Pre-processing failed.");
+                    return false;
+                }
+
+                if (!RunInference(model, profiler)) {
+                    printf_err("Inference failed.");
+                    return false;
+                }
+
+                if (!postProcess.DoPostProcess()) {
+                    printf_err("Post-processing failed.");
+                    return false;
+                }
+            } else {
+                info("Image %" PRIu32 " => %s unchanged, reusing the last result\n",
+                     ctx.Get<uint32_t>("imgIndex"),
+                     GetFilename(ctx.Get<uint32_t>("imgIndex")));
+                results = ctx.Get<std::vector<ClassificationResult>>("results");
             }
 
             /* Erase. */
@@ -152,6 +174,11 @@ namespace app {
                 return false;
             }
 
+            if (changeDetector) {
+                info("Inference ran on %" PRIu32 " frames, skipped on %" PRIu32 "\n",
+                     changeDetector->GetExecutedCount(), changeDetector->GetSkippedCount());
+            }
+
             profiler.PrintProfilingResult();
 
             IncrementAppCtxIfmIdx(ctx, "imgIndex");
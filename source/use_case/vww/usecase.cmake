@@ -28,6 +28,27 @@ USER_OPTION(${use_case}_LABELS_TXT_FILE "Labels' txt file for the chosen model"
     ${CMAKE_CURRENT_SOURCE_DIR}/resources/${use_case}/labels/visual_wake_word_labels.txt
     FILEPATH)
 
+USER_OPTION(${use_case}_CHANGE_DETECTION_ENABLED "Skip inference and reuse the last result while the input image does not change."
+    OFF
+    BOOL)
+
+USER_OPTION(${use_case}_CHANGE_DETECTION_THRESHOLD "Mean absolute pixel difference at which a block of the sub-sampled frame counts as changed."
+    12
+    STRING)
+
+USER_OPTION(${use_case}_CHANGE_DETECTION_REFRESH_INTERVAL "Run inference at least every N frames even if nothing changed, 0 for never."
+    30
+    STRING)
+
+if (${use_case}_CHANGE_DETECTION_ENABLED)
+    list(APPEND ${use_case}_COMPILE_DEFS CHANGE_DETECTION_ENABLED=1)
+else()
+    list(APPEND ${use_case}_COMPILE_DEFS CHANGE_DETECTION_ENABLED=0)
+endif()
+list(APPEND ${use_case}_COMPILE_DEFS
+    CHANGE_DETECTION_THRESHOLD=${${use_case}_CHANGE_DETECTION_THRESHOLD}
+    CHANGE_DETECTION_REFRESH_INTERVAL=${${use_case}_CHANGE_DETECTION_REFRESH_INTERVAL})
+
 USER_OPTION(${use_case}_ACTIVATION_BUF_SZ "Activation buffer size for the chosen model"
     0x00200000
     STRING)
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hal.h"
+
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const char* s_wavPath = "audio_stream_test.wav";
+
+/* Writes a mono 16-bit WAV holding the sample index (mod 32768) as its value. */
+static void WriteRampWav(const char* path, uint32_t numSamples, uint32_t rate)
+{
+    FILE* f = fopen(path, "wb");
+    REQUIRE(f != nullptr);
+
+    auto put32 = [f](uint32_t v) { for (int i = 0; i < 4; ++i) { fputc((v >> (8 * i)) & 0xFF, f); } };
+    auto put16 = [f](uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); };
+
+    fputs("RIFF", f); put32(36 + numSamples * 2); fputs("WAVE", f);
+    fputs("fmt ", f); put32(16); put16(1); put16(1); put32(rate); put32(rate * 2); put16(2); put16(16);
+    fputs("data", f); put32(numSamples * 2);
+    for (uint32_t i = 0; i < numSamples; ++i) {
+        put16(static_cast<uint16_t>(i & 0x7FFF));
+    }
+    fclose(f);
+}
+
+TEST_CASE("Common: Audio stream replays WAV into buffer queue")
+{
+    constexpr int blockLen = 100;
+    WriteRampWav(s_wavPath, 1000, 16000);
+    REQUIRE(hal_audio_init(16000, 32) == 0);
+    REQUIRE(audio_stubs_set_wav_source(s_wavPath, 0) == 0);
+
+    std::vector<int16_t> storage(3 * blockLen);
+    int16_t* buffers[] = {&storage[0], &storage[blockLen], &storage[2 * blockLen]};
+
+    uint32_t callbacks = 0;
+    auto cb = [](const audio_block_t*, void* user) { ++*static_cast<uint32_t*>(user); };
+    REQUIRE(hal_audio_stream_start(buffers, 3, blockLen, cb, &callbacks) == 0);
+
+    /* A second start while running is refused. */
+    REQUIRE(hal_audio_stream_start(buffers, 3, blockLen, nullptr, nullptr) != 0);
+
+    for (uint32_t b = 0; b < 12; ++b) {
+        audio_block_t block;
+        REQUIRE(hal_audio_stream_wait_block(&block) == 0);
+        REQUIRE(block.seq == b);
+        REQUIRE(block.len == blockLen);
+        /* Past the end of the file, silence. */
+        const int16_t expected = b < 10 ? static_cast<int16_t>(b * blockLen + 50) : 0;
+        REQUIRE(block.data[50] == expected);
+        hal_audio_stream_release_block(&block);
+    }
+
+    REQUIRE(callbacks == 12);
+    REQUIRE(hal_audio_stream_get_overflows() == 0);
+
+    hal_audio_stream_stop();
+    audio_stubs_set_wav_source(nullptr, 0);
+    remove(s_wavPath);
+}
+
+TEST_CASE("Common: Audio stream counts overflows")
+{
+    constexpr int blockLen = 160;
+    std::vector<int16_t> storage(2 * blockLen);
+    int16_t* buffers[] = {&storage[0], &storage[blockLen]};
+    audio_block_t held[2];
+
+    SECTION("Caller holding every buffer")
+    {
+        REQUIRE(audio_stubs_set_wav_source(nullptr, 0) == 0);
+        REQUIRE(hal_audio_stream_start(buffers, 2, blockLen, nullptr, nullptr) == 0);
+        REQUIRE(hal_audio_stream_wait_block(&held[0]) == 0);
+        REQUIRE(hal_audio_stream_wait_block(&held[1]) == 0);
+
+        audio_block_t block;
+        REQUIRE(hal_audio_stream_wait_block(&block) != 0);
+        REQUIRE(hal_audio_stream_get_overflows() == 1);
+        hal_audio_stream_stop();
+    }
+
+    SECTION("Real-time capture outrunning the consumer")
+    {
+        /* 10ms blocks at 16kHz in real time. */
+        WriteRampWav(s_wavPath, 16000, 16000);
+        REQUIRE(hal_audio_init(16000, 32) == 0);
+        REQUIRE(audio_stubs_set_wav_source(s_wavPath, 1.f) == 0);
+        REQUIRE(hal_audio_stream_start(buffers, 2, blockLen, nullptr, nullptr) == 0);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+
+        audio_block_t first;
+        audio_block_t second;
+        REQUIRE(hal_audio_stream_wait_block(&first) == 0);
+        REQUIRE(hal_audio_stream_wait_block(&second) == 0);
+        REQUIRE(first.seq == 0);
+        REQUIRE(second.seq == 1);
+        REQUIRE(hal_audio_stream_get_overflows() >= 3);
+
+        /* Released buffers are filled with later audio, after a gap. */
+        hal_audio_stream_release_block(&first);
+        hal_audio_stream_release_block(&second);
+        audio_block_t next;
+        REQUIRE(hal_audio_stream_wait_block(&next) == 0);
+        REQUIRE(next.seq > 2);
+        REQUIRE(next.data[0] == static_cast<int16_t>(next.seq * blockLen));
+
+        hal_audio_stream_stop();
+        audio_stubs_set_wav_source(nullptr, 0);
+        remove(s_wavPath);
+    }
+}
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BatchEvaluator.hpp"
+#include "EvalDataLoaders.hpp"
+
+#include <atomic>
+#include <catch.hpp>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace arm::app::eval;
+
+namespace {
+
+    /** Predicts the path's last character as label, "x" never matches. */
+    class FakePipeline : public EvalPipeline {
+    public:
+        FakePipeline(std::atomic<int>& created, std::set<std::thread::id>& threads, std::mutex& lock)
+        {
+            ++created;
+            std::lock_guard<std::mutex> guard(lock);
+            threads.insert(std::this_thread::get_id());
+        }
+
+        bool Run(const ManifestEntry& entry, ItemResult& result) override
+        {
+            StageTimer timer{result};
+            const char last = entry.path.back();
+            if (last == '!') {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            timer.Lap(StageInference);
+            result.predicted = std::string(1, last);
+            return true;
+        }
+    };
+
+} /* namespace */
+
+TEST_CASE("Common: Batch evaluator accuracy and latency")
+{
+    std::vector<ManifestEntry> entries;
+    for (int i = 0; i < 200; ++i) {
+        /* Path ends with the predicted label; every fourth item is wrong. */
+        const std::string label = (i % 2) ? "a" : "b";
+        const std::string predicted = (i % 4 == 3) ? "x" : label;
+        entries.push_back({"item" + std::to_string(i) + predicted, label});
+    }
+    entries.push_back({"broken!", "a"});
+
+    std::atomic<int> created{0};
+    std::set<std::thread::id> threads;
+    std::mutex lock;
+    BatchEvaluator evaluator{[&]() {
+        return std::unique_ptr<EvalPipeline>{new FakePipeline(created, threads, lock)};
+    }, 4};
+
+    EvalReport report;
+    std::vector<ItemResult> results;
+    REQUIRE(evaluator.Run(entries, report, &results));
+
+    REQUIRE(created == 4);
+    REQUIRE(threads.size() == 4);
+    REQUIRE(report.workers == 4);
+    REQUIRE(report.total == 201);
+    REQUIRE(report.failed == 1);
+    REQUIRE(report.correct == 150);
+    REQUIRE(report.accuracy == Approx(0.75));
+    REQUIRE(report.perLabel["a"].second == 100);
+    REQUIRE(report.perLabel["a"].first == 50);
+    REQUIRE(report.perLabel["b"].first == 100);
+
+    /* Results come back in manifest order. */
+    REQUIRE(results.size() == entries.size());
+    REQUIRE(results[3].predicted == "x");
+    REQUIRE(results[4].predicted == "b");
+    REQUIRE_FALSE(results.back().ok);
+
+    const LatencyStats& inference = report.stages[StageInference];
+    REQUIRE(inference.min >= 0.2);
+    REQUIRE(inference.min <= inference.p50);
+    REQUIRE(inference.p50 <= inference.p95);
+    REQUIRE(inference.p95 <= inference.max);
+}
+
+TEST_CASE("Common: Batch evaluator reports pipeline creation failure")
+{
+    BatchEvaluator evaluator{[]() { return std::unique_ptr<EvalPipeline>{}; }, 2};
+    EvalReport report;
+    REQUIRE_FALSE(evaluator.Run({{"a", "a"}}, report));
+    REQUIRE(report.failed == 1);
+}
+
+TEST_CASE("Common: Evaluation manifest and data loaders")
+{
+    const char* manifestPath = "eval_test_manifest.txt";
+    const char* wavPath = "eval_test.wav";
+    const char* ppmPath = "eval_test.ppm";
+
+    FILE* f = fopen(manifestPath, "w");
+    REQUIRE(f != nullptr);
+    fputs("# comment\n\neval_test.wav yes\n/abs/path.ppm,cat\n", f);
+    fclose(f);
+
+    std::vector<ManifestEntry> entries;
+    REQUIRE(ReadManifest(manifestPath, entries));
+    REQUIRE(entries.size() == 2);
+    REQUIRE(entries[0].path == "eval_test.wav");
+    REQUIRE(entries[0].label == "yes");
+    REQUIRE(entries[1].path == "/abs/path.ppm");
+    REQUIRE(entries[1].label == "cat");
+
+    /* Stereo WAV with channels (2i, 0), mixed down to i. */
+    f = fopen(wavPath, "wb");
+    REQUIRE(f != nullptr);
+    auto put32 = [f](uint32_t v) { for (int i = 0; i < 4; ++i) { fputc((v >> (8 * i)) & 0xFF, f); } };
+    auto put16 = [f](uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); };
+    fputs("RIFF", f); put32(36 + 40); fputs("WAVE", f);
+    fputs("fmt ", f); put32(16); put16(1); put16(2); put32(8000); put32(32000); put16(4); put16(16);
+    fputs("data", f); put32(40);
+    for (int i = 0; i < 10; ++i) {
+        put16(static_cast<uint16_t>(2 * i));
+        put16(0);
+    }
+    fclose(f);
+
+    std::vector<int16_t> samples;
+    uint32_t rate = 0;
+    REQUIRE(LoadWav(wavPath, samples, rate));
+    REQUIRE(rate == 8000);
+    REQUIRE(samples.size() == 10);
+    REQUIRE(samples[7] == 7);
+
+    /* 2x1 PPM, upscaled to 4x2. */
+    f = fopen(ppmPath, "wb");
+    REQUIRE(f != nullptr);
+    fputs("P6\n# test\n2 1\n255\n", f);
+    const uint8_t pixels[] = {10, 20, 30, 200, 210, 220};
+    fwrite(pixels, 1, sizeof(pixels), f);
+    fclose(f);
+
+    std::vector<uint8_t> rgb;
+    REQUIRE(LoadImageRgb(ppmPath, 4, 2, rgb));
+    REQUIRE(rgb.size() == 4 * 2 * 3);
+    REQUIRE(rgb[0] == 10);
+    REQUIRE(rgb[3 * 1 + 2] == 30);
+    REQUIRE(rgb[3 * 2] == 200);
+    REQUIRE(rgb[3 * 7 + 2] == 220);
+
+    REQUIRE_FALSE(LoadImageRgb(wavPath, 4, 2, rgb));
+
+    remove(manifestPath);
+    remove(wavPath);
+    remove(ppmPath);
+}
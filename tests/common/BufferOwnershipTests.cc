@@ -0,0 +1,150 @@
+/* Copyright (C) 2022 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+#include "hal.h"
+
+#include <catch.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+    /* Records maintenance instead of doing it; attributes by address range. */
+    std::vector<std::string> s_ops;
+    uintptr_t s_writeThroughBase = 0;
+
+    bool FakeEnabled()
+    {
+        return true;
+    }
+
+    buffer_attr_t FakeAttribute(const void* addr, size_t)
+    {
+        const uintptr_t start = reinterpret_cast<uintptr_t>(addr);
+        return (start >= s_writeThroughBase && start < s_writeThroughBase + 0x100000) ?
+               BUFFER_ATTR_WRITE_THROUGH : BUFFER_ATTR_WRITE_BACK;
+    }
+
+    void FakeCleanRange(void*, size_t) { s_ops.push_back("clean"); }
+    void FakeInvalidateRange(void*, size_t) { s_ops.push_back("invalidate"); }
+    void FakeCleanInvalidateRange(void*, size_t) { s_ops.push_back("clean_invalidate"); }
+    void FakeCleanAll() { s_ops.push_back("clean_all"); }
+    void FakeCleanInvalidateAll() { s_ops.push_back("clean_invalidate_all"); }
+
+    const buffer_cache_ops_t s_fakeOps = {
+        FakeEnabled,
+        FakeAttribute,
+        FakeCleanRange,
+        FakeInvalidateRange,
+        FakeCleanInvalidateRange,
+        FakeCleanAll,
+        FakeCleanInvalidateAll
+    };
+
+    alignas(32) uint8_t s_small[4 * 1024];
+    alignas(32) uint8_t s_frame[256 * 1024];
+    alignas(32) uint8_t s_model[1024];
+
+    /* Fake cache, with a small and a large write-back region registered. */
+    struct OwnershipFixture {
+        int small;
+        int frame;
+
+        OwnershipFixture()
+        {
+            buffer_set_cache_ops(&s_fakeOps);
+            buffer_reset_cache_stats();
+            s_ops.clear();
+            small = buffer_register("small", s_small, sizeof(s_small), BUFFER_ATTR_AUTO);
+            frame = buffer_register("frame", s_frame, sizeof(s_frame), BUFFER_ATTR_WRITE_BACK);
+        }
+
+        ~OwnershipFixture()
+        {
+            buffer_unregister(small);
+            buffer_unregister(frame);
+            buffer_set_cache_ops(nullptr);
+        }
+    };
+
+} /* namespace */
+
+TEST_CASE("Common: Buffer ownership registration")
+{
+    OwnershipFixture f;
+    REQUIRE(f.small >= 0);
+    REQUIRE(f.frame >= 0);
+    REQUIRE(buffer_register("small", s_small, sizeof(s_small), BUFFER_ATTR_AUTO) == f.small);
+    REQUIRE(buffer_attribute(f.small) == BUFFER_ATTR_WRITE_BACK);
+    REQUIRE(buffer_owner(f.small) == BUFFER_AGENT_CPU);
+    REQUIRE(buffer_find(s_small + 100, 200) == f.small);
+    REQUIRE(buffer_find(s_small + 100, sizeof(s_small)) == -1);
+}
+
+TEST_CASE("Common: Buffer ownership maintains small regions by address")
+{
+    OwnershipFixture f;
+    buffer_acquire(f.small, BUFFER_AGENT_NPU, BUFFER_ACCESS_WRITE);
+    buffer_acquire(f.small, BUFFER_AGENT_CPU, BUFFER_ACCESS_READ);
+    REQUIRE(s_ops == std::vector<std::string>{"clean", "invalidate"});
+
+    /* The CPU only read it: handing it over again needs nothing. */
+    buffer_acquire(f.small, BUFFER_AGENT_NPU, BUFFER_ACCESS_READ);
+    buffer_acquire(f.small, BUFFER_AGENT_CPU, BUFFER_ACCESS_READ);
+    REQUIRE(s_ops.size() == 2);
+    REQUIRE(buffer_owner(f.small) == BUFFER_AGENT_CPU);
+
+    buffer_cache_stats_t stats;
+    buffer_get_cache_stats(&stats);
+    REQUIRE(stats.ranged_ops == 2);
+    REQUIRE(stats.global_ops == 0);
+    REQUIRE(stats.skipped == 2);
+    REQUIRE(stats.cost_ns == 2 * (sizeof(s_small) / 32) * BUFFER_CACHE_NS_PER_LINE);
+}
+
+TEST_CASE("Common: Buffer ownership maintains large regions globally")
+{
+    OwnershipFixture f;
+    buffer_acquire(f.frame, BUFFER_AGENT_DMA, BUFFER_ACCESS_OVERWRITE);
+    REQUIRE(s_ops == std::vector<std::string>{"clean_invalidate_all"});
+
+    /* The global operation left no dirty lines of the small region. */
+    buffer_acquire(f.small, BUFFER_AGENT_NPU, BUFFER_ACCESS_READ);
+    REQUIRE(s_ops.size() == 1);
+
+    buffer_acquire(f.frame, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
+    REQUIRE(s_ops.size() == 2);
+    REQUIRE(s_ops.back() == "clean_invalidate_all");
+}
+
+TEST_CASE("Common: Buffer ownership skips write-through, non-cacheable and read-only regions")
+{
+    OwnershipFixture f;
+    buffer_unregister(f.frame);
+    s_writeThroughBase = reinterpret_cast<uintptr_t>(s_frame);
+    f.frame = buffer_register("frame", s_frame, sizeof(s_frame), BUFFER_ATTR_AUTO);
+    s_writeThroughBase = 0;
+    REQUIRE(buffer_attribute(f.frame) == BUFFER_ATTR_WRITE_THROUGH);
+
+    /* Nothing to clean before the device writes, only to invalidate after. */
+    buffer_acquire(f.frame, BUFFER_AGENT_DMA, BUFFER_ACCESS_OVERWRITE);
+    REQUIRE(s_ops.empty());
+    buffer_acquire(f.frame, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
+    REQUIRE(s_ops == std::vector<std::string>{"clean_invalidate_all"});
+
+    const int model = buffer_register("model", s_model, sizeof(s_model), BUFFER_ATTR_READ_ONLY);
+    buffer_unregister(f.small);
+    f.small = buffer_register("small", s_small, sizeof(s_small), BUFFER_ATTR_NON_CACHEABLE);
+    buffer_acquire(f.small, BUFFER_AGENT_NPU, BUFFER_ACCESS_WRITE);
+    buffer_acquire(model, BUFFER_AGENT_NPU, BUFFER_ACCESS_WRITE);
+    buffer_acquire(f.small, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
+    buffer_acquire(model, BUFFER_AGENT_CPU, BUFFER_ACCESS_WRITE);
+    REQUIRE(s_ops.size() == 1);
+    buffer_unregister(model);
+}
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "CascadeScheduler.hpp"
+
+#include <catch.hpp>
+
+namespace {
+
+    /* Model stand-in that only counts inferences. */
+    class CountingModel : public arm::app::Model {
+    public:
+        bool RunInference() override
+        {
+            ++m_inferences;
+            return m_succeed;
+        }
+
+        uint32_t m_inferences{0};
+        bool m_succeed{true};
+
+    protected:
+        const tflite::MicroOpResolver& GetOpResolver() override
+        {
+            return m_opResolver;
+        }
+
+        bool EnlistOperations() override
+        {
+            return true;
+        }
+
+    private:
+        tflite::MicroMutableOpResolver<1> m_opResolver;
+    };
+
+    class CountingPreProcess : public arm::app::BasePreProcess {
+    public:
+        bool DoPreProcess(const void* input, size_t inputSize) override
+        {
+            m_lastInput = input;
+            m_lastInputSize = inputSize;
+            return true;
+        }
+
+        const void* m_lastInput{nullptr};
+        size_t m_lastInputSize{0};
+    };
+
+    /* Post-processing producing a fixed sequence of scores, one per call. */
+    class ScorePostProcess : public arm::app::BasePostProcess {
+    public:
+        explicit ScorePostProcess(std::vector<float> scores): m_scores(std::move(scores)) {}
+
+        bool DoPostProcess() override
+        {
+            m_score = m_scores[m_calls++ % m_scores.size()];
+            return true;
+        }
+
+        float m_score{0.f};
+        size_t m_calls{0};
+
+    private:
+        std::vector<float> m_scores;
+    };
+
+} /* namespace */
+
+TEST_CASE("Common: Cascade scheduler gates expensive stage")
+{
+    CountingModel cheapModel;
+    CountingModel bigModel;
+    CountingPreProcess cheapPre;
+    CountingPreProcess bigPre;
+    ScorePostProcess cheapPost({0.1f, 0.9f, 0.2f, 0.8f});
+    ScorePostProcess bigPost({1.f});
+
+    arm::app::CascadeScheduler cascade;
+    REQUIRE(cascade.AddStage("cheap", cheapModel, cheapPre, cheapPost,
+                             [&]() { return cheapPost.m_score > 0.5f; }));
+    REQUIRE(cascade.AddStage("big", bigModel, bigPre, bigPost));
+    REQUIRE(cascade.GetNumStages() == 2);
+
+    const uint8_t frame[16] = {};
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(cascade.Run(frame, sizeof(frame)));
+        REQUIRE(cascade.GetNumStagesRun() == ((i % 2) ? 2 : 1));
+    }
+
+    REQUIRE(cheapModel.m_inferences == 4);
+    REQUIRE(bigModel.m_inferences == 2);
+    REQUIRE(cascade.GetRunCount(0) == 4);
+    REQUIRE(cascade.GetRunCount(1) == 2);
+    REQUIRE(cascade.GetFrameCount() == 4);
+
+    /* All stages see the same shared input. */
+    REQUIRE(cheapPre.m_lastInput == frame);
+    REQUIRE(bigPre.m_lastInput == frame);
+    REQUIRE(bigPre.m_lastInputSize == sizeof(frame));
+}
+
+TEST_CASE("Common: Cascade scheduler rate limits stages")
+{
+    CountingModel cheapModel;
+    CountingModel bigModel;
+    CountingPreProcess cheapPre;
+    CountingPreProcess bigPre;
+    ScorePostProcess cheapPost({1.f});
+    ScorePostProcess bigPost({1.f});
+
+    arm::app::CascadeScheduler cascade;
+    REQUIRE(cascade.AddStage("cheap", cheapModel, cheapPre, cheapPost));
+    REQUIRE(cascade.AddStage("big", bigModel, bigPre, bigPost, nullptr, 3));
+
+    const uint8_t frame[4] = {};
+    for (int i = 0; i < 7; ++i) {
+        REQUIRE(cascade.Run(frame, sizeof(frame)));
+    }
+
+    REQUIRE(cheapModel.m_inferences == 7);
+    REQUIRE(bigModel.m_inferences == 3);
+
+    cascade.Reset();
+    REQUIRE(cascade.GetFrameCount() == 0);
+    REQUIRE(cascade.GetRunCount(1) == 0);
+    REQUIRE(cascade.GetRunCount(2) == 0);
+}
+
+TEST_CASE("Common: Cascade scheduler reports stage failure")
+{
+    CountingModel model;
+    CountingPreProcess pre;
+    ScorePostProcess post({1.f});
+    model.m_succeed = false;
+
+    arm::app::CascadeScheduler cascade;
+    REQUIRE(cascade.AddStage("failing", model, pre, post));
+
+    const uint8_t frame[4] = {};
+    REQUIRE_FALSE(cascade.Run(frame, sizeof(frame)));
+    REQUIRE(cascade.GetRunCount(0) == 0);
+}
+
+TEST_CASE("Common: Cascade scheduler adapts pre-processing arguments")
+{
+    CountingModel model;
+    CountingPreProcess pre;
+    ScorePostProcess post({1.f});
+
+    /* Stand-in for a pre-processor whose second argument is an inference index. */
+    size_t inferenceIndex = 5;
+    arm::app::CascadeScheduler cascade;
+    REQUIRE(cascade.AddStage("adapted", model,
+                             [&](const void* input, size_t) {
+                                 return pre.DoPreProcess(input, inferenceIndex);
+                             },
+                             post));
+    REQUIRE_FALSE(cascade.AddStage("empty", model, arm::app::CascadePreProcess{}, post));
+
+    const uint8_t frame[4] = {};
+    REQUIRE(cascade.Run(frame, sizeof(frame)));
+    REQUIRE(pre.m_lastInput == frame);
+    REQUIRE(pre.m_lastInputSize == inferenceIndex);
+}
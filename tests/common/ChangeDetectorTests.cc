@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ChangeDetector.hpp"
+
+#include <catch.hpp>
+#include <vector>
+
+using arm::app::image::ChangeDetector;
+using arm::app::image::ChangeDetectorParams;
+
+TEST_CASE("Sum of absolute differences")
+{
+    std::vector<uint8_t> a(37);
+    std::vector<uint8_t> b(37);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<uint8_t>(i * 7);
+        b[i] = static_cast<uint8_t>(255 - i * 3);
+    }
+
+    /* Odd lengths exercise the tail handling. */
+    for (uint32_t len : {0u, 1u, 3u, 4u, 15u, 16u, 17u, 37u}) {
+        uint32_t ref = 0;
+        for (uint32_t i = 0; i < len; ++i) {
+            ref += a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        }
+        REQUIRE(ChangeDetector::SumAbsDiffU8(a.data(), b.data(), len) == ref);
+    }
+    REQUIRE(ChangeDetector::SumAbsDiffU8(a.data(), a.data(), a.size()) == 0);
+}
+
+TEST_CASE("Change detection skips unchanged frames")
+{
+    constexpr uint32_t cols = 64;
+    constexpr uint32_t rows = 48;
+    ChangeDetectorParams params;
+    params.refreshInterval = 0;
+    ChangeDetector detector(cols, rows, 3, params);
+
+    std::vector<uint8_t> frame(cols * rows * 3);
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<uint8_t>((i * 31) & 0xFF);
+    }
+
+    /* Without a reference, the first frame is always a change. */
+    REQUIRE(detector.HasChanged(frame.data()));
+
+    /* Small noise stays under the threshold. */
+    for (size_t i = 0; i < frame.size(); i += 2) {
+        frame[i] = static_cast<uint8_t>(frame[i] ^ 1);
+    }
+    REQUIRE(!detector.HasChanged(frame.data()));
+    REQUIRE(detector.GetLastChangedBlocks() == 0);
+
+    /* A bright square in one corner changes a single block. */
+    for (uint32_t y = 0; y < 16; ++y) {
+        for (uint32_t x = 0; x < 16 * 3; ++x) {
+            frame[y * cols * 3 + x] = 0xFF;
+        }
+    }
+    REQUIRE(detector.HasChanged(frame.data()));
+    REQUIRE(detector.GetLastChangedBlocks() >= 1);
+
+    /* The changed frame is the new reference. */
+    REQUIRE(!detector.HasChanged(frame.data()));
+
+    REQUIRE(detector.GetExecutedCount() == 2);
+    REQUIRE(detector.GetSkippedCount() == 2);
+
+    detector.Reset();
+    REQUIRE(detector.GetExecutedCount() == 0);
+    REQUIRE(detector.GetSkippedCount() == 0);
+    REQUIRE(detector.HasChanged(frame.data()));
+}
+
+TEST_CASE("Change detection forces a refresh")
+{
+    ChangeDetectorParams params;
+    params.refreshInterval = 3;
+    ChangeDetector detector(32, 32, 1, params);
+
+    std::vector<uint8_t> frame(32 * 32, 100);
+    const std::vector<bool> expected{true, false, false, true, false, false, true};
+    for (const bool change : expected) {
+        REQUIRE(detector.HasChanged(frame.data()) == change);
+    }
+}
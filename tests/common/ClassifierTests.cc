@@ -22,7 +22,8 @@
 template<typename T>
 void test_classifier_result(std::vector<std::pair<uint32_t, T>>& selectedResults, T defaultTensorValue) {
     int dimArray[] = {1, 1001};
-    std::vector <std::string> labels(1001);
+    std::vector<arm::app::LabelView> labelViews(1001);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<T> outputVec(1001, defaultTensorValue);
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
     TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(outputVec.data(), dims, 1, 0);
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ImageTensorConverter.hpp"
+#include "ImageUtils.hpp"
+
+#include <algorithm>
+#include <catch.hpp>
+#include <cmath>
+#include <vector>
+
+using arm::app::image::ImageToTensorConverter;
+using arm::app::image::PixelScaling;
+
+TEST_CASE("Common: Image to tensor LUT matches float quantisation")
+{
+    const float scale = 0.0039215686f;
+    const int offset = -128;
+    std::vector<int8_t> tensorData(4 * 4);
+    int dims[] = {1, 16};
+    TfLiteTensor tensor = tflite::testing::CreateQuantizedTensor(
+                            tensorData.data(), tflite::testing::IntArrayFromInts(dims),
+                            scale, offset);
+
+    ImageToTensorConverter converter{&tensor, false, PixelScaling::Normalised};
+
+    for (int pixel = 0; pixel < 256; ++pixel) {
+        /* The per-pixel computation VWW pre-processing used to do. */
+        const float quantised = (pixel / 255.0f) / scale + offset;
+        const auto expected = static_cast<int8_t>(
+            std::min<float>(INT8_MAX, std::max<float>(INT8_MIN, quantised)));
+        REQUIRE(static_cast<int8_t>(converter.MapPixel(pixel)) == expected);
+    }
+
+    std::vector<uint8_t> image(16);
+    for (size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<uint8_t>(i * 17);
+    }
+    REQUIRE(converter.Convert(image.data(), image.size()));
+    for (size_t i = 0; i < image.size(); ++i) {
+        REQUIRE(static_cast<uint8_t>(tensorData[i]) == converter.MapPixel(image[i]));
+    }
+}
+
+TEST_CASE("Common: Image to tensor centred and raw modes")
+{
+    std::vector<uint8_t> image = {0, 1, 127, 128, 129, 255};
+    std::vector<uint8_t> tensorData(image.size());
+    int dims[] = {1, static_cast<int>(image.size())};
+    TfLiteTensor tensor = tflite::testing::CreateQuantizedTensor(
+                            tensorData.data(), tflite::testing::IntArrayFromInts(dims), 1, 0);
+
+    SECTION("Centred matches ConvertImgToInt8")
+    {
+        std::vector<uint8_t> expected = image;
+        arm::app::image::ConvertImgToInt8(expected.data(), expected.size());
+
+        ImageToTensorConverter converter{&tensor, false, PixelScaling::Centred};
+        REQUIRE(converter.Convert(image.data(), image.size()));
+        REQUIRE(tensorData == expected);
+    }
+
+    SECTION("Raw copies")
+    {
+        ImageToTensorConverter converter{&tensor, false, PixelScaling::Raw};
+        REQUIRE(converter.Convert(image.data(), image.size()));
+        REQUIRE(tensorData == image);
+    }
+
+    SECTION("Source larger than the tensor")
+    {
+        std::vector<uint8_t> big(2 * image.size(), 7);
+        ImageToTensorConverter converter{&tensor, false, PixelScaling::Raw};
+        REQUIRE(converter.Convert(big.data(), big.size()));
+        REQUIRE(tensorData == std::vector<uint8_t>(image.size(), 7));
+    }
+
+    SECTION("Invalid input")
+    {
+        ImageToTensorConverter converter{&tensor, false, PixelScaling::Raw};
+        REQUIRE_FALSE(converter.Convert(nullptr, image.size()));
+    }
+}
+
+TEST_CASE("Common: Image to tensor grayscale conversion")
+{
+    const std::vector<uint8_t> rgb = {
+        0,   0,   0,
+        255, 255, 255,
+        255, 0,   0,
+        0,   255, 0,
+        0,   0,   255,
+        10,  200, 90
+    };
+    const size_t numPixels = rgb.size() / 3;
+    std::vector<uint8_t> tensorData(numPixels);
+    int dims[] = {1, static_cast<int>(numPixels)};
+    TfLiteTensor tensor = tflite::testing::CreateQuantizedTensor(
+                            tensorData.data(), tflite::testing::IntArrayFromInts(dims), 1, 0);
+
+    ImageToTensorConverter converter{&tensor, true, PixelScaling::Raw};
+    REQUIRE(converter.Convert(rgb.data(), numPixels));
+
+    for (size_t i = 0; i < numPixels; ++i) {
+        /* Within one step of the floating point BT.601 weighting. */
+        const float gray = 0.299f * rgb[3 * i] + 0.587f * rgb[3 * i + 1] + 0.114f * rgb[3 * i + 2];
+        REQUIRE(std::abs(static_cast<float>(tensorData[i]) - gray) <= 1.0f);
+    }
+    REQUIRE(tensorData[0] == 0);
+    REQUIRE(tensorData[1] == 255);
+
+    /* The whole-image helper uses the same kernel. */
+    std::vector<uint8_t> gray(numPixels);
+    arm::app::image::RgbToGrayscale(rgb.data(), gray.data(), numPixels);
+    REQUIRE(gray == tensorData);
+}
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LabelTable.hpp"
+
+#include <algorithm>
+#include <catch.hpp>
+
+namespace {
+    constexpr arm::app::LabelView testLabels[] = {"yes", "no", "up", "down", ""};
+} /* namespace */
+
+TEST_CASE("Label views compare by content")
+{
+    const char yes[] = "yes";
+    arm::app::LabelView view(yes, 3);
+
+    REQUIRE(view == testLabels[0]);
+    REQUIRE(view == "yes");
+    REQUIRE(view != "ye");
+    REQUIRE(view != "yess");
+    REQUIRE(view != testLabels[1]);
+    REQUIRE(view.ToString() == "yes");
+    REQUIRE(testLabels[4].empty());
+    REQUIRE(arm::app::LabelView() == "");
+}
+
+TEST_CASE("Label table indexes generated labels")
+{
+    constexpr arm::app::LabelTable table(testLabels, sizeof(testLabels) / sizeof(testLabels[0]));
+    static_assert(table.size() == 5, "Label table size is not known at compile time");
+
+    REQUIRE(table[2] == "up");
+    REQUIRE(std::string(table[3].c_str()) == "down");
+
+    auto it = std::find(table.begin(), table.end(), "no");
+    REQUIRE(it != table.end());
+    REQUIRE(it - table.begin() == 1);
+    REQUIRE(std::find(table.begin(), table.end(), "left") == table.end());
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "log_macros.h"
+
+#include <catch.hpp>
+
+#if defined(LOG_DEFERRED)
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+    /* Runs log_deferred_flush with stdout captured. */
+    std::string FlushToString(size_t& printed)
+    {
+        std::fflush(stdout);
+        const int savedStdout = dup(fileno(stdout));
+        FILE* capture = std::tmpfile();
+        dup2(fileno(capture), fileno(stdout));
+
+        printed = log_deferred_flush();
+
+        std::fflush(stdout);
+        dup2(savedStdout, fileno(stdout));
+        close(savedStdout);
+
+        std::string text;
+        std::rewind(capture);
+        int ch;
+        while ((ch = std::fgetc(capture)) != EOF) {
+            text += static_cast<char>(ch);
+        }
+        std::fclose(capture);
+        return text;
+    }
+
+} /* namespace */
+
+TEST_CASE("Deferred log messages are formatted when flushed", "[log]")
+{
+    size_t printed = 0;
+    FlushToString(printed);
+
+    std::string label = "yes";
+    log_deferred_record(LOG_LEVEL_INFO, "Inference %zu/%zu\n", static_cast<size_t>(3), static_cast<size_t>(10));
+    log_deferred_record(LOG_LEVEL_WARN, "%" PRIu32 " strides dropped, %s\n", static_cast<uint32_t>(2), "late");
+    log_deferred_record(LOG_LEVEL_INFO, "label: %s, score: %.3f, id %-4d|%5.1f%%\n", label.c_str(), 0.87654, -7, 12.25);
+    log_deferred_record(LOG_LEVEL_DEBUG, "%*d|%.*s|%c|%hhd|%lx\n", 6, 42, 2, "abc", 'z', 300, 0xbeefUL);
+
+    /* Strings are copied when recorded. */
+    label = "no!";
+
+    const std::string text = FlushToString(printed);
+    REQUIRE(4 == printed);
+    REQUIRE(text ==
+            "INFO - Inference 3/10\n"
+            "WARN - 2 strides dropped, late\n"
+            "INFO - label: yes, score: 0.877, id -7  | 12.2%\n"
+            "DEBUG -     42|ab|z|44|beef\n");
+}
+
+TEST_CASE("Deferred log drops messages when the ring is full", "[log]")
+{
+    size_t printed = 0;
+    FlushToString(printed);
+    const uint32_t droppedBefore = log_deferred_dropped();
+
+    for (int i = 0; i < LOG_DEFERRED_RECORDS + 5; ++i) {
+        log_deferred_record(LOG_LEVEL_INFO, "message %d\n", i);
+    }
+    REQUIRE(droppedBefore + 5 == log_deferred_dropped());
+
+    const std::string text = FlushToString(printed);
+    REQUIRE(LOG_DEFERRED_RECORDS == printed);
+    REQUIRE(text.find("INFO - message 0\n") == 0);
+    REQUIRE(text.find("5 log messages dropped") != std::string::npos);
+
+    /* Space again once flushed. */
+    log_deferred_record(LOG_LEVEL_INFO, "after\n");
+    REQUIRE("INFO - after\n" == FlushToString(printed));
+}
+
+TEST_CASE("Long strings are truncated to the record's space", "[log]")
+{
+    size_t printed = 0;
+    FlushToString(printed);
+
+    const std::string longString(2 * LOG_DEFERRED_STR_BYTES, 'x');
+    log_deferred_record(LOG_LEVEL_INFO, "%s|%s|%d\n", longString.c_str(), "tail", 5);
+
+    const std::string expected = "INFO - " + std::string(LOG_DEFERRED_STR_BYTES - 1, 'x') + "||5\n";
+    REQUIRE(expected == FlushToString(printed));
+}
+
+#endif /* defined(LOG_DEFERRED) */
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MemoryTracker.hpp"
+#include "Profiler.hpp"
+
+#include <catch.hpp>
+#include <memory>
+
+namespace memory = arm::app::memory;
+
+TEST_CASE("Common: Memory tracker")
+{
+    /* Stack painting needs the target's linker symbols. */
+    REQUIRE(!memory::PaintStack());
+    REQUIRE(memory::GetStackHighWater() == 0);
+
+#if MEMORY_PROFILING
+    SECTION("Heap counters") {
+        const memory::HeapCounters before = memory::GetHeapCounters();
+        const std::size_t savedPeak = memory::ResetHeapPeak();
+
+        auto* small = new uint32_t[4];
+        auto* large = new uint8_t[100];
+        delete[] small;
+
+        memory::HeapCounters after = memory::GetHeapCounters();
+        REQUIRE(after.allocations - before.allocations == 2);
+        REQUIRE(after.allocatedBytes - before.allocatedBytes == 116);
+        REQUIRE(after.frees - before.frees == 1);
+        REQUIRE(after.inUseBytes - before.inUseBytes == 100);
+        REQUIRE(after.peakBytes - before.inUseBytes == 116);
+
+        delete[] large;
+        after = memory::GetHeapCounters();
+        REQUIRE(after.inUseBytes == before.inUseBytes);
+
+        memory::RestoreHeapPeak(savedPeak);
+        REQUIRE(memory::GetHeapCounters().peakBytes >= savedPeak);
+    }
+
+    SECTION("Profiler reports allocations per region") {
+        hal_platform_init();
+        arm::app::Profiler profiler{"heap"};
+
+        profiler.StartProfiling("allocating");
+        auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[64]);
+        profiler.StopProfiling();
+        buffer.reset();
+
+        profiler.StartProfiling("steady");
+        profiler.StopProfiling();
+
+        std::vector<arm::app::ProfileResult> results;
+        profiler.GetAllResultsAndReset(results);
+        REQUIRE(results.size() == 2);
+
+        auto getStat = [](const arm::app::ProfileResult& result, const std::string& name) {
+            for (const auto& stat : result.data) {
+                if (stat.name == name) {
+                    return stat.total;
+                }
+            }
+            FAIL("Missing statistic " << name);
+            return std::uint64_t{0};
+        };
+
+        REQUIRE(results[0].name == "allocating");
+        REQUIRE(getStat(results[0], "Heap allocations") == 1);
+        REQUIRE(getStat(results[0], "Heap allocated") == 64);
+        REQUIRE(getStat(results[0], "Heap peak") == 64);
+
+        REQUIRE(results[1].name == "steady");
+        REQUIRE(getStat(results[1], "Heap allocations") == 0);
+        REQUIRE(getStat(results[1], "Heap peak") == 0);
+    }
+#else
+    SECTION("Counters stay at zero without MEMORY_PROFILING") {
+        auto buffer = std::unique_ptr<uint8_t[]>(new uint8_t[64]);
+        const memory::HeapCounters counters = memory::GetHeapCounters();
+        REQUIRE(counters.allocations == 0);
+        REQUIRE(counters.allocatedBytes == 0);
+        REQUIRE(counters.peakBytes == 0);
+    }
+#endif /* MEMORY_PROFILING */
+}
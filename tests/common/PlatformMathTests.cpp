@@ -612,6 +612,47 @@ TEST_CASE("Test DotProductF32")
     CHECK(dot_prod == expectedResult);
 }
 
+TEST_CASE("Test MatMulF32")
+{
+    /* 2x3 times 3x2, then a product with inner dimension longer than a block. */
+    std::vector<float> inputA
+            {1, 2, 3,
+             4, 5, 6};
+    std::vector<float> inputB
+            {7, 8,
+             9, 10,
+             11, 12};
+    std::vector<float> expectedResult
+            {58, 64,
+             139, 154};
+    std::vector<float> output(4);
+
+    REQUIRE(arm::app::math::MathUtils::MatMulF32(inputA.data(), 2, 3, inputB.data(), 2, output.data()));
+    for (size_t i = 0; i < output.size(); i++)
+        CHECK(expectedResult[i] == Approx(output[i]));
+
+    const uint32_t rows = 3;
+    const uint32_t inner = 100;
+    const uint32_t cols = 5;
+    std::vector<float> matA(rows * inner);
+    std::vector<float> matB(inner * cols);
+    for (size_t i = 0; i < matA.size(); i++)
+        matA[i] = static_cast<float>(i % 7) - 3;
+    for (size_t i = 0; i < matB.size(); i++)
+        matB[i] = static_cast<float>(i % 5) * 0.5f;
+
+    std::vector<float> matC(rows * cols);
+    REQUIRE(arm::app::math::MathUtils::MatMulF32(matA.data(), rows, inner, matB.data(), cols, matC.data()));
+    for (uint32_t i = 0; i < rows; i++) {
+        for (uint32_t j = 0; j < cols; j++) {
+            float expected = 0;
+            for (uint32_t k = 0; k < inner; k++)
+                expected += matA[i * inner + k] * matB[k * cols + j];
+            CHECK(expected == Approx(matC[i * cols + j]));
+        }
+    }
+}
+
 TEST_CASE("Test ComplexMagnitudeSquaredF32")
 {
     /*Test  Constants: */
@@ -704,3 +745,106 @@ TEST_CASE("Test SoftmaxF32")
         TestSoftmaxF32(input, expectedOutput);
     }
 }
+
+TEST_CASE("Test Float16 rounding")
+{
+    using arm::app::math::float16;
+
+    /* Exact, rounded to nearest, ties to even, subnormal and out of range values. */
+    std::vector<float> input
+            {1.0, -2.5, 0.1, 2049, 2051, 65504, 1e-7, 70000};
+    std::vector<float> expectedResult
+            {1.0, -2.5, 0.0999755859375, 2048, 2052, 65504, 1.1920928955078125e-7,
+             std::numeric_limits<float>::infinity()};
+
+    for (size_t i = 0; i < input.size(); i++) {
+        CHECK(expectedResult[i] == static_cast<float>(float16(input[i])));
+    }
+}
+
+TEST_CASE("Test FftF16")
+{
+    using arm::app::math::float16;
+    const uint16_t fftLen = 64;
+
+    std::vector<float> inputF32(fftLen);
+    for (size_t i = 0; i < fftLen; i++) {
+        inputF32[i] = arm::app::math::MathUtils::SineF32(0.3f * i) * 0.5f + (i % 3) * 0.1f;
+    }
+    std::vector<float16> input(inputF32.begin(), inputF32.end());
+
+    arm::app::math::FftInstance fftInstance;
+    std::vector<float> expectedResult(fftLen);
+    arm::app::math::MathUtils::FftInitF32(fftLen, fftInstance);
+    arm::app::math::MathUtils::FftF32(inputF32, expectedResult, fftInstance);
+
+    arm::app::math::FftInstanceF16 fftInstanceF16;
+    std::vector<float16> output(fftLen);
+    arm::app::math::MathUtils::FftInitF16(fftLen, fftInstanceF16);
+    arm::app::math::MathUtils::FftF16(input, output, fftInstanceF16);
+
+    /* Half precision keeps about 3 significant digits of the largest bins. */
+    const float tolerance = 0.05;
+    for (size_t i = 0; i < fftLen; i++) {
+        CHECK(static_cast<float>(output[i]) == Approx(expectedResult[i]).margin(tolerance));
+    }
+}
+
+TEST_CASE("Test VecLogarithmF16")
+{
+    using arm::app::math::float16;
+    std::vector<float16> input {0.5, 1, M_PI, M_E};
+    std::vector<float> expectedResult {-0.693147181, 0, 1.144729886, 1};
+    std::vector<float16> output(input.size());
+
+    arm::app::math::MathUtils::VecLogarithmF16(input, output);
+
+    for (size_t i = 0; i < input.size(); i++) {
+        CHECK(static_cast<float>(output[i]) == Approx(expectedResult[i]).margin(1e-3));
+    }
+}
+
+TEST_CASE("Test DotProductF16")
+{
+    using arm::app::math::float16;
+    std::vector<float16> inputA {1, 2, 3, 0.5, 0.25, 0};
+    std::vector<float16> inputB {1, 1, 2, 4, 4, 8};
+
+    const float16 dotProd = arm::app::math::MathUtils::DotProductF16(inputA.data(), inputB.data(), inputA.size());
+    CHECK(static_cast<float>(dotProd) == 12);
+}
+
+TEST_CASE("Test ComplexMagnitudeSquaredF16")
+{
+    using arm::app::math::float16;
+    std::vector<float16> input {0.0, 0.0, 0.5, 0.5, 1, 1, 3, 4};
+    std::vector<float> expectedResult {0.0, 0.5, 2, 25};
+    std::vector<float16> output(input.size() / 2);
+
+    REQUIRE(arm::app::math::MathUtils::ComplexMagnitudeSquaredF16(input.data(), input.size(),
+                                                                  output.data(), output.size()));
+
+    for (size_t i = 0; i < output.size(); i++) {
+        CHECK(static_cast<float>(output[i]) == expectedResult[i]);
+    }
+}
+
+TEST_CASE("Test SoftmaxF16")
+{
+    using arm::app::math::float16;
+    std::vector<float16> output {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+    const std::vector<float> expectedOutput {
+        7.80134161e-05, 2.12062451e-04,
+        5.76445508e-04, 1.56694135e-03,
+        4.25938820e-03, 1.15782175e-02,
+        3.14728583e-02, 8.55520989e-02,
+        2.32554716e-01, 6.32149258e-01
+    };
+
+    arm::app::math::MathUtils::SoftmaxF16(output);
+
+    REQUIRE(output.size() == expectedOutput.size());
+    for (size_t i = 0; i < expectedOutput.size(); ++i) {
+        CHECK(static_cast<float>(output[i]) == Approx(expectedOutput[i]).epsilon(2e-3));
+    }
+}
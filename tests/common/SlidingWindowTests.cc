@@ -264,3 +264,90 @@ TEST_CASE("Common: Next window data index")
         REQUIRE(slider.NextWindowStartIndex() == 6);
     }
 }
+
+TEST_CASE("Common: Window view matches sliding window")
+{
+    std::vector<int> test{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    for (size_t windowSize = 1; windowSize <= 11; ++windowSize) {
+        for (size_t stride = 1; stride <= 4; ++stride) {
+            auto slider = arm::app::audio::SlidingWindow<int>(test.data(), test.size(), windowSize, stride);
+            auto view = arm::app::audio::WindowView<int>(test.data(), test.size(), windowSize, stride);
+
+            size_t count = 0;
+            while (slider.HasNext()) {
+                const int* expected = slider.Next();
+                REQUIRE(view.HasNext());
+                const auto window = view.Next();
+                REQUIRE(window.data() == expected);
+                REQUIRE(window.size() == windowSize);
+                REQUIRE(view.Index() == slider.Index());
+                ++count;
+            }
+            REQUIRE(!view.HasNext());
+            REQUIRE(view.Next().empty());
+            REQUIRE(view.NumWindows() == count);
+        }
+    }
+}
+
+TEST_CASE("Common: Fractional window view")
+{
+    std::vector<int> test{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    for (size_t windowSize = 1; windowSize <= 11; ++windowSize) {
+        for (size_t stride = 1; stride <= 4; ++stride) {
+            auto slider = arm::app::audio::FractionalSlidingWindow<int>(test.data(), test.size(),
+                                                                        windowSize, stride);
+            auto view = arm::app::audio::WindowView<int>(test.data(), test.size(), windowSize, stride, true);
+
+            size_t count = 0;
+            while (slider.HasNext()) {
+                const int* expected = slider.Next();
+                const auto window = view.Next();
+                REQUIRE(window.data() == expected);
+                REQUIRE(window.end() <= test.data() + test.size());
+                ++count;
+            }
+            REQUIRE(view.NumWindows() == count);
+        }
+    }
+
+    /* The last window is cut at the end of the data. */
+    auto view = arm::app::audio::WindowView<int>(test.data(), test.size(), 4, 3, true);
+    REQUIRE(view.NumWindows() == 3);
+    REQUIRE(view.Window(2).size() == 4);
+    view = arm::app::audio::WindowView<int>(test.data(), test.size(), 4, 4, true);
+    REQUIRE(view.NumWindows() == 3);
+    REQUIRE(view.Window(2).size() == 2);
+    REQUIRE(view.Window(2)[1] == 10);
+}
+
+TEST_CASE("Common: Window view batches")
+{
+    std::vector<int> test{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto view = arm::app::audio::WindowView<int>(test.data(), test.size(), 4, 2);
+    REQUIRE(view.NumWindows() == 4);
+
+    auto batch = view.NextBatch(3);
+    REQUIRE(batch.Count() == 3);
+    REQUIRE(batch.Stride() == 2);
+    REQUIRE(batch.WindowSize() == 4);
+    REQUIRE(batch.IsFull());
+    REQUIRE(batch[0][0] == 1);
+    REQUIRE(batch[2][0] == 5);
+    REQUIRE(batch[2][3] == 8);
+    REQUIRE(view.Index() == 2);
+
+    batch = view.NextBatch(3);
+    REQUIRE(batch.Count() == 1);
+    REQUIRE(batch[0][0] == 7);
+    REQUIRE(view.NextBatch(3).Count() == 0);
+
+    view.Reset(test.data() + 1);
+    REQUIRE(view.Next()[0] == 2);
+
+    auto fractional = arm::app::audio::WindowView<int>(test.data(), test.size(), 4, 4, true);
+    REQUIRE(!fractional.Windows(0, 3).IsFull());
+    REQUIRE(fractional.Windows(0, 2).IsFull());
+}
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SpscRing.hpp"
+#include "log_macros.h"
+
+#include <catch.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+    /* Message as sent between the cores, e.g. a KWS result. */
+    struct IpcResult {
+        uint32_t seq;
+        int32_t labelIdx;
+        float score;
+    };
+
+    /* Stands in for the MHU interrupt on the receiving core. */
+    class ThreadDoorbell {
+    public:
+        void Ring()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_rung = true;
+            }
+            m_cv.notify_one();
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_rung; });
+            m_rung = false;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        bool m_rung{false};
+    };
+
+} /* namespace */
+
+TEST_CASE("Common: SPSC ring push and pop")
+{
+    arm::app::SpscRing<IpcResult, 4> ring;
+    IpcResult item{};
+
+    REQUIRE(ring.IsEmpty());
+    REQUIRE_FALSE(ring.TryPop(item));
+    REQUIRE(ring.Capacity() == 4);
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        REQUIRE(ring.TryPush(IpcResult{i, static_cast<int32_t>(i), 0.5f}));
+    }
+    REQUIRE(ring.Size() == 4);
+    REQUIRE_FALSE(ring.TryPush(IpcResult{4, 4, 0.5f}));
+    REQUIRE(ring.GetDroppedCount() == 1);
+
+    /* Wrap around the end of the storage a few times. */
+    for (uint32_t i = 0; i < 10; ++i) {
+        REQUIRE(ring.TryPop(item));
+        REQUIRE(item.seq == i);
+        REQUIRE(ring.TryPush(IpcResult{i + 4, 0, 0.f}));
+    }
+    REQUIRE(ring.Size() == 4);
+
+    ring.Reset();
+    REQUIRE(ring.IsEmpty());
+    REQUIRE(ring.GetDroppedCount() == 0);
+}
+
+TEST_CASE("Common: SPSC ring doorbell only when consumer waits")
+{
+    arm::app::SpscRing<IpcResult, 8> ring;
+    uint32_t rings = 0;
+    arm::app::RingProducer<IpcResult, 8> producer(ring, [&]() { ++rings; });
+
+    /* Consumer busy: no notifications. */
+    REQUIRE(producer.Send(IpcResult{0, 0, 0.f}));
+    REQUIRE(producer.Send(IpcResult{1, 0, 0.f}));
+    REQUIRE(rings == 0);
+
+    /* Consumer can't sleep while data is queued. */
+    REQUIRE_FALSE(ring.ArmDoorbell());
+
+    IpcResult item{};
+    while (ring.TryPop(item)) {}
+    REQUIRE(ring.ArmDoorbell());
+
+    REQUIRE(producer.Send(IpcResult{2, 0, 0.f}));
+    REQUIRE(producer.Send(IpcResult{3, 0, 0.f}));
+    REQUIRE(rings == 1);
+    REQUIRE(producer.GetDoorbellCount() == 1);
+}
+
+TEST_CASE("Common: SPSC ring two-core emulation")
+{
+    constexpr uint32_t numMessages = 200000;
+    static arm::app::SpscRing<IpcResult, 64> ring;
+    ring.Reset();
+
+    ThreadDoorbell doorbell;
+    arm::app::RingProducer<IpcResult, 64> producer(ring, [&]() { doorbell.Ring(); });
+
+    uint32_t received = 0;
+    bool inOrder = true;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    /* "HP" core: sleeps until rung, then drains the ring. */
+    std::thread consumer([&]() {
+        IpcResult item{};
+        while (received < numMessages) {
+            while (ring.TryPop(item)) {
+                inOrder &= (item.seq == received);
+                ++received;
+            }
+            if (received < numMessages && ring.ArmDoorbell()) {
+                doorbell.Wait();
+            }
+        }
+    });
+
+    /* "HE" core: produces results, retrying when the ring is full. */
+    for (uint32_t i = 0; i < numMessages; ++i) {
+        const IpcResult result{i, static_cast<int32_t>(i % 12), 0.9f};
+        while (!producer.Send(result)) {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(received == numMessages);
+    REQUIRE(inOrder);
+    REQUIRE(ring.IsEmpty());
+    REQUIRE(producer.GetDoorbellCount() <= numMessages);
+
+    info("SPSC ring: %" PRIu32 " messages in %.3f s (%.0f msg/s), %" PRIu32 " doorbells\n",
+         numMessages, elapsed.count(), numMessages / elapsed.count(), producer.GetDoorbellCount());
+}
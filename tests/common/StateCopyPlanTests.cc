@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "StateCopyPlan.hpp"
+
+#include <catch.hpp>
+#include <cstring>
+#include <vector>
+
+using arm::app::StateCopy;
+using arm::app::StateCopyPlan;
+
+namespace {
+    /* Arena with a distinct value in every byte. */
+    std::vector<uint8_t> MakeArena(size_t bytes)
+    {
+        std::vector<uint8_t> arena(bytes);
+        for (size_t i = 0; i < bytes; ++i) {
+            arena[i] = static_cast<uint8_t>(i + 1);
+        }
+        return arena;
+    }
+} /* namespace */
+
+TEST_CASE("State copies are ordered so no output is overwritten before it is read")
+{
+    /* State A's input is state B's output, given in the order that would clobber B. */
+    std::vector<uint8_t> arena = MakeArena(12);
+    const std::vector<uint8_t> before = arena;
+    StateCopyPlan plan;
+    plan.Plan({StateCopy{&arena[0], &arena[4], 4}, StateCopy{&arena[4], &arena[8], 4}});
+    REQUIRE(plan.GetStagedBytes() == 0);
+
+    plan.Apply();
+    REQUIRE(std::memcmp(&arena[4], &before[0], 4) == 0);
+    REQUIRE(std::memcmp(&arena[8], &before[4], 4) == 0);
+}
+
+TEST_CASE("State copies in a cycle are staged")
+{
+    /* Two states swapping places. */
+    std::vector<uint8_t> arena = MakeArena(8);
+    const std::vector<uint8_t> before = arena;
+    StateCopyPlan plan;
+    plan.Plan({StateCopy{&arena[0], &arena[4], 4}, StateCopy{&arena[4], &arena[0], 4}});
+    REQUIRE(plan.GetStagedBytes() == 8);
+
+    plan.Apply();
+    REQUIRE(std::memcmp(&arena[0], &before[4], 4) == 0);
+    REQUIRE(std::memcmp(&arena[4], &before[0], 4) == 0);
+
+    /* Applying again swaps them back. */
+    plan.Apply();
+    REQUIRE(arena == before);
+}
+
+TEST_CASE("State overlapping its own input is not staged")
+{
+    std::vector<uint8_t> arena = MakeArena(6);
+    const std::vector<uint8_t> before = arena;
+    StateCopyPlan plan;
+    plan.Plan({StateCopy{&arena[0], &arena[2], 4}});
+    REQUIRE(plan.GetStagedBytes() == 0);
+
+    plan.Apply();
+    REQUIRE(std::memcmp(&arena[2], &before[0], 4) == 0);
+
+    /* Planning again replaces the previous plan. */
+    plan.Plan({});
+    plan.Apply();
+    REQUIRE(std::memcmp(&arena[2], &before[0], 4) == 0);
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "VoiceActivityDetector.hpp"
+
+#include <catch.hpp>
+#include <cmath>
+#include <vector>
+
+static std::vector<int16_t> Tone(size_t len, float amplitude, float freqRatio)
+{
+    std::vector<int16_t> out(len);
+    for (size_t i = 0; i < len; ++i) {
+        out[i] = static_cast<int16_t>(amplitude * std::sin(2 * M_PI * freqRatio * i));
+    }
+    return out;
+}
+
+TEST_CASE("Common: Energy VAD silence and tone")
+{
+    constexpr size_t blockLen = 1000;
+    arm::app::audio::EnergyVad vad(9.f, -70.f, 0);
+
+    auto quiet = Tone(blockLen, 10.f, 0.01f);
+    auto loud = Tone(blockLen, 5000.f, 0.01f);
+    std::vector<int16_t> silence(blockLen, 0);
+
+    REQUIRE_FALSE(vad.IsVoiceActive(silence.data(), silence.size()));
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+    REQUIRE(vad.IsVoiceActive(loud.data(), loud.size()));
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+
+    /* The same samples are quiet once the applied gain is accounted for. */
+    REQUIRE_FALSE(vad.IsVoiceActive(loud.data(), loud.size(), 10000.f));
+}
+
+TEST_CASE("Common: Energy VAD hangover")
+{
+    constexpr size_t blockLen = 1000;
+    arm::app::audio::EnergyVad vad(9.f, -70.f, 2);
+
+    auto quiet = Tone(blockLen, 10.f, 0.01f);
+    auto loud = Tone(blockLen, 5000.f, 0.01f);
+
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+    REQUIRE(vad.IsVoiceActive(loud.data(), loud.size()));
+    REQUIRE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+    REQUIRE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+
+    vad.Reset();
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+}
+
+TEST_CASE("Common: Energy VAD rejects high zero-crossing rate")
+{
+    constexpr size_t blockLen = 1000;
+    arm::app::audio::EnergyVad vad(9.f, -70.f, 0, 0.3f);
+
+    auto quiet = Tone(blockLen, 10.f, 0.01f);
+    std::vector<int16_t> alternating(blockLen);
+    for (size_t i = 0; i < blockLen; ++i) {
+        alternating[i] = (i % 2) ? 5000 : -5000;
+    }
+
+    REQUIRE_FALSE(vad.IsVoiceActive(quiet.data(), quiet.size()));
+    REQUIRE_FALSE(vad.IsVoiceActive(alternating.data(), alternating.size()));
+    REQUIRE(vad.GetLastZeroCrossingRate() > 0.9f);
+}
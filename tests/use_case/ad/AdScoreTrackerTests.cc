@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AdScoreTracker.hpp"
+#include "AdProcessing.hpp"
+
+#include <catch.hpp>
+#include <vector>
+
+using arm::app::AdScoreTracker;
+using arm::app::AdScoreTrackerConfig;
+using arm::app::AdVerdict;
+
+TEST_CASE("Score tracker running mean matches clip average", "[AD]")
+{
+    AdScoreTrackerConfig config;
+    config.threshold = -0.8f;
+    AdScoreTracker tracker{config};
+
+    const std::vector<float> scores = {-0.9f, -0.7f, -0.95f, -0.6f};
+    float sum = 0;
+    for (float score : scores) {
+        tracker.Update(score);
+        sum += score;
+    }
+    REQUIRE(tracker.GetWindowCount() == scores.size());
+    REQUIRE(tracker.GetScore() == Approx(sum / scores.size()));
+    REQUIRE(tracker.GetVerdict() == AdVerdict::Anomaly);
+}
+
+TEST_CASE("Score tracker hysteresis", "[AD]")
+{
+    AdScoreTrackerConfig config;
+    config.threshold = -0.5f;
+    config.hysteresis = 0.1f;
+    config.emaAlpha = 1.f;  /* Smoothed score is the last window's. */
+    config.minWindows = 2;
+    AdScoreTracker tracker{config};
+
+    /* No verdict before the minimum number of windows. */
+    REQUIRE(tracker.Update(-0.9f) == AdVerdict::Undecided);
+    REQUIRE(tracker.Update(-0.9f) == AdVerdict::Normal);
+    REQUIRE(tracker.VerdictChanged());
+
+    /* Inside the band nothing changes. */
+    REQUIRE(tracker.Update(-0.45f) == AdVerdict::Normal);
+    REQUIRE_FALSE(tracker.VerdictChanged());
+    REQUIRE(tracker.Update(-0.55f) == AdVerdict::Normal);
+
+    REQUIRE(tracker.Update(-0.3f) == AdVerdict::Anomaly);
+    REQUIRE(tracker.VerdictChanged());
+    REQUIRE(tracker.Update(-0.55f) == AdVerdict::Anomaly);
+    REQUIRE(tracker.Update(-0.65f) == AdVerdict::Normal);
+
+    tracker.Reset();
+    REQUIRE(tracker.GetVerdict() == AdVerdict::Undecided);
+    REQUIRE(tracker.GetWindowCount() == 0);
+}
+
+TEST_CASE("Score tracker exponential average and confidence", "[AD]")
+{
+    AdScoreTrackerConfig config;
+    config.threshold = -0.5f;
+    config.emaAlpha = 0.5f;
+    config.confidenceMargin = 0.2f;
+    AdScoreTracker tracker{config};
+
+    tracker.Update(-0.6f);
+    REQUIRE(tracker.GetVerdict() == AdVerdict::Normal);
+    REQUIRE_FALSE(tracker.IsConfident());
+
+    tracker.Update(-1.0f);
+    REQUIRE(tracker.GetScore() == Approx(-0.8f));
+    REQUIRE(tracker.GetMeanScore() == Approx(-0.8f));
+    REQUIRE(tracker.IsConfident());
+
+    tracker.Update(-0.2f);
+    REQUIRE(tracker.GetScore() == Approx(-0.5f));
+    REQUIRE(tracker.GetMeanScore() == Approx(-0.6f));
+    REQUIRE_FALSE(tracker.IsConfident());
+
+    SECTION("Early exit disabled")
+    {
+        config.confidenceMargin = -1.f;
+        AdScoreTracker noExit{config};
+        noExit.Update(-1.0f);
+        REQUIRE(noExit.GetVerdict() == AdVerdict::Normal);
+        REQUIRE_FALSE(noExit.IsConfident());
+    }
+}
+
+TEST_CASE("Post-processing of a monitored output matches the full softmax", "[AD]")
+{
+    std::vector<int8_t> outputData = {-128, 40, 12, 127, 0, -5};
+    int dims[] = {2, 1, static_cast<int>(outputData.size())};
+    TfLiteTensor tensor = tflite::testing::CreateQuantizedTensor(
+                            outputData.data(), tflite::testing::IntArrayFromInts(dims), 0.0625f, 3);
+
+    arm::app::AdPostProcess full{&tensor};
+    REQUIRE(full.DoPostProcess());
+
+    for (uint32_t index = 0; index < outputData.size(); ++index) {
+        arm::app::AdPostProcess monitored{&tensor};
+        REQUIRE(monitored.SetMonitoredIndex(index));
+        REQUIRE(monitored.DoPostProcess());
+        REQUIRE(monitored.GetOutputValue(index) == Approx(full.GetOutputValue(index)).margin(1e-6));
+    }
+
+    arm::app::AdPostProcess monitored{&tensor};
+    REQUIRE_FALSE(monitored.SetMonitoredIndex(outputData.size()));
+}
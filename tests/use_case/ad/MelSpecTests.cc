@@ -215,3 +215,28 @@ TEST_CASE("Mel Spec calculation") {
         TestQuntisedMelSpec<int16_t>();
     }
 }
+
+TEST_CASE("Mel Spec fixed point calculation") {
+    auto melSpec = GetMelSpecInstance();
+    auto fixedPoint = melSpec.MakeFixedPoint();
+    const arm::app::audio::Span<const int16_t> audio(testWav1.data(), testWav1.size());
+
+    const float quantScale = 0.1410219967365265;
+    const int quantOffset = 11;
+    REQUIRE(fixedPoint.SetQuantisation(quantScale, quantOffset));
+    const auto melSpecOutput = fixedPoint.ComputeQuant<int8_t>(audio);
+    REQUIRE(melSpecOutput.size() == testWavMelSpec.size());
+    for (size_t i = 0; i < testWavMelSpec.size(); ++i) {
+        const long expected = std::max(-128l, std::lround((testWavMelSpec[i] / quantScale) + quantOffset));
+        REQUIRE(expected == Approx(melSpecOutput[i]).margin(1));
+    }
+
+    /* Training mean is subtracted before quantising. */
+    const float fineScale = 0.01;
+    const float trainingMean = -30;
+    REQUIRE(fixedPoint.SetQuantisation(fineScale, 0, trainingMean));
+    const auto fineOutput = fixedPoint.ComputeQuant<int16_t>(audio);
+    for (size_t i = 0; i < testWavMelSpec.size(); ++i) {
+        REQUIRE(fineOutput[i] * fineScale == Approx(testWavMelSpec[i] - trainingMean).margin(0.1));
+    }
+}
@@ -31,7 +31,8 @@ TEST_CASE("Test invalid classifier")
 
 TEST_CASE("Test valid classifier UINT8") {
     int dimArray[] = {4, 1, 1, 246, 29};
-    std::vector <std::string> labels(29);
+    std::vector<arm::app::LabelView> labelViews(29);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector <uint8_t> outputVec(7134);
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
     TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
@@ -47,7 +48,8 @@ TEST_CASE("Test valid classifier UINT8") {
 
 TEST_CASE("Get classification results") {
     int dimArray[] = {4, 1, 1, 10, 15};
-    std::vector <std::string> labels(15);
+    std::vector<arm::app::LabelView> labelViews(15);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<uint8_t> outputVec(150, static_cast<uint8_t>(1));
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
     TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
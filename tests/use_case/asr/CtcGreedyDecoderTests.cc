@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "CtcGreedyDecoder.hpp"
+
+#include <catch.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr uint32_t numClasses = 4;
+    constexpr uint32_t blankIdx = 3;
+    constexpr arm::app::LabelView testLabels[numClasses] = {"a", "b", " ", "$"};
+
+    /* One row of logits per token ID, with the given logit for the winning class. */
+    std::vector<int8_t> MakeLogits(const std::vector<uint32_t>& ids, int8_t topLogit = 10)
+    {
+        std::vector<int8_t> logits(ids.size() * numClasses, -100);
+        for (size_t i = 0; i < ids.size(); ++i) {
+            logits[i * numClasses + ids[i]] = topLogit;
+        }
+        return logits;
+    }
+
+    std::string ToText(const arm::app::asr::CtcToken* tokens, size_t numTokens)
+    {
+        char text[64];
+        arm::app::asr::CtcGreedyDecoder::TokensToText(tokens, numTokens,
+            arm::app::LabelTable(testLabels, numClasses), text, sizeof(text));
+        return std::string(text);
+    }
+} /* namespace */
+
+TEST_CASE("CTC decoder collapses repeats and blanks")
+{
+    arm::app::asr::CtcGreedyDecoder decoder(numClasses, blankIdx);
+    arm::app::asr::CtcToken tokens[16];
+
+    /* a a $ a b b " " $ $ b */
+    auto logits = MakeLogits({0, 0, 3, 0, 1, 1, 2, 3, 3, 1});
+    logits[1 * numClasses] = 20;    /* Second frame of the first 'a' is more confident. */
+
+    const size_t numTokens = decoder.Decode(logits.data(), 10, tokens, 16);
+    REQUIRE(numTokens == 5);
+    REQUIRE(ToText(tokens, numTokens) == "aab b");
+
+    REQUIRE(tokens[0].m_maxLogit == 20);
+    REQUIRE(tokens[0].m_frameIdx == 0);
+    REQUIRE(tokens[1].m_frameIdx == 3);
+    REQUIRE(tokens[4].m_tokenId == 1);
+    REQUIRE(tokens[4].m_frameIdx == 9);
+
+    arm::app::QuantParams quantParams;
+    quantParams.scale = 0.5f;
+    quantParams.offset = -2;
+    REQUIRE(arm::app::asr::CtcGreedyDecoder::GetTokenScore(tokens[0], quantParams) == Approx(11.f));
+}
+
+TEST_CASE("CTC decoder carries the last token across calls")
+{
+    arm::app::asr::CtcGreedyDecoder decoder(numClasses, blankIdx);
+    arm::app::asr::CtcToken tokens[4];
+
+    auto first = MakeLogits({0, 1});
+    auto second = MakeLogits({1, 0});
+
+    REQUIRE(decoder.Decode(first.data(), 2, tokens, 4) == 2);
+
+    /* The leading 'b' repeats the last token of the previous window. */
+    size_t numTokens = decoder.Decode(second.data(), 2, tokens, 4);
+    REQUIRE(numTokens == 1);
+    REQUIRE(tokens[0].m_tokenId == 0);
+    REQUIRE(tokens[0].m_frameIdx == 3);
+
+    decoder.Reset();
+    numTokens = decoder.Decode(second.data(), 2, tokens, 4);
+    REQUIRE(ToText(tokens, numTokens) == "ba");
+    REQUIRE(tokens[0].m_frameIdx == 0);
+}
+
+TEST_CASE("CTC decoder respects buffer sizes")
+{
+    arm::app::asr::CtcGreedyDecoder decoder(numClasses, blankIdx);
+    arm::app::asr::CtcToken tokens[2];
+
+    auto logits = MakeLogits({0, 1, 0, 1});
+    REQUIRE(decoder.Decode(logits.data(), 4, tokens, 2) == 2);
+
+    char text[2];
+    REQUIRE(arm::app::asr::CtcGreedyDecoder::TokensToText(tokens, 2,
+        arm::app::LabelTable(testLabels, numClasses), text, sizeof(text)) == 1);
+    REQUIRE(std::string(text) == "a");
+}
+
+TEST_CASE("CTC decoder on int8 output tensor")
+{
+    int dimArray[] = {4, 1, 1, 3, numClasses};
+    auto logits = MakeLogits({1, 3, 1});
+    TfLiteIntArray* dims = tflite::testing::IntArrayFromInts(dimArray);
+    TfLiteTensor tensor = tflite::testing::CreateQuantizedTensor(logits.data(), dims, 1, 0);
+
+    arm::app::asr::CtcGreedyDecoder decoder(numClasses, blankIdx);
+    arm::app::asr::CtcToken tokens[4];
+    size_t numTokens = 0;
+    REQUIRE(decoder.Decode(&tensor, tokens, 4, numTokens));
+    REQUIRE(ToText(tokens, numTokens) == "bb");
+
+    arm::app::asr::CtcGreedyDecoder wrongClasses(numClasses + 1, blankIdx);
+    REQUIRE(!wrongClasses.Decode(&tensor, tokens, 4, numTokens));
+    REQUIRE(numTokens == 0);
+    REQUIRE(!decoder.Decode(nullptr, tokens, 4, numTokens));
+}
+
+TEST_CASE("CTC decoder skips low scoring rows")
+{
+    arm::app::QuantParams quantParams;
+    quantParams.scale = 0.05f;
+    quantParams.offset = 0;
+
+    arm::app::asr::CtcGreedyDecoder decoder(numClasses, blankIdx);
+    arm::app::asr::CtcToken tokens[8];
+
+    /* a $ a, with the blank less confident than the threshold. */
+    auto logits = MakeLogits({0, 3, 0}, 40);
+    logits[1 * numClasses + 3] = 10;
+    REQUIRE(ToText(tokens, decoder.Decode(logits.data(), 3, tokens, 8)) == "aa");
+
+    /* Without the blank row, the two frames of 'a' are one token. */
+    decoder.Reset();
+    decoder.SetScoreThreshold(1.f, quantParams);
+    size_t numTokens = decoder.Decode(logits.data(), 3, tokens, 8);
+    REQUIRE(ToText(tokens, numTokens) == "a");
+    REQUIRE(tokens[0].m_frameIdx == 0);
+
+    /* A row scoring exactly the threshold is kept. */
+    decoder.Reset();
+    logits[1 * numClasses + 3] = 20;
+    REQUIRE(ToText(tokens, decoder.Decode(logits.data(), 3, tokens, 8)) == "aa");
+
+    /* a $ b $ a, with the 'b' less confident than the threshold. */
+    decoder.Reset();
+    logits = MakeLogits({0, 3, 1, 3, 0}, 40);
+    logits[2 * numClasses + 1] = 10;
+    numTokens = decoder.Decode(logits.data(), 5, tokens, 8);
+    REQUIRE(ToText(tokens, numTokens) == "aa");
+    REQUIRE(tokens[1].m_frameIdx == 4);
+}
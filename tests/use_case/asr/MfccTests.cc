@@ -159,3 +159,91 @@ TEST_CASE("MFCC calculation")
         TestQuantisedMFCC<int16_t>();
     }
 }
+
+TEST_CASE("MFCC batch calculation")
+{
+    /* More frames than a single DCT batch, with a shorter last frame. */
+    const size_t frameLen = 512;
+    const size_t stride = 160;
+    std::vector<int16_t> audio;
+    for (size_t i = 0; i < 7; ++i) {
+        audio.insert(audio.end(), testWav1.begin(), testWav1.end());
+    }
+
+    auto view = arm::app::audio::WindowView<const int16_t>(audio.data(), audio.size(), frameLen, stride, true);
+    const auto frames = view.Windows(0, view.NumWindows());
+    const size_t batchFrames = arm::app::audio::MFCC::ms_batchFrames;
+    REQUIRE(frames.Count() > batchFrames);
+    REQUIRE(!frames.IsFull());
+
+    const size_t numMfccFeats = golden_mfcc_output_testWav1.size();
+    const size_t outStride = frames.Count() + 2;
+    std::vector<float> batchOutput(numMfccFeats * outStride, 0.f);
+
+    auto mfcc = GetMFCCInstance();
+    REQUIRE(mfcc.MfccComputeBatch(frames, batchOutput.data(), outStride));
+
+    for (size_t k = 0; k < frames.Count(); ++k) {
+        const auto expected = mfcc.MfccCompute(frames[k]);
+        for (size_t i = 0; i < numMfccFeats; ++i) {
+            REQUIRE(batchOutput[i * outStride + k] == Approx(expected[i]).margin(0.001));
+        }
+    }
+
+    /* The first frame is testWav1 itself. */
+    for (size_t i = 0; i < numMfccFeats; ++i) {
+        REQUIRE(batchOutput[i * outStride] == Approx(golden_mfcc_output_testWav1[i]).margin(0.3));
+        REQUIRE(batchOutput[i * outStride + frames.Count()] == 0.f);
+    }
+
+    REQUIRE_FALSE(mfcc.MfccComputeBatch(frames, batchOutput.data(), frames.Count() - 1));
+}
+
+TEST_CASE("MFCC fixed point calculation")
+{
+    auto mfcc = GetMFCCInstance();
+    auto fixedPoint = mfcc.MakeFixedPoint();
+
+    const float quantScale = 0.1410219967365265;
+    const int quantOffset = 11;
+    REQUIRE(fixedPoint.SetQuantisation(quantScale, quantOffset));
+    const auto mfccOutput = fixedPoint.ComputeQuant<int16_t>(
+        arm::app::audio::Span<const int16_t>(testWav1.data(), testWav1.size()));
+    REQUIRE(mfccOutput.size() == golden_mfcc_output_testWav1.size());
+    for (size_t i = 0; i < golden_mfcc_output_testWav1.size(); ++i) {
+        REQUIRE(mfccOutput[i] * quantScale - quantOffset * quantScale ==
+                Approx(golden_mfcc_output_testWav1[i]).margin(0.5));
+    }
+
+    const auto zerosOutput = fixedPoint.ComputeQuant<int16_t>(
+        arm::app::audio::Span<const int16_t>(testWav2.data(), testWav2.size()));
+    for (size_t i = 0; i < golden_mfcc_output_testWav2.size(); ++i) {
+        REQUIRE((zerosOutput[i] - quantOffset) * quantScale ==
+                Approx(golden_mfcc_output_testWav2[i]).margin(0.5));
+    }
+}
+
+/* Computes its tables at run time, to check the compile time ones. */
+class RunTimeTablesMFCC : public arm::app::audio::Wav2LetterMFCC {
+public:
+    using Wav2LetterMFCC::Wav2LetterMFCC;
+
+protected:
+    const arm::app::audio::MelTables* GetPrecomputedTables() const override
+    {
+        return nullptr;
+    }
+};
+
+TEST_CASE("MFCC precomputed tables")
+{
+    auto mfcc = GetMFCCInstance();
+    RunTimeTablesMFCC runTimeMfcc(golden_mfcc_output_testWav1.size(), testWav1.size());
+
+    const auto mfccOutput = mfcc.MfccCompute(testWav1);
+    const auto runTimeOutput = runTimeMfcc.MfccCompute(testWav1);
+    REQUIRE(mfccOutput.size() == runTimeOutput.size());
+    for (size_t i = 0; i < mfccOutput.size(); ++i) {
+        REQUIRE(mfccOutput[i] == Approx(runTimeOutput[i]).margin(0.001));
+    }
+}
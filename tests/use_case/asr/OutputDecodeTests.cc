@@ -56,7 +56,7 @@ TEST_CASE("Running output decode on test vector") {
         /* Generate fake vecResults.m_label to mimic AsrClassifier output containing the testText. */
         for (size_t i = 0; i < 20; i++)
         {
-            vecResult[i].m_label = testText[h][i];
+            vecResult[i].m_label = arm::app::LabelView(testText[h][i].c_str(), testText[h][i].size());
         }
         /* Call function with fake vecResults and save returned string into 'buff'. */
         std::string buff = arm::app::audio::asr::DecodeOutput(vecResult); 
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ArenaAnalyser.hpp"
+#include "BufAttributes.hpp"
+#include "MicroNetKwsModel.hpp"
+
+#include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+namespace arm {
+namespace app {
+    namespace kws {
+        extern uint8_t* GetModelPointer();
+        extern size_t GetModelLen();
+    } /* namespace kws */
+} /* namespace app */
+} /* namespace arm */
+
+using namespace arm::app;
+
+TEST_CASE("Arena analyser finds the minimum arena of the KWS model")
+{
+    const std::vector<eval::ArenaModel> models{{"kws", kws::GetModelPointer(), kws::GetModelLen()}};
+
+    eval::ArenaReport report;
+    REQUIRE(eval::AnalyseArena(models, ACTIVATION_BUF_SZ, report));
+    REQUIRE(report.minArenaBytes > 0);
+    REQUIRE(report.minArenaBytes <= ACTIVATION_BUF_SZ);
+    REQUIRE(report.minArenaBytes % 16 == 0);
+    REQUIRE(report.persistentBytes > 0);
+    REQUIRE(report.persistentBytes + report.nonPersistentBytes <= report.minArenaBytes);
+
+    /* The minimum is tight: the use case model fits it and nothing smaller. */
+    REQUIRE(eval::ArenaFits(models, report.minArenaBytes));
+    REQUIRE_FALSE(eval::ArenaFits(models, report.minArenaBytes - 16));
+
+    std::unique_ptr<uint8_t[]> arena{new uint8_t[report.minArenaBytes]};
+    MicroNetKwsModel model;
+    REQUIRE(model.Init(arena.get(), report.minArenaBytes, kws::GetModelPointer(), kws::GetModelLen()));
+
+    /* Activation tensors can't need more than the planner gave them. */
+    REQUIRE(report.models.size() == 1);
+    const eval::ModelArenaInfo& info = report.models[0];
+    REQUIRE(info.numOperators > 0);
+    REQUIRE_FALSE(info.tensors.empty());
+    REQUIRE(info.peakLiveBytes > 0);
+    REQUIRE(info.peakLiveBytes <= report.nonPersistentBytes);
+    for (const auto& tensor : info.tensors) {
+        REQUIRE(tensor.firstOp <= tensor.lastOp);
+        REQUIRE(tensor.lastOp < static_cast<int32_t>(info.numOperators));
+    }
+
+    /* The input is live from the first operator. */
+    const size_t inputBytes = model.GetInputTensor(0)->bytes;
+    bool foundInput = false;
+    for (const auto& tensor : info.tensors) {
+        foundInput |= tensor.firstOp == 0 && tensor.bytes == inputBytes;
+    }
+    REQUIRE(foundInput);
+}
+
+TEST_CASE("Arena analyser header")
+{
+    eval::ArenaReport report;
+    report.minArenaBytes = 1000;
+    report.persistentBytes = 200;
+    report.nonPersistentBytes = 800;
+    report.models.resize(1);
+    report.models[0].name = "model.tflite";
+
+    REQUIRE(eval::RecommendedArenaSize(report, 0) == 1008);
+    REQUIRE(eval::RecommendedArenaSize(report, 10) == 1104);
+
+    const char* path = "arena_size_test.h";
+    REQUIRE(eval::WriteArenaHeader(path, report, 10));
+
+    std::ifstream header(path);
+    std::stringstream contents;
+    contents << header.rdbuf();
+    REQUIRE(contents.str().find("model.tflite") != std::string::npos);
+    REQUIRE(contents.str().find("#define ACTIVATION_BUF_SZ           0x00000450\n") != std::string::npos);
+    remove(path);
+}
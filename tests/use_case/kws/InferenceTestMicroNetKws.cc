@@ -119,3 +119,29 @@ TEST_CASE("Running inference with TensorFlow Lite Micro and MicroNetKwsModel int
         }
     }
 }
+
+TEST_CASE("Running inference after a fast boot and warm-up with MicroNetKwsModel int8", "[MicroNetKws]")
+{
+    REQUIRE(NUMBER_OF_IFM_FILES > 0);
+    arm::app::MicroNetKwsModel model{};
+
+    REQUIRE_FALSE(model.WarmUp());
+    model.SetFastBoot(true);
+    REQUIRE(model.Init(arm::app::tensorArena,
+                       sizeof(arm::app::tensorArena),
+                       arm::app::kws::GetModelPointer(),
+                       arm::app::kws::GetModelLen()));
+    REQUIRE(model.WarmUp());
+
+    /* Warming up leaves no trace on the results. */
+    TestInference<int8_t>(GetIfmDataArray(0), GetOfmDataArray(0), model);
+
+    /* Initialising again only resets the interpreter, keeping the tensors. */
+    TfLiteTensor* input = model.GetInputTensor(0);
+    REQUIRE(model.Init(arm::app::tensorArena,
+                       sizeof(arm::app::tensorArena),
+                       arm::app::kws::GetModelPointer(),
+                       arm::app::kws::GetModelLen()));
+    REQUIRE(model.GetInputTensor(0) == input);
+    TestInference<int8_t>(GetIfmDataArray(0), GetOfmDataArray(0), model);
+}
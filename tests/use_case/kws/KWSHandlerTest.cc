@@ -86,9 +86,7 @@ TEST_CASE("Inference by index")
     {
         caseContext.Set<uint32_t>("clipIndex", audioIndex);
 
-        std::vector<std::string> labels;
-        GetLabelsVector(labels);
-        caseContext.Set<const std::vector<std::string> &>("labels", labels);
+        caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
         REQUIRE(arm::app::ClassifyAudioHandler(caseContext, audioIndex, false));
         REQUIRE(caseContext.Has("results"));
@@ -157,9 +155,7 @@ TEST_CASE("Inference run all clips")
     arm::app::Classifier classifier;                     /* classifier wrapper object. */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
     REQUIRE(arm::app::ClassifyAudioHandler(caseContext, 0, true));
 }
 
@@ -30,7 +30,8 @@ TEST_CASE("Test invalid classifier")
 TEST_CASE("Test valid classifier, average=0 should be same as 1)")
 {
     int dimArray[] = {1, 5};
-    std::vector<std::string> labels(5);
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<uint8_t> outputVec = {0, 1, 2, 3, 4};
     std::vector<std::vector<float>> resultHistory = {};
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
@@ -55,7 +56,8 @@ TEST_CASE("Test valid classifier, average=0 should be same as 1)")
 TEST_CASE("Test valid classifier UINT8, average=1, softmax=false")
 {
     int dimArray[] = {1, 5};
-    std::vector<std::string> labels(5);
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<uint8_t> outputVec = {0, 1, 2, 3, 4};
     std::vector<std::vector<float>> resultHistory = {{0, 0, 0, 0, 0}};
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
@@ -77,7 +79,8 @@ TEST_CASE("Test valid classifier UINT8, average=1, softmax=false")
 TEST_CASE("Test valid classifier UINT8, average=2")
 {
     int dimArray[] = {1, 5};
-    std::vector<std::string> labels(5);
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<uint8_t> outputVec = {0, 1, 2, 3, 4};
     std::vector<std::vector<float>> resultHistory = {{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}};
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
@@ -102,7 +105,8 @@ TEST_CASE("Test valid classifier UINT8, average=2")
 TEST_CASE("Test valid classifier int8, average=0")
 {
     int dimArray[] = {1, 5};
-    std::vector<std::string> labels(5);
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
     std::vector<int8_t> outputVec = {-2, -1, 0, 2, 1};
     std::vector<std::vector<float>> resultHistory = {};
     TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "KwsClassifier.hpp"
+#include "KwsPosteriorSmoother.hpp"
+
+#include <catch.hpp>
+
+TEST_CASE("Test posterior smoother moving average")
+{
+    arm::app::KwsPosteriorSmoother smoother(3, 2);
+    std::vector<float> result(3);
+
+    const int16_t first[] = {10, 20, 30};
+    const int16_t second[] = {30, 20, 10};
+    const int16_t third[] = {0, 0, 0};
+
+    smoother.Update(first);
+    REQUIRE(smoother.GetSmoothed(result, 1.f, 0));
+    REQUIRE(result == std::vector<float>{5, 10, 15});
+
+    smoother.Update(second);
+    REQUIRE(smoother.GetSmoothed(result, 1.f, 0));
+    REQUIRE(result == std::vector<float>{20, 20, 20});
+
+    /* Oldest scores must drop out of the running sum. */
+    smoother.Update(third);
+    REQUIRE(smoother.GetRunningSum(0) == 30);
+    REQUIRE(smoother.GetRunningSum(1) == 20);
+    REQUIRE(smoother.GetRunningSum(2) == 10);
+
+    smoother.Reset();
+    REQUIRE(smoother.GetRunningSum(0) == 0);
+    REQUIRE(smoother.GetSmoothed(result, 0.5f, 0));
+    REQUIRE(result == std::vector<float>{0, 0, 0});
+}
+
+TEST_CASE("Test posterior smoother window length 0 same as 1")
+{
+    arm::app::KwsPosteriorSmoother smoother(2, 0);
+    std::vector<float> result(2);
+    const int16_t scores[] = {-4, 8};
+
+    REQUIRE(smoother.WindowLen() == 1);
+    smoother.Update(scores);
+    REQUIRE(smoother.GetSmoothed(result, 0.25f, 0));
+    REQUIRE(result == std::vector<float>{-1, 2});
+}
+
+TEST_CASE("Test posterior smoother exponential average")
+{
+    arm::app::KwsPosteriorSmoother smoother(1, 4, 0.5f);
+    std::vector<float> result(1);
+    const int16_t score[] = {100};
+
+    REQUIRE(smoother.IsExponential());
+    smoother.Update(score);
+    REQUIRE(smoother.GetSmoothed(result, 1.f, 0));
+    REQUIRE(result[0] == Approx(50.f));
+
+    smoother.Update(score);
+    REQUIRE(smoother.GetSmoothed(result, 1.f, 0));
+    REQUIRE(result[0] == Approx(75.f));
+}
+
+TEST_CASE("Test valid classifier with smoother INT8, average=2, softmax=false")
+{
+    int dimArray[] = {1, 5};
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
+    std::vector<int8_t> outputVec = {-2, -1, 0, 2, 1};
+    TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
+    TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
+            outputVec.data(), dims, 1, 0);
+    TfLiteTensor* outputTensor = &tfTensor;
+    std::vector<arm::app::ClassificationResult> resultVec;
+    arm::app::KwsClassifier classifier;
+    arm::app::KwsPosteriorSmoother smoother(labels.size(), 2);
+
+    REQUIRE(classifier.GetClassificationResults(outputTensor, resultVec, labels, 1, false, smoother));
+    REQUIRE(resultVec[0].m_labelIdx == 3);
+    REQUIRE(resultVec[0].m_normalisedVal == 1);
+
+    REQUIRE(classifier.GetClassificationResults(outputTensor, resultVec, labels, 1, false, smoother));
+    REQUIRE(resultVec[0].m_labelIdx == 3);
+    REQUIRE(resultVec[0].m_normalisedVal == 2);
+}
+
+TEST_CASE("Test classifier with smoother picks top N in order")
+{
+    int dimArray[] = {1, 6};
+    std::vector<arm::app::LabelView> labelViews(6);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
+    std::vector<int8_t> outputVec = {3, -4, 9, 0, 7, -1};
+    TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
+    TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
+            outputVec.data(), dims, 1, 0);
+    std::vector<arm::app::ClassificationResult> resultVec;
+    arm::app::KwsClassifier classifier;
+    arm::app::KwsPosteriorSmoother smoother(labels.size(), 1);
+
+    REQUIRE(classifier.GetClassificationResults(&tfTensor, resultVec, labels, 3, false, smoother));
+    REQUIRE(resultVec.size() == 3);
+    REQUIRE(resultVec[0].m_labelIdx == 2);
+    REQUIRE(resultVec[1].m_labelIdx == 4);
+    REQUIRE(resultVec[2].m_labelIdx == 0);
+    REQUIRE(resultVec[2].m_normalisedVal == 3);
+}
+
+TEST_CASE("Test valid classifier with smoother UINT8, softmax=true")
+{
+    int dimArray[] = {1, 5};
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
+    std::vector<uint8_t> outputVec = {0, 1, 2, 3, 4};
+    TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
+    TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
+            outputVec.data(), dims, 1, 0);
+    TfLiteTensor* outputTensor = &tfTensor;
+    std::vector<arm::app::ClassificationResult> resultVec;
+    std::vector<arm::app::ClassificationResult> expectedVec;
+    arm::app::KwsClassifier classifier;
+    arm::app::KwsPosteriorSmoother smoother(labels.size(), 1);
+
+    REQUIRE(classifier.GetClassificationResults(outputTensor, resultVec, labels, 1, true, smoother));
+    REQUIRE(classifier.GetClassificationResults(outputTensor, expectedVec, labels, 1, true));
+    REQUIRE(resultVec[0].m_labelIdx == 4);
+    REQUIRE(resultVec[0].m_normalisedVal == Approx(expectedVec[0].m_normalisedVal).margin(1.0 / INT16_MAX));
+}
+
+TEST_CASE("Test classifier with mismatched smoother")
+{
+    int dimArray[] = {1, 5};
+    std::vector<arm::app::LabelView> labelViews(5);
+    arm::app::LabelTable labels(labelViews.data(), labelViews.size());
+    std::vector<uint8_t> outputVec = {0, 1, 2, 3, 4};
+    TfLiteIntArray* dims= tflite::testing::IntArrayFromInts(dimArray);
+    TfLiteTensor tfTensor = tflite::testing::CreateQuantizedTensor(
+            outputVec.data(), dims, 1, 0);
+    std::vector<arm::app::ClassificationResult> resultVec;
+    arm::app::KwsClassifier classifier;
+    arm::app::KwsPosteriorSmoother smoother(4, 2);
+
+    REQUIRE(!classifier.GetClassificationResults(&tfTensor, resultVec, labels, 1, false, smoother));
+}
@@ -144,4 +144,62 @@ TEST_CASE("MFCC calculation test") {
     {
         TestQuantisedMFCC<int16_t>();
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("MFCC fixed point calculation test") {
+    auto mfcc = GetMFCCInstance();
+    auto fixedPoint = mfcc.MakeFixedPoint();
+    const arm::app::audio::Span<const int16_t> audio(testWav.data(), testWav.size());
+
+    /* Same quantisation as the float path, within one step. */
+    const float quantScale = 1.1088106632232666;
+    const int quantOffset = 95;
+    REQUIRE(fixedPoint.SetQuantisation(quantScale, quantOffset));
+    const auto mfccOutput = fixedPoint.ComputeQuant<int8_t>(audio);
+    REQUIRE(mfccOutput.size() == testWavMfcc.size());
+    for (size_t i = 0; i < testWavMfcc.size(); ++i) {
+        REQUIRE(std::lround((testWavMfcc[i] / quantScale) + quantOffset) == Approx(mfccOutput[i]).margin(1));
+    }
+
+    /* Fine quantisation against the golden features. */
+    const float fineScale = 0.001;
+    REQUIRE(fixedPoint.SetQuantisation(fineScale, 0));
+    const auto fineOutput = fixedPoint.ComputeQuant<int16_t>(audio);
+    for (size_t i = 0; i < testWavMfcc.size(); ++i) {
+        REQUIRE(fineOutput[i] * fineScale == Approx(testWavMfcc[i]).margin(0.02));
+    }
+}
+
+/* Computes its tables at run time, to check the compile time ones. */
+class RunTimeTablesMFCC : public arm::app::audio::MicroNetKwsMFCC {
+public:
+    using MicroNetKwsMFCC::MicroNetKwsMFCC;
+
+protected:
+    const arm::app::audio::MelTables* GetPrecomputedTables() const override
+    {
+        return nullptr;
+    }
+};
+
+TEST_CASE("MFCC precomputed tables test") {
+    auto mfcc = GetMFCCInstance();
+    RunTimeTablesMFCC runTimeMfcc(testWavMfcc.size(), testWav.size());
+
+    const auto mfccOutput = mfcc.MfccCompute(testWav);
+    const auto runTimeOutput = runTimeMfcc.MfccCompute(testWav);
+    REQUIRE(mfccOutput.size() == runTimeOutput.size());
+    for (size_t i = 0; i < mfccOutput.size(); ++i) {
+        REQUIRE(mfccOutput[i] == Approx(runTimeOutput[i]).margin(0.0001));
+    }
+
+    /* Other frame lengths have no precomputed tables and fall back to run time ones. */
+    const std::vector<int16_t> shortWav(testWav.begin(), testWav.begin() + 480);
+    arm::app::audio::MicroNetKwsMFCC shortMfcc(testWavMfcc.size(), shortWav.size());
+    RunTimeTablesMFCC shortRunTimeMfcc(testWavMfcc.size(), shortWav.size());
+    const auto shortOutput = shortMfcc.MfccCompute(shortWav);
+    const auto shortRunTimeOutput = shortRunTimeMfcc.MfccCompute(shortWav);
+    for (size_t i = 0; i < shortOutput.size(); ++i) {
+        REQUIRE(shortOutput[i] == shortRunTimeOutput[i]);
+    }
+}
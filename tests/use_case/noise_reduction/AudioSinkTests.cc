@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AudioSink.hpp"
+#include "WavFileAudioSink.hpp"
+
+#include <catch.hpp>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    constexpr size_t chunkBytes = 64;
+    using TestRingSink = arm::app::RingAudioSink<chunkBytes, 4>;
+
+    /* Drains the ring into one byte stream, checking no chunk was lost. */
+    void Drain(TestRingSink::Ring& ring, uint32_t& nextSequence, std::vector<uint8_t>& stream)
+    {
+        TestRingSink::Chunk chunk;
+        while (ring.TryPop(chunk)) {
+            REQUIRE(nextSequence++ == chunk.m_sequence);
+            stream.insert(stream.end(), chunk.m_data, chunk.m_data + chunk.m_numBytes);
+        }
+    }
+
+} /* namespace */
+
+TEST_CASE("Ring audio sink streams the memory dump format", "[RNNoise]")
+{
+    TestRingSink::Ring ring;
+    TestRingSink sink(ring);
+
+    std::vector<int16_t> frame(20);
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<int16_t>(i * 100 - 1000);
+    }
+
+    std::vector<uint8_t> stream;
+    uint32_t nextSequence = 0;
+    REQUIRE(sink.Begin("clip.wav", 3 * frame.size()));
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(sink.Write(frame.data(), frame.size()));
+
+        /* Drained as it goes, so the ring never fills up. */
+        Drain(ring, nextSequence, stream);
+    }
+    REQUIRE(sink.End());
+    Drain(ring, nextSequence, stream);
+    REQUIRE(0 == sink.GetDroppedCount());
+
+    const size_t headerBytes = 4 + 8 + 4;
+    const size_t audioBytes = 3 * frame.size() * sizeof(int16_t);
+    REQUIRE(headerBytes + audioBytes == stream.size());
+
+    int32_t nameLength = 0;
+    int32_t dumpBytes = 0;
+    std::memcpy(&nameLength, stream.data(), 4);
+    std::memcpy(&dumpBytes, stream.data() + 12, 4);
+    REQUIRE(8 == nameLength);
+    REQUIRE(std::string("clip.wav") == std::string(stream.begin() + 4, stream.begin() + 12));
+    REQUIRE(static_cast<int32_t>(audioBytes) == dumpBytes);
+
+    for (int i = 0; i < 3; ++i) {
+        std::vector<int16_t> written(frame.size());
+        std::memcpy(written.data(), stream.data() + headerBytes + i * frame.size() * sizeof(int16_t),
+                    frame.size() * sizeof(int16_t));
+        REQUIRE(frame == written);
+    }
+}
+
+TEST_CASE("Ring audio sink drops chunks when not drained", "[RNNoise]")
+{
+    TestRingSink::Ring ring;
+    TestRingSink sink(ring);
+
+    /* Six chunks' worth into a ring of four. */
+    std::vector<int16_t> audio(3 * chunkBytes / sizeof(int16_t));
+    REQUIRE(sink.Begin("a.wav", audio.size()));
+    REQUIRE(sink.Write(audio.data(), audio.size()));
+    REQUIRE(sink.Write(audio.data(), audio.size()));
+    REQUIRE(sink.End());
+
+    REQUIRE(4 == ring.Size());
+    REQUIRE(sink.GetDroppedCount() > 0);
+}
+
+TEST_CASE("WAV file sink writes a playable file", "[RNNoise]")
+{
+    const std::string outputDir = ".";
+    const std::string path = outputDir + "/denoised_sink_test.wav";
+
+    std::vector<int16_t> frame(480);
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<int16_t>(i * 7);
+    }
+
+    {
+        /* Small buffers, so the writer thread flushes several times. */
+        arm::app::WavFileAudioSink sink(outputDir, 48000, 200);
+        REQUIRE(sink.Begin("sink_test.wav", 0));
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(sink.Write(frame.data(), frame.size()));
+        }
+        REQUIRE(sink.End());
+    }
+
+    FILE* file = std::fopen(path.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    std::vector<uint8_t> contents;
+    uint8_t byte;
+    while (std::fread(&byte, 1, 1, file) == 1) {
+        contents.push_back(byte);
+    }
+    std::fclose(file);
+    std::remove(path.c_str());
+
+    const size_t dataBytes = 5 * frame.size() * sizeof(int16_t);
+    REQUIRE(44 + dataBytes == contents.size());
+    REQUIRE(std::string("RIFF") == std::string(contents.begin(), contents.begin() + 4));
+    REQUIRE(std::string("WAVEfmt ") == std::string(contents.begin() + 8, contents.begin() + 16));
+
+    uint32_t riffBytes = 0;
+    uint32_t sampleRate = 0;
+    uint32_t headerDataBytes = 0;
+    std::memcpy(&riffBytes, contents.data() + 4, 4);
+    std::memcpy(&sampleRate, contents.data() + 24, 4);
+    std::memcpy(&headerDataBytes, contents.data() + 40, 4);
+    REQUIRE(36 + dataBytes == riffBytes);
+    REQUIRE(48000 == sampleRate);
+    REQUIRE(dataBytes == headerDataBytes);
+
+    for (int i = 0; i < 5; ++i) {
+        std::vector<int16_t> written(frame.size());
+        std::memcpy(written.data(), contents.data() + 44 + i * frame.size() * sizeof(int16_t),
+                    frame.size() * sizeof(int16_t));
+        REQUIRE(frame == written);
+    }
+}
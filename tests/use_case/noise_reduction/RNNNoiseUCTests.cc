@@ -19,6 +19,8 @@
 #include "Profiler.hpp"
 #include "RNNUCTestCaseData.hpp"
 #include "RNNoiseModel.hpp"
+#include "RNNoiseMultiChannel.hpp"
+#include "RNNoiseProcessing.hpp"
 #include "UseCaseHandler.hpp"
 #include "hal.h"
 
@@ -224,3 +226,74 @@ TEST_CASE("Inference by index - several inferences", "[RNNoise]")
     std::vector<uint32_t> numberOfInferences = {1, 2, totalInferences};
     testInfByIndex(numberOfInferences);
 }
+
+TEST_CASE("Inference run several channels at once", "[RNNoise]")
+{
+    PLATFORM
+
+    arm::app::RNNoiseModel model;
+
+    CONTEXT
+
+    caseContext.Set<uint32_t>("clipIndex", 0);
+    caseContext.Set<uint32_t>("numInputFeatures", arm::app::rnn::g_NumInputFeatures);
+    caseContext.Set<uint32_t>("frameLength", arm::app::rnn::g_FrameLength);
+    caseContext.Set<uint32_t>("frameStride", arm::app::rnn::g_FrameStride);
+
+    REQUIRE(model.Init(arm::app::tensorArena,
+                       sizeof(arm::app::tensorArena),
+                       arm::app::rnn::GetModelPointer(),
+                       arm::app::rnn::GetModelLen()));
+
+    REQUIRE(arm::app::NoiseReductionMultiChannelHandler(caseContext, 3));
+    REQUIRE(3 % NUMBER_OF_FILES == caseContext.Get<uint32_t>("clipIndex"));
+}
+
+TEST_CASE("Interleaved channels match a single channel run", "[RNNoise]")
+{
+    PLATFORM
+
+    arm::app::RNNoiseModel model;
+    REQUIRE(model.Init(arm::app::tensorArena,
+                       sizeof(arm::app::tensorArena),
+                       arm::app::rnn::GetModelPointer(),
+                       arm::app::rnn::GetModelLen()));
+
+    constexpr size_t numFrames = 4;
+    const uint32_t frameLength = arm::app::rnn::g_FrameLength;
+    const int16_t* audio = GetAudioArray(1);
+    REQUIRE(GetAudioArraySize(1) >= numFrames * frameLength);
+
+    /* Reference: one channel, carrying its GRU state over in place. */
+    auto featureProcessor = std::make_shared<arm::app::rnn::RNNoiseFeatureProcessor>();
+    auto frameFeatures = std::make_shared<arm::app::rnn::FrameFeatures>();
+    std::vector<int16_t> denoisedFrame(frameLength);
+    arm::app::RNNoisePreProcess preProcess(model.GetInputTensor(0), featureProcessor, frameFeatures);
+    arm::app::RNNoisePostProcess postProcess(model.GetOutputTensor(model.m_indexForModelOutput),
+                                             denoisedFrame, featureProcessor, frameFeatures);
+
+    std::vector<std::vector<int16_t>> expected;
+    for (size_t frame = 0; frame < numFrames; ++frame) {
+        REQUIRE(preProcess.DoPreProcess(audio + frame * frameLength, frameLength));
+        if (frame == 0) {
+            model.ResetGruState();
+        } else {
+            REQUIRE(model.CopyGruStates());
+        }
+        REQUIRE(model.RunInference());
+        REQUIRE(postProcess.DoPostProcess());
+        expected.push_back(denoisedFrame);
+    }
+
+    /* Two channels of the same audio, taking turns on the model. */
+    arm::app::RNNoiseMultiChannel multiChannel(model, 2, frameLength);
+    REQUIRE(2 == multiChannel.NumChannels());
+    for (size_t frame = 0; frame < numFrames; ++frame) {
+        for (uint32_t channel = 0; channel < 2; ++channel) {
+            REQUIRE(multiChannel.DenoiseFrame(channel, audio + frame * frameLength));
+            REQUIRE(expected[frame] == multiChannel.GetDenoisedFrame(channel));
+        }
+    }
+
+    REQUIRE_FALSE(multiChannel.DenoiseFrame(2, audio));
+}
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2023 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DetectionTracker.hpp"
+
+#include <catch.hpp>
+
+using arm::app::object_detection::DetectionResult;
+using arm::app::object_detection::DetectionTracker;
+using arm::app::object_detection::TrackerParams;
+
+TEST_CASE("Tracker runs the detector every keyframe interval")
+{
+    TrackerParams params;
+    params.keyframeInterval = 3;
+    DetectionTracker tracker(params);
+
+    /* Nothing to track before the first detection. */
+    REQUIRE(tracker.NeedsDetection());
+
+    std::vector<DetectionResult> results{DetectionResult(0.9, 10, 20, 30, 30)};
+    tracker.Update(results);
+    REQUIRE(!tracker.NeedsDetection());
+    tracker.Predict(results);
+    REQUIRE(!tracker.NeedsDetection());
+    tracker.Predict(results);
+    REQUIRE(tracker.NeedsDetection());
+
+    REQUIRE(tracker.GetFrameCount() == 3);
+    REQUIRE(tracker.GetKeyframeCount() == 1);
+
+    tracker.Reset();
+    REQUIRE(tracker.NeedsDetection());
+    REQUIRE(tracker.GetFrameCount() == 0);
+}
+
+TEST_CASE("Tracker predicts boxes with constant velocity")
+{
+    TrackerParams params;
+    params.keyframeInterval = 4;
+    params.velocitySmoothing = 1.f;
+    DetectionTracker tracker(params);
+
+    std::vector<DetectionResult> results;
+    tracker.Update({DetectionResult(0.8, 10, 20, 30, 30)});
+
+    /* Object moved 3 frames later: 4 pixels right and 2 down per frame. */
+    tracker.Predict(results);
+    tracker.Predict(results);
+    tracker.Update({DetectionResult(0.7, 22, 26, 30, 30)});
+
+    tracker.Predict(results);
+    REQUIRE(results.size() == 1);
+    REQUIRE(results[0].m_x0 == 26);
+    REQUIRE(results[0].m_y0 == 28);
+    REQUIRE(results[0].m_w == 30);
+    REQUIRE(results[0].m_h == 30);
+    REQUIRE(results[0].m_normalisedVal == Approx(0.7));
+
+    tracker.Predict(results);
+    REQUIRE(results[0].m_x0 == 30);
+    REQUIRE(results[0].m_y0 == 30);
+}
+
+TEST_CASE("Tracker replaces tracks that no longer match")
+{
+    TrackerParams params;
+    params.keyframeInterval = 10;
+    DetectionTracker tracker(params);
+
+    std::vector<DetectionResult> results;
+    tracker.Update({DetectionResult(0.8, 0, 0, 20, 20), DetectionResult(0.6, 100, 100, 20, 20)});
+    tracker.Predict(results);
+    REQUIRE(results.size() == 2);
+
+    /* The first object is gone, a new one appears far from both. */
+    tracker.Update({DetectionResult(0.6, 102, 100, 20, 20), DetectionResult(0.9, 50, 0, 20, 20)});
+    tracker.Predict(results);
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].m_x0 > 100);
+    REQUIRE(results[1].m_x0 == 50);
+}
+
+TEST_CASE("Tracker re-detects when confidence drops")
+{
+    TrackerParams params;
+    params.keyframeInterval = 100;
+    params.confidenceDecay = 0.5f;
+    params.minConfidence = 0.2f;
+    DetectionTracker tracker(params);
+
+    std::vector<DetectionResult> results;
+    tracker.Update({DetectionResult(0.8, 0, 0, 20, 20)});
+    REQUIRE(!tracker.NeedsDetection());     /* Next confidence 0.5. */
+    tracker.Predict(results);
+    REQUIRE(!tracker.NeedsDetection());     /* Next confidence 0.25. */
+    tracker.Predict(results);
+    REQUIRE(tracker.NeedsDetection());      /* Next confidence 0.125. */
+}
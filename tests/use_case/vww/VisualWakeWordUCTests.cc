@@ -74,9 +74,7 @@ TEST_CASE("Inference by index")
     arm::app::Classifier classifier;    /* classifier wrapper object */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
     REQUIRE(arm::app::ClassifyImageHandler(caseContext, 0, false));
 
@@ -107,9 +105,7 @@ TEST_CASE("Inference run all images")
     arm::app::Classifier classifier;    /* classifier wrapper object */
     caseContext.Set<arm::app::Classifier&>("classifier", classifier);
 
-    std::vector <std::string> labels;
-    GetLabelsVector(labels);
-    caseContext.Set<const std::vector <std::string>&>("labels", labels);
+    caseContext.Set<arm::app::LabelTable>("labels", GetLabels());
 
     REQUIRE(arm::app::ClassifyImageHandler(caseContext, 0, true));
 }